@@ -2,6 +2,7 @@
 
 #include <NeonVector/Core/Application.h>
 #include <NeonVector/Core/Types.h>
+#include <NeonVector/Core/PackedColor.h>
 #include <NeonVector/Graphics/LineBatcher.h>
 #include <NeonVector/Graphics/Primitives.h>
 #include <NeonVector/Math/Vector2.h>
@@ -99,14 +100,12 @@ public:
             float endX = centerX + std::cos(angle) * outerRadius;
             float endY = centerY + std::sin(angle) * outerRadius;
 
-            // 虹色（HSV→RGB変換）
+            // 虹色（HSV→RGB はテーブル引きで 8bit の色を直接作る）
             float hue = (float)i / lineCount;
-            float r, g, b;
-            HSVtoRGB(hue, 1.0f, 1.0f, r, g, b);
+            ColorRGBA8 color = ColorSpace::HsvToRGBA8(hue, 1.0f, 1.0f);
 
             Vector2 start{ startX, startY };
             Vector2 end{ endX, endY };
-            Color color{ r, g, b, 1.0f };
 
             batcher->AddLine(start, end, color, 3.0f, 1.0f);
         }
@@ -170,38 +169,6 @@ public:
             }
         }
     }
-
-private:
-    // HSV→RGB変換
-    void HSVtoRGB(float h, float s, float v, float& r, float& g, float& b)
-    {
-        float c = v * s;
-        float x = c * (1.0f - std::abs(std::fmod(h * 6.0f, 2.0f) - 1.0f));
-        float m = v - c;
-
-        if (h < 1.0f / 6.0f) {
-            r = c; g = x; b = 0;
-        }
-        else if (h < 2.0f / 6.0f) {
-            r = x; g = c; b = 0;
-        }
-        else if (h < 3.0f / 6.0f) {
-            r = 0; g = c; b = x;
-        }
-        else if (h < 4.0f / 6.0f) {
-            r = 0; g = x; b = c;
-        }
-        else if (h < 5.0f / 6.0f) {
-            r = x; g = 0; b = c;
-        }
-        else {
-            r = c; g = 0; b = x;
-        }
-
-        r += m;
-        g += m;
-        b += m;
-    }
 };
 
 int main()
@@ -34,6 +34,20 @@ public:
         }
         m_particles.SetDrag(0.4f);   // すぐ減速して火花っぽく
         m_color = Color::Cyan;
+
+        // 左ドラッグ中だけ動くマウス噴射（毎秒 300 個、移動速度を少し引き継ぐ）
+        Effects::EmitterDesc spray;
+        spray.rate = 300.0f;
+        spray.minSpeed = 60.0f;
+        spray.maxSpeed = 280.0f;
+        spray.inheritVelocity = 0.3f;
+        spray.life = 0.7f;
+        spray.size = 3.0f;
+        m_spray = m_particles.AddEmitter(spray, GetMousePosition());
+
+        // コメットは 8px 間隔で点を残し、曲線で補間して描く（フレームレートに依らない尾）
+        m_trail.SetSampling(8.0f, 0.05f);
+        m_trail.SetSmoothing(0.5f);
     }
 
     void OnUpdate(float dt) override
@@ -49,11 +63,14 @@ public:
 
         // マウス追従コメット
         Vector2 mouse = GetMousePosition();
-        m_trail.Push(mouse);
+        m_trail.Push(mouse, dt);
 
-        // 左ドラッグでパーティクル噴射
-        if (IsMouseButtonDown(0))
-            m_particles.Emit(mouse, 5, 60.0f, 280.0f, m_color, 0.7f, 3.0f);
+        // 左ドラッグでパーティクル噴射（放出は Update 内でフレームレート非依存に行われる）
+        if (auto* spray = m_particles.GetEmitter(m_spray)) {
+            spray->SetPosition(mouse);
+            spray->SetActive(IsMouseButtonDown(0));
+            spray->desc.color = m_color;
+        }
 
         // Space で中央から大きめのバースト
         if (WasKeyPressed(VK_SPACE))
@@ -98,6 +115,7 @@ private:
     std::unique_ptr<Effects::BloomEffect> m_bloom;
     Effects::Trail m_trail{ 40 };
     Effects::ParticleSystem m_particles;
+    Effects::EmitterId m_spray;
     Color m_color;
     float m_time = 0.0f;
     float m_rot = 0.0f;
@@ -2,12 +2,15 @@
 // NeonVector で作る「ネオン Asteroids」。エンジンが実ゲームを作れることの実証:
 // 入力・拡張プリミティブ・Trail・ParticleSystem・Bloom を総動員。
 //
-// 操作: ←/→ or A/D=旋回, ↑ or W=推進, Space=射撃, R=リスタート, Esc=終了
+// 操作: ←/→ or A/D=旋回, ↑ or W=推進, Space=射撃, R=リスタート, T=更新のトレースを書き出す, Esc=終了
 
 #include <NeonVector/NeonVector.h>
 #include <NeonVector/Effects/BloomEffect.h>
+#include <NeonVector/Core/SystemScheduler.h>
+#include <NeonVector/Core/JobSystem.h>
 
 #include <cmath>
+#include <fstream>
 #include <memory>
 #include <vector>
 #include <random>
@@ -21,11 +24,11 @@ namespace {
     constexpr float kTwoPi = 6.28318530718f;
     int   g_W = 1280, g_H = 720;
 
-    Vector2 fromAngle(float a) { return { std::cos(a), std::sin(a) }; }
-    Vector2 rotate(const Vector2& v, float a) {
-        float c = std::cos(a), s = std::sin(a);
-        return { v.x * c - v.y * s, v.x * s + v.y * c };
-    }
+    // 自機の輪郭（ローカル座標、機首 = +x）
+    const Vector2 kShipHull[] = { { 18.0f, 0.0f }, { -12.0f, 11.0f }, { -6.0f, 0.0f }, { -12.0f, -11.0f } };
+
+    // HUD・背景の色はパレットの添字で持つ（色は OnInit でまとめて設定）
+    constexpr PaletteIndex kPalGrid{ 0 }, kPalHud{ 1 }, kPalWave{ 2 }, kPalGameOver{ 3 };
     float dist(const Vector2& a, const Vector2& b) { return (a - b).Length(); }
     void wrap(Vector2& p) {
         if (p.x < 0) p.x += g_W; else if (p.x >= g_W) p.x -= g_W;
@@ -43,11 +46,15 @@ struct Ship {
 
 struct Bullet { Vector2 pos, vel; float life; };
 
+// スコア・残機・ウェーブ・乱数（システムの読み書きの宣言に使う目印）
+struct Progress {};
+
 struct Asteroid {
     Vector2 pos, vel;
     float radius, angle, spin;
     int tier;                    // 3=大 2=中 1=小
-    std::vector<float> shape;    // 各頂点の半径倍率（ゴツゴツ感）
+    std::vector<Vector2> outline; // ローカル座標の輪郭（頂点ごとに半径をばらしてゴツゴツ感）
+    Physics::PolygonShape shape;  // outline の凸分割（当たり判定用。生成時に 1 回だけ作る）
 };
 
 class NeonAsteroids : public Application
@@ -70,7 +77,15 @@ public:
             m_bloom->SetBloomStrength(1.3f);
             m_bloom->SetBlurRadius(2.5f);
         }
+        m_palette.Set(kPalGrid, Color{ 0.15f,0.35f,0.5f,0.12f });
+        m_palette.Set(kPalHud, Color{ 0.5f,1.0f,0.9f,1.0f });
+        m_palette.Set(kPalWave, Color{ 0.4f,0.7f,1.0f,0.8f });
+        m_palette.Set(kPalGameOver, Color{ 1.0f,0.35f,0.45f,1.0f });
+        m_grid.SetWrap(Vector2{ static_cast<float>(g_W), static_cast<float>(g_H) });   // 端をまたぐ当たりも拾う
         m_particles.SetDrag(0.5f);
+        m_particles.SetCapacity(4096, Effects::OverflowPolicy::ReplaceDimmest);   // 爆発が重なっても確保しない
+        m_particles.SetJobSystem(GetJobSystem());
+        addSystems();
         startGame();
     }
 
@@ -79,28 +94,26 @@ public:
         if (dt > 0.05f) dt = 0.05f;   // スパイク抑制
         m_time += dt;
 
-        if (m_gameOver) {
-            if (WasKeyPressed('R') || WasKeyPressed(VK_SPACE)) startGame();
-            m_particles.Update(dt);
-            return;
-        }
-
-        updateShip(dt);
-        updateBullets(dt);
-        updateAsteroids(dt);
-        m_particles.Update(dt);
-        checkCollisions();
+        // ゲームオーバー中はパーティクルだけ動かす（リスタートしたフレームも）
+        const bool playing = !m_gameOver;
+        if (m_gameOver && (WasKeyPressed('R') || WasKeyPressed(VK_SPACE))) startGame();
+        for (uint32_t id : m_gameplaySystems) m_systems.SetEnabled(id, playing);
+        m_systems.Run(dt);
 
-        if (m_asteroids.empty()) nextWave();
+        if (WasKeyPressed('T')) {
+            std::ofstream("asteroids_schedule.json") << m_systems.FormatTraceJson();
+            std::cerr << "Wrote asteroids_schedule.json (open in chrome://tracing)" << std::endl;
+        }
     }
 
     void OnRender() override
     {
         auto* b = GetLineBatcher();
         if (!b) return;
+        b->SetPalette(&m_palette);
 
         // 背景グリッド（ごく薄く）
-        Graphics::DrawGrid(b, { 0,0 }, { (float)g_W,(float)g_H }, 80.0f, Color{ 0.15f,0.35f,0.5f,0.12f }, 1.0f, 0.25f);
+        Graphics::DrawGrid(b, { 0,0 }, { (float)g_W,(float)g_H }, 80.0f, m_palette[kPalGrid].ToColor(), 1.0f, 0.25f);
 
         drawAsteroids(b);
         drawBullets(b);
@@ -114,11 +127,34 @@ public:
     }
 
 private:
+    // 更新を読み書きするデータ付きのシステムに分ける。ship と asteroids、bullets と particles は同時に走る
+    void addSystems()
+    {
+        using Effects::ParticleSystem;
+        using Effects::Trail;
+        m_gameplaySystems = {
+            m_systems.Add("ship", SystemAccess().Write<Ship, Bullet, ParticleSystem, Trail>(),
+                [this](float dt) { updateShip(dt); }),
+            m_systems.Add("asteroids", SystemAccess().Write<Asteroid>(),
+                [this](float dt) { updateAsteroids(dt); }),
+            m_systems.Add("bullets", SystemAccess().Write<Bullet>(),
+                [this](float dt) { updateBullets(dt); }),
+        };
+        m_systems.Add("particles", SystemAccess().Write<ParticleSystem>(),
+            [this](float dt) { m_particles.Update(dt); });
+        m_gameplaySystems.push_back(m_systems.Add("collisions",
+            SystemAccess().Write<Ship, Bullet, Asteroid, ParticleSystem, Trail, Progress>(),
+            [this](float dt) {
+                checkCollisions(dt);
+                if (m_asteroids.empty()) nextWave();
+            }));
+    }
+
     // ── ゲーム進行 ──
     void startGame()
     {
         m_score = 0; m_lives = 3; m_wave = 0; m_gameOver = false;
-        m_bullets.clear(); m_asteroids.clear(); m_particles.Clear(); m_trail.Clear();
+        m_bullets.Clear(); m_asteroids.clear(); m_particles.Clear(); m_trail.Clear();
         resetShip();
         nextWave();
     }
@@ -148,14 +184,17 @@ private:
         a.pos = pos;
         float speed = randf(30.0f, 70.0f) + m_wave * 5.0f + (3 - tier) * 25.0f;
         float dir = randf(0, kTwoPi);
-        a.vel = fromAngle(dir) * speed;
+        a.vel = Vector2::FromAngle(dir) * speed;
         a.tier = tier;
         a.radius = (tier == 3) ? 56.0f : (tier == 2) ? 32.0f : 17.0f;
         a.angle = randf(0, kTwoPi);
         a.spin = randf(-1.2f, 1.2f);
         int verts = 10 + (m_rng() % 3);
-        a.shape.reserve(verts);
-        for (int i = 0; i < verts; ++i) a.shape.push_back(randf(0.72f, 1.18f));
+        const float step = kTwoPi / verts;
+        a.outline.reserve(verts);
+        for (int i = 0; i < verts; ++i)
+            a.outline.push_back(Vector2::FromAngle(step * i) * (a.radius * randf(0.72f, 1.18f)));
+        a.shape.Set(a.outline.data(), a.outline.size());
         m_asteroids.push_back(std::move(a));
     }
 
@@ -174,9 +213,9 @@ private:
 
         bool thrusting = IsKeyDown(VK_UP) || IsKeyDown('W');
         if (thrusting) {
-            m_ship.vel = m_ship.vel + fromAngle(m_ship.angle) * (330.0f * dt);
+            m_ship.vel = m_ship.vel + Vector2::FromAngle(m_ship.angle) * (330.0f * dt);
             // 尾から炎パーティクル＋トレイル
-            Vector2 tail = m_ship.pos - fromAngle(m_ship.angle) * 16.0f;
+            Vector2 tail = m_ship.pos - Vector2::FromAngle(m_ship.angle) * 16.0f;
             m_trail.Push(tail);
             if (m_thrustEmit <= 0.0f) {
                 m_particles.Emit(tail, 3, 40.0f, 160.0f, Color{ 1.0f,0.6f,0.2f,1.0f }, 0.4f, 2.5f);
@@ -194,41 +233,96 @@ private:
         // 射撃（クールダウン付き）
         m_fireCd -= dt;
         if (IsKeyDown(VK_SPACE) && m_fireCd <= 0.0f) {
-            Vector2 dir = fromAngle(m_ship.angle);
+            Vector2 dir = Vector2::FromAngle(m_ship.angle);
             Bullet bt; bt.pos = m_ship.pos + dir * 18.0f;
             bt.vel = dir * 640.0f + m_ship.vel;
             bt.life = 1.05f;
-            m_bullets.push_back(bt);
+            m_bullets.Create(bt);
             m_fireCd = 0.16f;
         }
     }
     void updateBullets(float dt)
     {
-        for (auto& b : m_bullets) { b.pos = b.pos + b.vel * dt; wrap(b.pos); b.life -= dt; }
-        eraseDead(m_bullets, [](const Bullet& b) { return b.life <= 0.0f; });
+        // 寿命の尽きた弾は反復の後でまとめて返す（反復中に詰め替えない）
+        for (size_t i = 0; i < m_bullets.Size(); ++i) {
+            Bullet& b = m_bullets[i];
+            b.pos = b.pos + b.vel * dt; wrap(b.pos); b.life -= dt;
+            if (b.life <= 0.0f) m_bullets.DestroyDeferred(m_bullets.HandleAt(i));
+        }
+        m_bullets.FlushDeferred();
     }
     void updateAsteroids(float dt)
     {
         for (auto& a : m_asteroids) { a.pos = a.pos + a.vel * dt; wrap(a.pos); a.angle += a.spin * dt; }
     }
-    void checkCollisions()
+    void checkCollisions(float dt)
     {
-        // 弾 vs 小惑星
-        for (auto& bt : m_bullets) {
-            for (size_t i = 0; i < m_asteroids.size(); ++i) {
-                if (dist(bt.pos, m_asteroids[i].pos) < m_asteroids[i].radius) {
-                    bt.life = 0.0f;
-                    splitAsteroid(i);
-                    break;
+        const Vector2 world{ static_cast<float>(g_W), static_cast<float>(g_H) };
+
+        // 弾・小惑星をこのフレームの移動の始点と移動量で表す（位置は移動・巻き戻し後なので戻す）。
+        // 小惑星は輪郭の外接円で表し、下の線分判定の前の足切りに使う
+        m_targets.clear();
+        for (const auto& a : m_asteroids)
+            m_targets.push_back({ a.pos - a.vel * dt, a.vel * dt, a.shape.BoundingRadius() });
+        m_movers.clear();
+        m_sweepCenters.clear();
+        m_sweepRadii.clear();
+        for (const auto& bt : m_bullets) {
+            const Vector2 d = bt.vel * dt;
+            m_movers.push_back({ bt.pos - d, d, 0.0f });
+            m_sweepCenters.push_back(bt.pos - d * 0.5f);   // 移動の線分を覆う円
+            m_sweepRadii.push_back(d.Length() * 0.5f);
+        }
+
+        // 候補: 小惑星は移動の分だけ太らせてグリッドに入れ直し、弾の移動を覆う円でまとめて問い合わせる
+        m_grid.Clear();
+        for (size_t i = 0; i < m_asteroids.size(); ++i)
+            m_grid.Insert(m_asteroids[i].pos, m_targets[i].radius + m_targets[i].delta.Length(), static_cast<uint32_t>(i));
+        m_grid.QueryCircles(m_sweepCenters.data(), m_sweepRadii.data(), 0.0f, m_sweepCenters.size(), m_hits);
+
+        // 候補の組ごとに最初に触れる時刻を一括で解く（速い弾が小さい小惑星を素通りしない）
+        m_sweepPairs.clear();
+        for (const auto& h : m_hits) m_sweepPairs.push_back({ h.query, h.user });
+        m_sweepHits.resize(m_sweepPairs.size());
+        Physics::TimeOfImpact(m_movers.data(), m_targets.data(), m_sweepPairs.data(), m_sweepPairs.size(),
+            world, m_sweepHits.data());
+
+        // 弾 vs 小惑星: 各弾は、まだ壊れていない小惑星のうち輪郭に最初に触れたものを壊す
+        m_destroyed.assign(m_asteroids.size(), 0);
+        for (size_t h = 0; h < m_hits.size();) {
+            const uint32_t q = m_hits[h].query;
+            uint32_t target = ~0u;
+            float first = 1.0f;
+            for (; h < m_hits.size() && m_hits[h].query == q; ++h) {
+                const uint32_t i = m_hits[h].user;
+                // 外接円に触れる時刻は輪郭に触れる時刻以前なので、それが今の最初より遅ければ見なくてよい
+                if (m_destroyed[i] || m_sweepHits[h].t > first) continue;
+                // 小惑星から見た弾の相対移動を、終点の姿勢の輪郭と線分で判定する（1 ステップ内の回転は無視）
+                const Asteroid& a = m_asteroids[i];
+                const Vector2 from = a.pos + Physics::WrapDelta(m_movers[q].pos + m_targets[i].delta - a.pos, world);
+                const Vector2 to = from + m_movers[q].delta - m_targets[i].delta;
+                float t;
+                if (Physics::SegmentCast(a.shape, Physics::Transform::Make(a.pos, a.angle), from, to, t) && t <= first) {
+                    first = t;
+                    target = i;
                 }
             }
+            if (target == ~0u) continue;
+            m_destroyed[target] = 1;
+            m_bullets.DestroyDeferred(m_bullets.HandleAt(q));   // q は弾の密な添字（Flush まで変わらない）
         }
-        eraseDead(m_bullets, [](const Bullet& b) { return b.life <= 0.0f; });
+        // 後ろから割る（splitAsteroid は erase して末尾に足すので、前の添字はずれない）
+        for (size_t i = m_asteroids.size(); i-- > 0;)
+            if (m_destroyed[i]) splitAsteroid(i);
+        m_bullets.FlushDeferred();
 
-        // 自機 vs 小惑星
+        // 自機 vs 小惑星（1 対 N なので割った後の一覧をそのまま見る）。輪郭どうしで判定し、
+        // 小惑星は自機に最も近い像に置く（画面端の巻き戻し込み）
         if (m_ship.alive && m_ship.invuln <= 0.0f) {
+            const Physics::Transform xs = Physics::Transform::Make(m_ship.pos, m_ship.angle);
             for (auto& a : m_asteroids) {
-                if (dist(m_ship.pos, a.pos) < a.radius + 12.0f) { killShip(); break; }
+                const Vector2 pos = m_ship.pos + Physics::WrapDelta(a.pos - m_ship.pos, world);
+                if (Physics::Overlap(m_shipShape, xs, a.shape, Physics::Transform::Make(pos, a.angle))) { killShip(); break; }
             }
         }
     }
@@ -260,28 +354,23 @@ private:
         // 無敵中は点滅
         if (m_ship.invuln > 0.0f && std::fmod(m_time, 0.2f) < 0.1f) return;
         Color c{ 0.4f, 0.95f, 1.0f, 1.0f };
-        Vector2 p0 = m_ship.pos + rotate({ 18.0f, 0.0f }, m_ship.angle);
-        Vector2 p1 = m_ship.pos + rotate({ -12.0f, 11.0f }, m_ship.angle);
-        Vector2 p2 = m_ship.pos + rotate({ -6.0f, 0.0f }, m_ship.angle);
-        Vector2 p3 = m_ship.pos + rotate({ -12.0f, -11.0f }, m_ship.angle);
-        b->AddLine(p0, p1, c, 2.5f, 1.5f);
-        b->AddLine(p1, p2, c, 2.5f, 1.5f);
-        b->AddLine(p2, p3, c, 2.5f, 1.5f);
-        b->AddLine(p3, p0, c, 2.5f, 1.5f);
+        Vector2 p[4];
+        Vector2Batch::Transform(kShipHull, p, 4, m_ship.pos, m_ship.angle);
+        b->AddLine(p[0], p[1], c, 2.5f, 1.5f);
+        b->AddLine(p[1], p[2], c, 2.5f, 1.5f);
+        b->AddLine(p[2], p[3], c, 2.5f, 1.5f);
+        b->AddLine(p[3], p[0], c, 2.5f, 1.5f);
     }
     void drawAsteroids(LineBatcher* b)
     {
         Color c{ 0.75f, 0.85f, 1.0f, 1.0f };
         for (const auto& a : m_asteroids) {
-            const int n = (int)a.shape.size();
-            const float step = kTwoPi / n;
-            Vector2 prev{};
-            for (int i = 0; i <= n; ++i) {
-                float ang = a.angle + step * (i % n);
-                Vector2 pt = a.pos + fromAngle(ang) * (a.radius * a.shape[i % n]);
-                if (i > 0) b->AddLine(prev, pt, c, 2.0f, 1.2f);
-                prev = pt;
-            }
+            // 輪郭を一括で回転・平行移動してから閉じた折れ線として描く
+            const size_t n = a.outline.size();
+            m_outlineWork.resize(n);
+            Vector2Batch::Transform(a.outline.data(), m_outlineWork.data(), n, a.pos, a.angle);
+            for (size_t i = 0; i < n; ++i)
+                b->AddLine(m_outlineWork[i], m_outlineWork[(i + 1) % n], c, 2.0f, 1.2f);
         }
     }
     void drawBullets(LineBatcher* b)
@@ -295,7 +384,7 @@ private:
     }
     void drawHud(LineBatcher* b)
     {
-        Color c{ 0.5f, 1.0f, 0.9f, 1.0f };
+        const PaletteIndex c = kPalHud;
         // スコア（右上・7セグ風）
         drawNumber(b, m_score, g_W - 30.0f, 24.0f, 22.0f, 36.0f, 6.0f, c);
         // 残機（左上・小さな自機アイコン）
@@ -306,11 +395,11 @@ private:
             b->AddLine(o + Vector2{ 9,9 }, o + Vector2{ 0,-12 }, c, 2.0f, 1.2f);
         }
         // ウェーブ表示（下）
-        drawNumber(b, m_wave, 52.0f, (float)g_H - 40.0f, 14.0f, 22.0f, 4.0f, Color{ 0.4f,0.7f,1.0f,0.8f });
+        drawNumber(b, m_wave, 52.0f, (float)g_H - 40.0f, 14.0f, 22.0f, 4.0f, kPalWave);
 
         if (m_gameOver) {
             // 中央に大きく X 印っぽいバツ＋スコアで「終了」を示す（フォント無しの割り切り）
-            Color r{ 1.0f, 0.35f, 0.45f, 1.0f };
+            const PaletteIndex r = kPalGameOver;
             float cx = g_W / 2.0f, cy = g_H / 2.0f;
             b->AddLine({ cx - 60, cy - 60 }, { cx + 60, cy + 60 }, r, 4.0f, 2.0f);
             b->AddLine({ cx + 60, cy - 60 }, { cx - 60, cy + 60 }, r, 4.0f, 2.0f);
@@ -319,7 +408,7 @@ private:
     }
 
     // 7 セグメント数字（フォント代わり）。x は右端、右詰めで描く。
-    void drawDigit(LineBatcher* b, int d, float x, float y, float w, float h, const Color& c)
+    void drawDigit(LineBatcher* b, int d, float x, float y, float w, float h, PaletteIndex c)
     {
         // segs: a b c d e f g
         static const bool tbl[10][7] = {
@@ -339,7 +428,7 @@ private:
         if (s[5]) b->AddLine({ x0,y0 }, { x0,ym }, c, th, gl);
         if (s[6]) b->AddLine({ x0,ym }, { x1,ym }, c, th, gl);
     }
-    void drawNumber(LineBatcher* b, int value, float rightX, float y, float w, float h, float gap, const Color& c)
+    void drawNumber(LineBatcher* b, int value, float rightX, float y, float w, float h, float gap, PaletteIndex c)
     {
         if (value < 0) value = 0;
         float x = rightX - w;
@@ -351,23 +440,30 @@ private:
         } while (v > 0);
     }
 
-    template<class T, class Pred>
-    static void eraseDead(std::vector<T>& v, Pred dead)
-    {
-        size_t w = 0;
-        for (size_t r = 0; r < v.size(); ++r) if (!dead(v[r])) v[w++] = v[r];
-        v.resize(w);
-    }
     float randf(float lo, float hi) { std::uniform_real_distribution<float> d(lo, hi); return d(m_rng); }
 
 private:
     std::unique_ptr<Effects::BloomEffect> m_bloom;
+    ColorPalette m_palette;
     Effects::ParticleSystem m_particles;
     Effects::Trail m_trail{ 24 };
     Ship m_ship;
-    std::vector<Bullet> m_bullets;
+    Pool<Bullet> m_bullets;   // 生成・破棄が多いのでプールで使い回す
     std::vector<Asteroid> m_asteroids;
+    std::vector<Vector2> m_outlineWork;   // drawAsteroids の作業領域
+    Physics::UniformGrid m_grid{ 64.0f };
+    Physics::PolygonShape m_shipShape{ kShipHull, 4 };
+    // checkCollisions の作業領域
+    std::vector<Physics::MovingCircle> m_movers, m_targets;
+    std::vector<Vector2> m_sweepCenters;
+    std::vector<float> m_sweepRadii;
+    std::vector<Physics::OverlapHit> m_hits;
+    std::vector<Physics::SweepPair> m_sweepPairs;
+    std::vector<Physics::SweepHit> m_sweepHits;
+    std::vector<uint8_t> m_destroyed;
     std::mt19937 m_rng;
+    SystemScheduler m_systems{ GetJobSystem() };
+    std::vector<uint32_t> m_gameplaySystems;   // ゲームオーバー中は止めるシステム
 
     int m_score = 0, m_lives = 3, m_wave = 0;
     bool m_gameOver = false;
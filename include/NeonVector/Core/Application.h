@@ -11,6 +11,7 @@ namespace NeonVector
 
     // 前方宣言
     class DX12Context;
+    class JobSystem;
 
 
     namespace Graphics {
@@ -29,6 +30,8 @@ namespace NeonVector
         int height = 600;
         bool vsync = true;
         bool fullscreen = false;
+        /** @brief JobSystem のスレッドごとのジョブの枠の数（1 枠 128 バイト） */
+        size_t jobSlotsPerThread = 1024;
     };
 
     /**
@@ -81,6 +84,13 @@ namespace NeonVector
 
         Graphics::LineBatcher* GetLineBatcher() const;
 
+        /**
+         * @brief エンジン共有のジョブシステム（パーティクル・システム実行などの並列処理はこれを使う）
+         *
+         * コンストラクタで作られ、Application を作ったスレッドが 0 番として参加する。
+         */
+        JobSystem* GetJobSystem() const { return m_jobs.get(); }
+
         /**
          * @brief D3D12デバイスを取得
          */
@@ -108,6 +118,7 @@ namespace NeonVector
 
     protected:
         ApplicationConfig m_config;
+        std::unique_ptr<JobSystem> m_jobs;
         std::unique_ptr<DX12Context> m_context;
         HWND m_hwnd;
         bool m_isRunning;
@@ -0,0 +1,421 @@
+/**
+ * @file Ecs.h
+ * @brief アーキタイプ（コンポーネントの組み合わせ）ごとに SoA のチャンクへ詰めるエンティティ格納
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace NeonVector
+{
+    namespace Ecs
+    {
+
+        /** @brief エンティティの識別子（削除後の再利用を generation で見分ける） */
+        struct Entity
+        {
+            uint32_t index = ~0u;
+            uint32_t generation = 0;
+
+            bool IsValid() const { return index != ~0u; }
+            bool operator==(const Entity &o) const { return index == o.index && generation == o.generation; }
+            bool operator!=(const Entity &o) const { return !(*this == o); }
+        };
+
+        using ComponentId = uint32_t;
+        using ComponentMask = uint64_t;
+
+        /** @brief 登録できるコンポーネントの型の数（アーキタイプは 64bit のマスクで表す） */
+        constexpr ComponentId kMaxComponents = 64;
+
+        /** @brief 型を消したコンポーネントの扱い方（チャンク間の移動と破棄） */
+        struct ComponentInfo
+        {
+            size_t size;
+            size_t align;
+            void (*relocate)(void *dst, void *src); // dst へムーブ構築し、src を破棄
+            void (*destroy)(void *p);
+
+            template <class T>
+            static ComponentInfo Of()
+            {
+                return {sizeof(T), alignof(T),
+                        [](void *dst, void *src)
+                        {
+                            T *s = static_cast<T *>(src);
+                            ::new (dst) T(std::move(*s));
+                            s->~T();
+                        },
+                        [](void *p) { static_cast<T *>(p)->~T(); }};
+            }
+        };
+
+        namespace Detail
+        {
+            /** @brief 新しい型に ID を振る（kMaxComponents を超えると std::length_error） */
+            ComponentId RegisterComponent(const ComponentInfo &info);
+            const ComponentInfo &GetComponentInfo(ComponentId id);
+        }
+
+        /** @brief T の ID（最初に使われた順に 0, 1, ... を振る。プロセス内で固定） */
+        template <class T>
+        ComponentId ComponentTypeId()
+        {
+            static const ComponentId id = Detail::RegisterComponent(ComponentInfo::Of<T>());
+            return id;
+        }
+
+        template <class... Ts>
+        ComponentMask MaskOf()
+        {
+            return (ComponentMask(0) | ... | (ComponentMask(1) << ComponentTypeId<std::remove_cv_t<Ts>>()));
+        }
+
+        /**
+         * @class Archetype
+         * @brief 同じコンポーネントの組を持つエンティティの列
+         *
+         * 固定長のチャンク（kChunkBytes）に、エンティティ・各コンポーネントを列ごとに詰めて置く。
+         * 問い合わせは一致したアーキタイプのチャンクを先頭から舐めるだけなので、必要な列だけが
+         * 連続してキャッシュに載る。行を消すときは末尾の行で穴を埋める（順序は保たない）。
+         */
+        class Archetype
+        {
+        public:
+            static constexpr size_t kChunkBytes = 16 * 1024;
+
+            struct Chunk
+            {
+                std::byte *data = nullptr;
+                uint32_t count = 0;
+            };
+
+            explicit Archetype(ComponentMask mask);
+            ~Archetype();
+
+            Archetype(const Archetype &) = delete;
+            Archetype &operator=(const Archetype &) = delete;
+
+            ComponentMask GetMask() const { return m_mask; }
+            bool Has(ComponentId id) const { return (m_mask >> id) & 1; }
+            size_t Count() const { return m_count; }
+            uint32_t GetChunkCapacity() const { return m_capacity; }
+            std::vector<Chunk> &Chunks() { return m_chunks; }
+
+            Entity *Entities(const Chunk &c) const { return reinterpret_cast<Entity *>(c.data); }
+            void *Column(const Chunk &c, ComponentId id) const { return c.data + m_offsets[id]; }
+            template <class T>
+            T *Column(const Chunk &c) const
+            {
+                return static_cast<T *>(Column(c, ComponentTypeId<std::remove_cv_t<T>>()));
+            }
+
+        private:
+            friend class World;
+
+            /** @brief 末尾に 1 行確保する（コンポーネントは未構築） */
+            void allocateRow(Entity e, uint32_t &chunk, uint32_t &row);
+            /**
+             * @brief 構築済みでない行を、末尾の行を移して埋める
+             * @return 移ってきたエンティティ（移さなかったら無効値）
+             */
+            Entity fillHole(uint32_t chunk, uint32_t row);
+            void destroyRow(uint32_t chunk, uint32_t row);
+            void clear();
+
+        private:
+            ComponentMask m_mask;
+            std::vector<ComponentId> m_ids;
+            uint32_t m_offsets[kMaxComponents] = {};
+            uint32_t m_capacity = 0;
+            size_t m_chunkBytes = kChunkBytes;
+            std::vector<Chunk> m_chunks; // 末尾以外は常に満杯
+            std::byte *m_spare = nullptr; // 空になって外したチャンク（次に確保するとき使う）
+            size_t m_count = 0;
+            // 1 つ足す / 除いた先のアーキタイプ（構造変更のたびにハッシュを引かない）
+            Archetype *m_addEdges[kMaxComponents] = {};
+            Archetype *m_removeEdges[kMaxComponents] = {};
+        };
+
+        class World;
+
+        /**
+         * @class CommandBuffer
+         * @brief 構造変更（生成・削除・コンポーネントの追加/除去）を溜めておき、後でまとめて適用する
+         *
+         * Each の中ではアーキタイプ間の移動が起きると列が動いてしまうので、変更はここに積んで
+         * 反復の後に World::Playback で適用する。積んだ順に適用される。
+         * 生成したエンティティは Playback まで存在しないので、その場では Entity を返さない。
+         */
+        class CommandBuffer
+        {
+        public:
+            CommandBuffer() = default;
+            ~CommandBuffer() { Clear(); }
+
+            CommandBuffer(const CommandBuffer &) = delete;
+            CommandBuffer &operator=(const CommandBuffer &) = delete;
+
+            template <class... Ts>
+            void Create(Ts &&...components);
+            void Destroy(Entity e);
+            template <class T>
+            void Add(Entity e, T &&component);
+            template <class T>
+            void Remove(Entity e);
+
+            bool Empty() const { return m_commands.empty(); }
+            size_t Size() const { return m_commands.size(); }
+            /** @brief 適用せずに捨てる */
+            void Clear();
+
+        private:
+            friend class World;
+
+            struct Command
+            {
+                void (*apply)(World &w, void *payload);
+                void (*discard)(void *payload);
+                void *payload;
+            };
+
+            template <class P, class... Args>
+            P *emplace(void (*apply)(World &, void *), Args &&...args);
+            void *allocate(size_t size, size_t align);
+
+        private:
+            static constexpr size_t kBlockBytes = 4096;
+            std::vector<Command> m_commands;
+            // 引数の置き場。ブロック単位で確保し、伸ばしても既存の引数は動かさない
+            std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+            size_t m_blockUsed = kBlockBytes;
+            size_t m_blockSize = kBlockBytes;
+        };
+
+        /**
+         * @class World
+         * @brief エンティティとコンポーネントの格納庫
+         *
+         * エンティティの位置（アーキタイプ・チャンク・行）は添字の表で引き、Entity の generation が
+         * 合わないもの（削除済み）への操作は無視する。コンポーネントは 1 エンティティに各型 1 つ。
+         * 問い合わせ Each / EachChunk の実行中に構造を変えてはならない（CommandBuffer を使う）。
+         */
+        class World
+        {
+        public:
+            World() = default;
+            ~World() = default;
+
+            World(const World &) = delete;
+            World &operator=(const World &) = delete;
+
+            /** @brief components の型の組のアーキタイプに生成する（同じ型を 2 つ渡さないこと） */
+            template <class... Ts>
+            Entity Create(Ts &&...components);
+            void Destroy(Entity e);
+            bool IsAlive(Entity e) const;
+
+            /** @brief 既に持っていれば上書き */
+            template <class T>
+            void Add(Entity e, T &&component);
+            template <class T>
+            void Remove(Entity e);
+            /** @brief 持っていない・削除済みなら nullptr */
+            template <class T>
+            T *Get(Entity e);
+            template <class T>
+            bool Has(Entity e) const;
+
+            size_t Count() const { return m_count; }
+            size_t ArchetypeCount() const { return m_archetypes.size(); }
+            void Clear();
+
+            /**
+             * @brief Ts を全て持つエンティティごとに fn(Ts&...) または fn(Entity, Ts&...) を呼ぶ
+             *
+             * const を付けた型は読むだけの列として渡る。
+             */
+            template <class... Ts, class Fn>
+            void Each(Fn &&fn);
+
+            /**
+             * @brief チャンクごとに fn(count, const Entity*, Ts*...) を呼ぶ
+             *
+             * 列の先頭ポインタをそのまま渡すので、SIMD やループの自動ベクトル化に向く。
+             */
+            template <class... Ts, class Fn>
+            void EachChunk(Fn &&fn);
+
+            void Playback(CommandBuffer &commands);
+
+        private:
+            struct Record
+            {
+                Archetype *archetype = nullptr;
+                uint32_t chunk = 0;
+                uint32_t row = 0;
+                uint32_t generation = 0;
+            };
+
+            struct QueryCache
+            {
+                std::vector<Archetype *> archetypes;
+                size_t scanned = 0; // m_archetypes のうち調べ終えた数
+            };
+
+            Entity allocateEntity();
+            const Record *find(Entity e) const;
+            Archetype *getArchetype(ComponentMask mask);
+            Archetype *withComponent(Archetype *from, ComponentId id);
+            Archetype *withoutComponent(Archetype *from, ComponentId id);
+            /** @brief 移し先へ共通の列をムーブし、移し先に無い列は破棄する。元の行は詰める */
+            void moveEntity(Entity e, Record &r, Archetype *to);
+            void fixMoved(Entity moved, uint32_t chunk, uint32_t row);
+            const std::vector<Archetype *> &matching(ComponentMask mask);
+
+        private:
+            std::vector<std::unique_ptr<Archetype>> m_archetypes;
+            std::unordered_map<ComponentMask, Archetype *> m_byMask;
+            std::unordered_map<ComponentMask, QueryCache> m_queries;
+            std::vector<Record> m_records;
+            std::vector<uint32_t> m_free;
+            size_t m_count = 0;
+        };
+
+        // ---- World ----
+
+        template <class... Ts>
+        Entity World::Create(Ts &&...components)
+        {
+            const Entity e = allocateEntity();
+            Archetype *a = getArchetype(MaskOf<std::decay_t<Ts>...>());
+            Record &r = m_records[e.index];
+            r.archetype = a;
+            a->allocateRow(e, r.chunk, r.row);
+            const Archetype::Chunk &c = a->m_chunks[r.chunk];
+            (::new (a->Column<std::decay_t<Ts>>(c) + r.row) std::decay_t<Ts>(std::forward<Ts>(components)), ...);
+            ++m_count;
+            return e;
+        }
+
+        template <class T>
+        void World::Add(Entity e, T &&component)
+        {
+            using U = std::decay_t<T>;
+            if (!find(e))
+                return;
+            Record &r = m_records[e.index];
+            const ComponentId id = ComponentTypeId<U>();
+            if (r.archetype->Has(id))
+            {
+                r.archetype->Column<U>(r.archetype->m_chunks[r.chunk])[r.row] = std::forward<T>(component);
+                return;
+            }
+            moveEntity(e, r, withComponent(r.archetype, id));
+            ::new (r.archetype->Column<U>(r.archetype->m_chunks[r.chunk]) + r.row) U(std::forward<T>(component));
+        }
+
+        template <class T>
+        void World::Remove(Entity e)
+        {
+            if (!find(e))
+                return;
+            Record &r = m_records[e.index];
+            const ComponentId id = ComponentTypeId<std::remove_cv_t<T>>();
+            if (r.archetype->Has(id))
+                moveEntity(e, r, withoutComponent(r.archetype, id));
+        }
+
+        template <class T>
+        T *World::Get(Entity e)
+        {
+            const Record *r = find(e);
+            if (!r || !r->archetype->Has(ComponentTypeId<std::remove_cv_t<T>>()))
+                return nullptr;
+            return r->archetype->Column<T>(r->archetype->m_chunks[r->chunk]) + r->row;
+        }
+
+        template <class T>
+        bool World::Has(Entity e) const
+        {
+            const Record *r = find(e);
+            return r && r->archetype->Has(ComponentTypeId<std::remove_cv_t<T>>());
+        }
+
+        template <class... Ts, class Fn>
+        void World::EachChunk(Fn &&fn)
+        {
+            for (Archetype *a : matching(MaskOf<Ts...>()))
+            {
+                for (const Archetype::Chunk &c : a->Chunks())
+                {
+                    if (c.count)
+                        fn(static_cast<size_t>(c.count), static_cast<const Entity *>(a->Entities(c)), a->Column<Ts>(c)...);
+                }
+            }
+        }
+
+        template <class... Ts, class Fn>
+        void World::Each(Fn &&fn)
+        {
+            EachChunk<Ts...>([&fn](size_t count, const Entity *entities, Ts *...columns)
+                             {
+                                 for (size_t i = 0; i < count; ++i)
+                                 {
+                                     if constexpr (std::is_invocable_v<Fn &, Entity, Ts &...>)
+                                         fn(entities[i], columns[i]...);
+                                     else
+                                         fn(columns[i]...);
+                                 } });
+        }
+
+        // ---- CommandBuffer ----
+
+        template <class P, class... Args>
+        P *CommandBuffer::emplace(void (*apply)(World &, void *), Args &&...args)
+        {
+            P *p = ::new (allocate(sizeof(P), alignof(P))) P{std::forward<Args>(args)...};
+            m_commands.push_back({apply, [](void *q) { static_cast<P *>(q)->~P(); }, p});
+            return p;
+        }
+
+        template <class... Ts>
+        void CommandBuffer::Create(Ts &&...components)
+        {
+            using P = std::tuple<std::decay_t<Ts>...>;
+            emplace<P>([](World &w, void *q)
+                       { std::apply([&w](auto &...c) { w.Create(std::move(c)...); }, *static_cast<P *>(q)); },
+                       std::forward<Ts>(components)...);
+        }
+
+        template <class T>
+        void CommandBuffer::Add(Entity e, T &&component)
+        {
+            struct P
+            {
+                Entity e;
+                std::decay_t<T> value;
+            };
+            emplace<P>([](World &w, void *q)
+                       {
+                           P *p = static_cast<P *>(q);
+                           w.Add(p->e, std::move(p->value)); },
+                       e, std::forward<T>(component));
+        }
+
+        template <class T>
+        void CommandBuffer::Remove(Entity e)
+        {
+            emplace<Entity>([](World &w, void *q) { w.Remove<T>(*static_cast<Entity *>(q)); }, e);
+        }
+
+    } // namespace Ecs
+} // namespace NeonVector
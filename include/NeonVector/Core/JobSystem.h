@@ -0,0 +1,193 @@
+/**
+ * @file JobSystem.h
+ * @brief ワーカーごとの Chase-Lev デックで仕事を盗み合うジョブシステム（エンジン共有の並列処理）
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace NeonVector
+{
+
+    /**
+     * @class JobCounter
+     * @brief 未完了のジョブ数。Spawn で増え、ジョブが終わると減る。JobSystem::Wait で 0 を待つ
+     *
+     * ジョブの中で別のカウンタに子ジョブを積んで Wait すれば、親子の依存になる。
+     */
+    class JobCounter
+    {
+    public:
+        bool IsDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+        std::atomic<uint32_t> m_pending{0};
+    };
+
+    /**
+     * @class JobSystem
+     * @brief 常駐ワーカーとジョブを盗み合う並列実行
+     *
+     * 各ワーカー（作ったスレッドを 0 番とし、ワーカーは 1 番から）は自分のデックの底に積み・底から取り、
+     * 手が空くと他のデックの頭から盗む。積んだ側は LIFO で温かいデータから片付け、盗む側は
+     * 大きな仕事（再帰分割の上の方）を持っていく。待つ側（Wait）も仕事を取って進めるので、
+     * ジョブの中で Spawn / Wait / ParallelFor を入れ子にしてよい。
+     *
+     * ジョブは関数オブジェクトをスレッドごとの固定数の枠にコピーして積む（ヒープ確保なし）。
+     * 枠やデックが埋まっているときは、積まずにその場で実行する。JobSystem に属さないスレッドからの
+     * Spawn もその場で実行する。
+     *
+     * 作ったスレッドは 0 番として属する。既に別の JobSystem に属するスレッドで作った場合は、
+     * 破棄するまで新しい方に属し、破棄すると元の JobSystem の番号に戻る（入れ子の寿命に限る）。
+     */
+    class JobSystem
+    {
+    public:
+        /** @brief ジョブに持たせられる関数オブジェクトの大きさ */
+        static constexpr size_t kJobPayloadBytes = 48;
+        /** @brief スレッドごとのジョブの枠の既定数（1 枠 128 バイト） */
+        static constexpr size_t kDefaultJobSlots = 1024;
+
+        /**
+         * @param workerCount 作ったスレッド以外のワーカー数（既定: 論理コア数 - 1）
+         * @param jobSlots スレッドごとに同時に積んでおけるジョブ数（2 の冪に切り上げる）。
+         *                 溢れた分はその場で実行されるだけなので、足りなくても結果は変わらない
+         */
+        explicit JobSystem(unsigned workerCount = DefaultWorkerCount(), size_t jobSlots = kDefaultJobSlots);
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        /** @brief 処理に参加するスレッド数（ワーカー + 作ったスレッド） */
+        unsigned GetThreadCount() const { return static_cast<unsigned>(m_workers.size()) + 1; }
+
+        /** @brief 呼び出しスレッドの番号（0 = 作ったスレッド。属さないスレッドは ~0u） */
+        unsigned GetWorkerIndex() const;
+
+        /**
+         * @brief fn() をジョブとして積む（counter は fn が終わると 1 減る）
+         *
+         * fn はトリビアルにコピー・破棄できる kJobPayloadBytes 以下の関数オブジェクト
+         * （参照やポインタをキャプチャしたラムダ）に限る。
+         */
+        template <class Fn>
+        void Spawn(JobCounter &counter, Fn &&fn)
+        {
+            using FnType = std::decay_t<Fn>;
+            static_assert(sizeof(FnType) <= kJobPayloadBytes, "ジョブの関数オブジェクトが大きすぎる");
+            static_assert(std::is_trivially_copyable_v<FnType> && std::is_trivially_destructible_v<FnType>,
+                          "ジョブの関数オブジェクトはトリビアルにコピーできること（参照でキャプチャする）");
+            counter.m_pending.fetch_add(1, std::memory_order_relaxed);
+            Job *job = allocateJob();
+            if (!job)
+            {
+                fn();
+                finish(counter);
+                return;
+            }
+            job->run = [](const void *payload)
+            { (*static_cast<const FnType *>(payload))(); };
+            job->counter = &counter;
+            std::memcpy(job->payload, static_cast<const void *>(std::addressof(fn)), sizeof(FnType));
+            push(job);
+        }
+
+        /** @brief counter が 0 になるまで、他のジョブを実行しながら待つ */
+        void Wait(JobCounter &counter);
+
+        /**
+         * @brief [0, count) を grain 個ずつのチャンクに分け、fn(begin, end) を並列に呼んで全て待つ
+         *
+         * fn は常に 1 チャンク（[k * grain, min(count, (k + 1) * grain))）ずつ呼ぶ。チャンクの境界は
+         * grain だけで決まり、スレッド数には依存しない。範囲を二分しながら積むので、盗んだ側は
+         * 大きな塊を持っていく。チャンクが 1 つ・ワーカーがいない・JobSystem に属さないスレッドから
+         * 呼んだときは、呼び出しスレッドで全チャンクを順に呼ぶ。
+         */
+        template <class Fn>
+        void ParallelFor(size_t count, size_t grain, Fn &&fn)
+        {
+            using FnType = std::remove_reference_t<Fn>;
+            parallelFor(count, grain,
+                        [](void *ctx, size_t begin, size_t end)
+                        { (*static_cast<FnType *>(ctx))(begin, end); },
+                        const_cast<void *>(static_cast<const void *>(std::addressof(fn))));
+        }
+
+        static unsigned DefaultWorkerCount();
+
+    private:
+        using RangeFn = void (*)(void *ctx, size_t begin, size_t end);
+
+        struct alignas(64) Job
+        {
+            void (*run)(const void *payload);
+            JobCounter *counter;
+            std::atomic<bool> busy{false}; // 積まれてから実行し終えるまで（枠の使い回し判定）
+            alignas(16) unsigned char payload[kJobPayloadBytes];
+        };
+
+        /** @brief 固定容量（2 の冪）の Chase-Lev デック（持ち主は底、盗む側は頭を触る） */
+        class Deque
+        {
+        public:
+            explicit Deque(size_t capacity);
+
+            bool Push(Job *job);
+            Job *Pop();
+            Job *Steal();
+
+        private:
+            alignas(64) std::atomic<int64_t> m_top{0};
+            alignas(64) std::atomic<int64_t> m_bottom{0};
+            std::unique_ptr<std::atomic<Job *>[]> m_buffer;
+            int64_t m_mask;
+        };
+
+        /** @brief ワーカー 1 人分（デックと、積むジョブの枠。どちらも同じ数） */
+        struct Worker
+        {
+            explicit Worker(size_t slots) : deque(slots), jobs(new Job[slots]), jobMask(slots - 1) {}
+
+            Deque deque;
+            std::unique_ptr<Job[]> jobs;
+            size_t jobMask;
+            size_t nextJob = 0;
+            uint32_t rng = 0;
+        };
+
+        Job *allocateJob();
+        void push(Job *job);
+        Job *findJob(unsigned self);
+        void execute(Job *job);
+        static void finish(JobCounter &counter);
+        void workerLoop(unsigned index);
+        void parallelFor(size_t count, size_t grain, RangeFn fn, void *ctx);
+
+    private:
+        std::vector<std::unique_ptr<Worker>> m_slots; // 0 = 作ったスレッド
+        std::vector<std::thread> m_workers;
+
+        std::atomic<size_t> m_queued{0};   // デックに積まれて、まだ誰も取っていない数
+        std::atomic<unsigned> m_sleeping{0};
+        std::atomic<bool> m_stop{false};
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+
+        // 作ったスレッドが以前に属していた JobSystem（入れ子に作った場合。破棄で戻す）
+        const JobSystem *m_prevSystem = nullptr;
+        unsigned m_prevIndex = ~0u;
+    };
+
+} // namespace NeonVector
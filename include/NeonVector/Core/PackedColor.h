@@ -0,0 +1,269 @@
+/**
+ * @file PackedColor.h
+ * @brief 詰めた色形式（RGBA8 / half × 4）、色空間変換、パレット
+ */
+#pragma once
+
+#include <NeonVector/Core/Types.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace NeonVector
+{
+
+    /**
+     * @struct ColorRGBA8
+     * @brief 8bit × 4 の色（4 バイト。メモリ上の並びは DXGI_FORMAT_R8G8B8A8_UNORM と同じ）
+     *
+     * Color（float × 4, 16 バイト）の 1/4 の大きさで、頂点・粒子など数の多いデータに使う。
+     * 各成分は 0..1 に丸めて 255 段階で持つ（1 を超える値は ColorHalf4 を使う）。
+     * 4 つの数値から作るときは FromBytes / FromFloats（Color と取り違えないよう、
+     * 成分を並べるコンストラクタは持たない）。
+     */
+    struct ColorRGBA8
+    {
+        uint8_t r, g, b, a;
+
+        constexpr ColorRGBA8() : r(255), g(255), b(255), a(255) {}
+
+        static constexpr ColorRGBA8 FromBytes(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255)
+        {
+            ColorRGBA8 c;
+            c.r = r;
+            c.g = g;
+            c.b = b;
+            c.a = a;
+            return c;
+        }
+
+        /** @brief 0..1 → 0..255（範囲外は丸め、NaN は 0） */
+        static uint8_t ToUnorm8(float v)
+        {
+            v = (v > 0.0f) ? v : 0.0f;
+            v = (v < 1.0f) ? v : 1.0f;
+            return static_cast<uint8_t>(v * 255.0f + 0.5f);
+        }
+
+        static ColorRGBA8 FromFloats(float r, float g, float b, float a = 1.0f)
+        {
+            return FromBytes(ToUnorm8(r), ToUnorm8(g), ToUnorm8(b), ToUnorm8(a));
+        }
+
+        static ColorRGBA8 FromColor(const Color &c) { return FromFloats(c.r, c.g, c.b, c.a); }
+
+        Color ToColor() const
+        {
+            constexpr float k = 1.0f / 255.0f;
+            return {r * k, g * k, b * k, a * k};
+        }
+
+        /** @brief R が最下位バイトの 32bit 値との相互変換 */
+        static constexpr ColorRGBA8 FromPacked(uint32_t v)
+        {
+            return FromBytes(static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8),
+                             static_cast<uint8_t>(v >> 16), static_cast<uint8_t>(v >> 24));
+        }
+
+        constexpr uint32_t Packed() const
+        {
+            return uint32_t(r) | (uint32_t(g) << 8) | (uint32_t(b) << 16) | (uint32_t(a) << 24);
+        }
+
+        /** @brief α だけを scale 倍したもの（フェード用。RGB はそのまま） */
+        ColorRGBA8 WithAlphaScaled(float scale) const
+        {
+            ColorRGBA8 c = *this;
+            c.a = ToUnorm8(a * (1.0f / 255.0f) * scale);
+            return c;
+        }
+
+        constexpr bool operator==(const ColorRGBA8 &o) const { return Packed() == o.Packed(); }
+        constexpr bool operator!=(const ColorRGBA8 &o) const { return Packed() != o.Packed(); }
+    };
+
+    static_assert(sizeof(ColorRGBA8) == 4, "ColorRGBA8 は 4 バイトであること");
+
+    /**
+     * @struct ColorHalf4
+     * @brief 半精度 float × 4 の色（8 バイト。DXGI_FORMAT_R16G16B16A16_FLOAT と同じ並び）
+     *
+     * 1 を超える HDR の色（bloom に流す強い発光など）を Color の半分の大きさで持つ。
+     * 有効桁は 11bit（相対誤差 2^-11 以内）、最大 65504。
+     */
+    struct ColorHalf4
+    {
+        uint16_t r, g, b, a;
+
+        constexpr ColorHalf4() : r(0x3C00), g(0x3C00), b(0x3C00), a(0x3C00) {}
+
+        /** @brief float → half（最近接偶数丸め。範囲外は ±inf、NaN は NaN） */
+        static uint16_t FloatToHalf(float f)
+        {
+            uint32_t u;
+            std::memcpy(&u, &f, sizeof(u));
+            const uint32_t sign = u & 0x80000000u;
+            u ^= sign;
+
+            uint32_t h;
+            if (u >= 0x47800000u)
+            {
+                h = (u > 0x7F800000u) ? 0x7E00u : 0x7C00u;   // 65520 以上は inf、NaN は quiet NaN
+            }
+            else if (u < 0x38800000u)
+            {
+                // 非正規化数: 仮数を下位 10bit に揃える定数を足して丸めを FPU に任せる
+                constexpr uint32_t kMagic = 0x3F000000u;
+                float v;
+                std::memcpy(&v, &u, sizeof(v));
+                float m;
+                std::memcpy(&m, &kMagic, sizeof(m));
+                v += m;
+                std::memcpy(&u, &v, sizeof(u));
+                h = u - kMagic;
+            }
+            else
+            {
+                const uint32_t odd = (u >> 13) & 1u;
+                u += 0xC8000FFFu + odd;   // 指数の付け替え（-112 << 23）と偶数丸め
+                h = u >> 13;
+            }
+            return static_cast<uint16_t>(h | (sign >> 16));
+        }
+
+        static float HalfToFloat(uint16_t h)
+        {
+            constexpr uint32_t kShiftedExp = 0x7C00u << 13;
+            uint32_t u = (h & 0x7FFFu) << 13;
+            const uint32_t exp = u & kShiftedExp;
+            u += (127 - 15) << 23;
+            float f;
+            if (exp == kShiftedExp)
+            {
+                u += (128 - 16) << 23;   // inf / NaN
+                std::memcpy(&f, &u, sizeof(f));
+            }
+            else if (exp == 0)
+            {
+                // 0 / 非正規化数: 指数を 1 足してから 2^-14 を引いて正規化し直す
+                u += 1u << 23;
+                std::memcpy(&f, &u, sizeof(f));
+                f -= 6.103515625e-05f;
+            }
+            else
+            {
+                std::memcpy(&f, &u, sizeof(f));
+            }
+            uint32_t bits;
+            std::memcpy(&bits, &f, sizeof(bits));
+            bits |= static_cast<uint32_t>(h & 0x8000u) << 16;
+            std::memcpy(&f, &bits, sizeof(f));
+            return f;
+        }
+
+        static ColorHalf4 FromColor(const Color &c)
+        {
+            ColorHalf4 h;
+            h.r = FloatToHalf(c.r);
+            h.g = FloatToHalf(c.g);
+            h.b = FloatToHalf(c.b);
+            h.a = FloatToHalf(c.a);
+            return h;
+        }
+
+        Color ToColor() const { return {HalfToFloat(r), HalfToFloat(g), HalfToFloat(b), HalfToFloat(a)}; }
+    };
+
+    static_assert(sizeof(ColorHalf4) == 8, "ColorHalf4 は 8 バイトであること");
+
+    /**
+     * @namespace ColorBatch
+     * @brief 色配列の一括変換（結果は 1 色ずつの変換と一致する）
+     *
+     * Simd::Float4 / Int4 で、Pack / Unpack は 4 色ずつ、ToHalf / FromHalf は 2 色ずつ処理する。
+     * sRGB の 2 つは表引きが主で SSE2 に gather が無いため、LinearToSrgb は添字の計算だけを
+     * 1 色分まとめて行い、SrgbToLinear はスカラーのまま。
+     */
+    namespace ColorBatch
+    {
+        void Pack(const Color *in, ColorRGBA8 *out, size_t count);
+        void Unpack(const ColorRGBA8 *in, Color *out, size_t count);
+        void ToHalf(const Color *in, ColorHalf4 *out, size_t count);
+        void FromHalf(const ColorHalf4 *in, Color *out, size_t count);
+        void HalfToRGBA8(const ColorHalf4 *in, ColorRGBA8 *out, size_t count);
+        void RGBA8ToHalf(const ColorRGBA8 *in, ColorHalf4 *out, size_t count);
+
+        /** @brief 線形 → sRGB 8bit（テーブル引き。α は線形のまま 8bit に） */
+        void LinearToSrgb(const Color *in, ColorRGBA8 *out, size_t count);
+
+        /** @brief sRGB 8bit → 線形（256 段のテーブル引きなので厳密値と一致） */
+        void SrgbToLinear(const ColorRGBA8 *in, Color *out, size_t count);
+    }
+
+    /**
+     * @namespace ColorSpace
+     * @brief HSV ↔ RGB、sRGB ↔ 線形
+     *
+     * 色相 h は 1 周 = 1.0（範囲外は巻き戻す）。s, v は 0..1。
+     * 「…RGBA8」版は 8bit の結果を直接返すテーブル経路で、色相を回すネオン演出のように
+     * 頂点ごとに色を作る用途向け。
+     */
+    namespace ColorSpace
+    {
+        Color HsvToRgb(float h, float s, float v, float a = 1.0f);
+        void RgbToHsv(const Color &c, float &h, float &s, float &v);
+
+        /** @brief HSV → RGBA8（色相 1536 段のテーブル。厳密計算との差は各成分 1 段以内） */
+        ColorRGBA8 HsvToRGBA8(float h, float s, float v, float a = 1.0f);
+
+        /** @brief 厳密な sRGB 伝達関数（テーブルを作る元。1 色ずつならこちらでもよい） */
+        float SrgbToLinear(float c);
+        float LinearToSrgb(float c);
+
+        /** @brief 8bit sRGB → 線形（テーブル引き） */
+        float SrgbToLinear(uint8_t c);
+
+        /** @brief 線形 → 8bit sRGB（4096 段のテーブル。厳密な丸めとの差は 1 段以内） */
+        uint8_t LinearToSrgb8(float c);
+    }
+
+    /**
+     * @struct PaletteIndex
+     * @brief ColorPalette の添字（1 バイト）。HUD や背景のように色数が少なく、
+     *        テーマ切り替えや点滅で一斉に色を変えたいものに使う
+     */
+    struct PaletteIndex
+    {
+        uint8_t value;
+    };
+
+    /**
+     * @class ColorPalette
+     * @brief 256 色のパレット
+     *
+     * 描画側は PaletteIndex だけを持ち、色は LineBatcher::SetPalette で渡したパレットから
+     * 頂点を書くときに引く。エントリを書き換えると、次のフレームからその添字を使う全ての線の
+     * 色が変わる。未設定のエントリは白。
+     */
+    class ColorPalette
+    {
+    public:
+        static constexpr size_t kSize = 256;
+
+        void Set(PaletteIndex i, const Color &color) { m_entries[i.value] = ColorRGBA8::FromColor(color); }
+        void Set(PaletteIndex i, ColorRGBA8 color) { m_entries[i.value] = color; }
+        ColorRGBA8 Get(PaletteIndex i) const { return m_entries[i.value]; }
+        ColorRGBA8 operator[](PaletteIndex i) const { return m_entries[i.value]; }
+
+        /** @brief 添字の並びを色の並びに展開する */
+        void Resolve(const PaletteIndex *in, ColorRGBA8 *out, size_t count) const
+        {
+            for (size_t i = 0; i < count; ++i)
+                out[i] = m_entries[in[i].value];
+        }
+
+    private:
+        ColorRGBA8 m_entries[kSize];
+    };
+
+} // namespace NeonVector
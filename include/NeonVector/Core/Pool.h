@@ -0,0 +1,177 @@
+/**
+ * @file Pool.h
+ * @brief 世代付きハンドルで引く、頻繁に生成・破棄するオブジェクトのプール
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace NeonVector
+{
+
+    /** @brief Pool<T> の要素の識別子（破棄後の再利用を generation で見分ける） */
+    template <class T>
+    struct PoolHandle
+    {
+        uint32_t index = ~0u;
+        uint32_t generation = 0;
+
+        bool IsValid() const { return index != ~0u; }
+        bool operator==(const PoolHandle &o) const { return index == o.index && generation == o.generation; }
+        bool operator!=(const PoolHandle &o) const { return !(*this == o); }
+    };
+
+    /**
+     * @class Pool
+     * @brief 生成・破棄が O(1) で、生きている要素を詰めた配列として舐められるプール
+     *
+     * 要素は密な配列に詰めて置き、ハンドルの添字（スロット）から密な位置を引く。
+     * 破棄は末尾の要素を穴へ移すので、要素の順序とアドレスは保たない（ハンドルは変わらない）。
+     * 破棄済みのハンドルは generation が合わないので、Get は nullptr を返し Destroy は何もしない。
+     *
+     * 反復中に Destroy すると詰め替えで要素を飛ばすので、反復中は DestroyDeferred で予約し、
+     * 反復の後（フレームの終わり等）に FlushDeferred でまとめて破棄する。
+     */
+    template <class T>
+    class Pool
+    {
+    public:
+        using Handle = PoolHandle<T>;
+
+        Pool() = default;
+
+        /** @brief 密な配列とスロットを n 個分確保しておく（以後 n 個までは、破棄の予約も含めて確保しない） */
+        void Reserve(size_t n)
+        {
+            m_values.reserve(n);
+            m_owners.reserve(n);
+            m_slots.reserve(n);
+            m_free.reserve(n);
+            m_deferred.reserve(n);
+        }
+
+        /** @brief T(args...) を加える（コンストラクタが例外を投げたら、プールは何も変わらない） */
+        template <class... Args>
+        Handle Create(Args &&...args)
+        {
+            m_values.emplace_back(std::forward<Args>(args)...);
+            uint32_t index;
+            if (!m_free.empty())
+            {
+                index = m_free.back();
+                m_free.pop_back();
+            }
+            else
+            {
+                index = static_cast<uint32_t>(m_slots.size());
+                m_slots.emplace_back();
+            }
+            Slot &s = m_slots[index];
+            s.dense = static_cast<uint32_t>(m_values.size() - 1);
+            s.pending = false;
+            m_owners.push_back(index);
+            return {index, s.generation};
+        }
+
+        /** @brief すぐに破棄する（末尾の要素が穴へ移る） */
+        void Destroy(Handle h)
+        {
+            if (!find(h))
+                return;
+            Slot &s = m_slots[h.index];
+            const uint32_t last = static_cast<uint32_t>(m_values.size() - 1);
+            if (s.dense != last)
+            {
+                m_values[s.dense] = std::move(m_values[last]);
+                m_owners[s.dense] = m_owners[last];
+                m_slots[m_owners[s.dense]].dense = s.dense;
+            }
+            m_values.pop_back();
+            m_owners.pop_back();
+            s.dense = kFree;
+            s.pending = false;
+            ++s.generation;
+            m_free.push_back(h.index);
+        }
+
+        /** @brief FlushDeferred まで破棄を遅らせる（それまでは生きている。重ねて予約しても 1 回） */
+        void DestroyDeferred(Handle h)
+        {
+            if (!find(h) || m_slots[h.index].pending)
+                return;
+            m_slots[h.index].pending = true;
+            m_deferred.push_back(h);
+        }
+
+        void FlushDeferred()
+        {
+            for (Handle h : m_deferred)
+                Destroy(h);
+            m_deferred.clear();
+        }
+
+        /** @brief 全て破棄する（発行済みのハンドルは全て無効になる） */
+        void Clear()
+        {
+            for (uint32_t index : m_owners)
+            {
+                Slot &s = m_slots[index];
+                s.dense = kFree;
+                s.pending = false;
+                ++s.generation;
+                m_free.push_back(index);
+            }
+            m_values.clear();
+            m_owners.clear();
+            m_deferred.clear();
+        }
+
+        /** @brief 破棄済みなら nullptr。返すポインタは次の Create / Destroy まで有効 */
+        T *Get(Handle h) { return find(h) ? &m_values[m_slots[h.index].dense] : nullptr; }
+        const T *Get(Handle h) const { return find(h) ? &m_values[m_slots[h.index].dense] : nullptr; }
+        bool IsAlive(Handle h) const { return find(h); }
+        bool IsPendingDestroy(Handle h) const { return find(h) && m_slots[h.index].pending; }
+
+        // ── 密な配列としての参照（添字は Destroy で変わる） ──
+        size_t Size() const { return m_values.size(); }
+        bool Empty() const { return m_values.empty(); }
+        T *Data() { return m_values.data(); }
+        const T *Data() const { return m_values.data(); }
+        T &operator[](size_t i) { return m_values[i]; }
+        const T &operator[](size_t i) const { return m_values[i]; }
+        /** @brief 密な配列の i 番目の要素のハンドル */
+        Handle HandleAt(size_t i) const { return {m_owners[i], m_slots[m_owners[i]].generation}; }
+
+        T *begin() { return m_values.data(); }
+        T *end() { return m_values.data() + m_values.size(); }
+        const T *begin() const { return m_values.data(); }
+        const T *end() const { return m_values.data() + m_values.size(); }
+
+    private:
+        static constexpr uint32_t kFree = ~0u;
+
+        struct Slot
+        {
+            uint32_t dense = kFree; // m_values 内の位置（空きなら kFree）
+            uint32_t generation = 0;
+            bool pending = false;   // DestroyDeferred 済み
+        };
+
+        bool find(Handle h) const
+        {
+            return h.index < m_slots.size() && m_slots[h.index].dense != kFree &&
+                   m_slots[h.index].generation == h.generation;
+        }
+
+    private:
+        std::vector<T> m_values;       // 生きている要素（詰めて置く）
+        std::vector<uint32_t> m_owners; // m_values[i] のスロット
+        std::vector<Slot> m_slots;
+        std::vector<uint32_t> m_free;
+        std::vector<Handle> m_deferred;
+    };
+
+} // namespace NeonVector
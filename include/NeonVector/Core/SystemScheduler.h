@@ -0,0 +1,146 @@
+/**
+ * @file SystemScheduler.h
+ * @brief 読み書きするデータを宣言したシステムを、依存関係の DAG に沿って並列に実行する
+ */
+#pragma once
+
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace NeonVector
+{
+
+    class JobSystem;
+    class JobCounter;
+
+    /** @brief SystemAccess で区別できるデータの型の数 */
+    constexpr uint32_t kMaxAccessTypes = 256;
+
+    namespace Detail
+    {
+        /** @brief 新しい型に ID を振る（kMaxAccessTypes を超えると std::length_error） */
+        uint32_t RegisterAccessType();
+    }
+
+    /** @brief SystemAccess での T の ID（最初に使われた順に振る。ECS のコンポーネント ID とは別） */
+    template <class T>
+    uint32_t AccessTypeId()
+    {
+        static const uint32_t id = Detail::RegisterAccessType();
+        return id;
+    }
+
+    /**
+     * @struct SystemAccess
+     * @brief システムが読む / 書くデータの宣言
+     *
+     * データは型で表す（ECS のコンポーネント、ゲーム側のコンテナ、目印の空の構造体など）。
+     * ID は型を数えるだけの専用の表で振るので、ECS のコンポーネント ID を消費せず、
+     * ムーブできない型も書ける。
+     */
+    struct SystemAccess
+    {
+        using Mask = std::bitset<kMaxAccessTypes>;
+
+        Mask reads;
+        Mask writes;
+
+        template <class... Ts>
+        SystemAccess &Read()
+        {
+            (reads.set(AccessTypeId<std::remove_cv_t<Ts>>()), ...);
+            return *this;
+        }
+        template <class... Ts>
+        SystemAccess &Write()
+        {
+            (writes.set(AccessTypeId<std::remove_cv_t<Ts>>()), ...);
+            return *this;
+        }
+
+        /** @brief 同時に走らせてはいけない組か（どちらかが書くデータを、もう一方が読むか書く） */
+        bool ConflictsWith(const SystemAccess &o) const
+        {
+            return (writes & (o.reads | o.writes)).any() || (o.writes & reads).any();
+        }
+    };
+
+    /** @brief 直前の Run で 1 システムが走った記録（時刻は Run の開始からのマイクロ秒） */
+    struct SystemTraceEvent
+    {
+        uint32_t system;
+        unsigned worker;                // 実行したスレッド（JobSystem::GetWorkerIndex）
+        double beginUs;
+        double endUs;
+        std::vector<uint32_t> after;    // このシステムの前に終わっている必要があったシステム
+    };
+
+    /**
+     * @class SystemScheduler
+     * @brief システムの依存グラフを毎フレーム組み、独立なものを JobSystem で同時に走らせる
+     *
+     * 衝突する（SystemAccess::ConflictsWith）2 つのシステムは、登録の早い方が先に走る。
+     * 衝突しないものの実行順・スレッドは決まらない。宣言が正しければ、結果は登録順に直列に呼んだ場合と同じになる。
+     * グラフは有効なシステムだけで毎フレーム組み直すので、SetEnabled は次の Run から効く。
+     *
+     * 各システムは 1 つのジョブとして走り、終わると先行が揃った後続をジョブとして積む。
+     * システムの中で同じ JobSystem の ParallelFor を使ってよい。
+     */
+    class SystemScheduler
+    {
+    public:
+        using SystemFn = std::function<void(float dt)>;
+
+        /** @param jobs nullptr なら呼び出しスレッドで登録順に走らせる */
+        explicit SystemScheduler(JobSystem *jobs = nullptr);
+
+        uint32_t Add(std::string name, const SystemAccess &access, SystemFn fn);
+        void SetEnabled(uint32_t system, bool enabled);
+        bool IsEnabled(uint32_t system) const { return m_systems[system].enabled; }
+        const std::string &GetName(uint32_t system) const { return m_systems[system].name; }
+        size_t GetSystemCount() const { return m_systems.size(); }
+
+        /** @brief 有効な全システムを走らせ、全て終わるまで戻らない */
+        void Run(float dt);
+
+        /** @brief 直前の Run の記録（開始の早い順） */
+        const std::vector<SystemTraceEvent> &GetLastTrace() const { return m_trace; }
+
+        /** @brief 直前の Run を Chrome のトレース形式（chrome://tracing, Perfetto で開ける JSON）にする */
+        std::string FormatTraceJson() const;
+
+    private:
+        struct System
+        {
+            std::string name;
+            SystemAccess access;
+            SystemFn fn;
+            bool enabled = true;
+        };
+
+        void buildGraph();
+        void spawn(uint32_t node, float dt, JobCounter &done);
+        void runNode(uint32_t node, float dt, JobCounter *done);
+
+    private:
+        JobSystem *m_jobs;
+        std::vector<System> m_systems;
+
+        // 1 フレーム分のグラフ（m_order は有効なシステム、添字は m_order の中の位置）
+        std::vector<uint32_t> m_order;
+        std::vector<std::vector<uint32_t>> m_successors;
+        std::vector<std::vector<uint32_t>> m_predecessors;
+        std::vector<std::atomic<uint32_t>> m_waiting; // 未完了の先行システム数
+        std::vector<uint32_t> m_roots;                // 先行のないシステム
+
+        std::vector<SystemTraceEvent> m_trace;        // Run 中は m_order の順（各ジョブが自分の位置に書く）
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+} // namespace NeonVector
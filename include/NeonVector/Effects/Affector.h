@@ -0,0 +1,89 @@
+#pragma once
+
+#include <NeonVector/Math/Vector2.h>
+#include <cstdint>
+
+namespace NeonVector {
+    namespace Effects {
+
+        enum class AffectorType {
+            Attractor,    // position へ引き寄せる（strength < 0 で反発）
+            Vortex,       // position の周りを回す（strength > 0 で画面上の時計回り）
+            Wind,         // direction 方向へ一定の加速
+            Turbulence,   // 発散ゼロの揺らぎ場（frequency = 空間周波数, 1/px）
+        };
+
+        /** @brief 影響半径内での強さの減衰 */
+        enum class AffectorFalloff {
+            None,        // 半径内は一定
+            Linear,      // 中心 1 → 縁 0
+            Smooth,      // (1 - d/r)^2
+        };
+
+        /**
+         * @struct Affector
+         * @brief 粒子に加速度を与える力場
+         *
+         * radius > 0 のとき影響は円内だけで、ParticleSystem は円と重ならない粒子ブロックを
+         * 丸ごと飛ばす。radius = 0 は全域に効く（減衰なし）。strength は px/s^2。
+         */
+        struct Affector {
+            AffectorType type = AffectorType::Attractor;
+            AffectorFalloff falloff = AffectorFalloff::Linear;
+            Vector2 position;
+            Vector2 direction{ 1.0f, 0.0f };   // Wind の向き（正規化済みであること）
+            float radius = 0.0f;
+            float strength = 0.0f;
+            float frequency = 0.01f;           // Turbulence
+            bool enabled = true;
+
+            static Affector Attractor(const Vector2& pos, float radius, float strength,
+                AffectorFalloff falloff = AffectorFalloff::Linear)
+            {
+                Affector a;
+                a.type = AffectorType::Attractor;
+                a.position = pos;
+                a.radius = radius;
+                a.strength = strength;
+                a.falloff = falloff;
+                return a;
+            }
+
+            static Affector Vortex(const Vector2& pos, float radius, float strength,
+                AffectorFalloff falloff = AffectorFalloff::Linear)
+            {
+                Affector a = Attractor(pos, radius, strength, falloff);
+                a.type = AffectorType::Vortex;
+                return a;
+            }
+
+            static Affector Wind(const Vector2& direction, float strength)
+            {
+                Affector a;
+                a.type = AffectorType::Wind;
+                a.direction = direction;
+                a.strength = strength;
+                a.falloff = AffectorFalloff::None;
+                return a;
+            }
+
+            static Affector Turbulence(float strength, float frequency)
+            {
+                Affector a;
+                a.type = AffectorType::Turbulence;
+                a.strength = strength;
+                a.frequency = frequency;
+                a.falloff = AffectorFalloff::None;
+                return a;
+            }
+        };
+
+        /** @brief ParticleSystem が所有する力場の識別子 */
+        struct AffectorId {
+            uint32_t index = ~0u;
+            uint32_t generation = 0;
+            bool IsValid() const { return index != ~0u; }
+        };
+
+    } // namespace Effects
+} // namespace NeonVector
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <NeonVector/Math/Vector2.h>
+#include <NeonVector/Math/Random.h>
+#include <NeonVector/Core/Types.h>
+#include <NeonVector/Core/PackedColor.h>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+
+namespace NeonVector {
+    namespace Graphics { class LineBatcher; }
+
+    namespace Effects {
+
+        /**
+         * @brief 解析的パーティクルの放出記録（生成後は書き換えない）
+         */
+        struct ParticleSpawn {
+            Vector2 origin;
+            Vector2 velocity;     // 初速
+            float spawnTime;      // 放出時刻（システム時計, 秒）
+            float lifetime;
+            uint32_t id;          // 識別子（放出時の Random カウンタ + バースト内の番号。値の再生成には使えない）
+            ColorRGBA8 color;
+            float size;
+        };
+
+        /**
+         * @class AnalyticParticleSystem
+         * @brief 位置を「初期値と経過時間の式」で求める、更新パスのないパーティクル
+         *
+         * drag と gravity が一定なら粒子の運動は閉じた式で書ける:
+         *   k = ln(drag), e = drag^t
+         *   v(t) = v0 e + (g/k)(e - 1)
+         *   p(t) = p0 + v0 (e - 1)/k + (g/k)((e - 1)/k - t)
+         * そのため Update は時計を進めて期限切れを先頭から捨てるだけで、Draw が
+         * その場で位置・速度を評価する。状態を書き戻さないのでメモリ転送が減り、
+         * SetTime で巻き戻しても同じ絵になる（決定論的）。ただし巻き戻せるのは
+         * 期限切れの記録を残しておく範囲（SetRewindWindow, 既定 0 秒）の中だけ。
+         *
+         * 記録は放出時刻順に並ぶ。力場・衝突など履歴に依存する処理は扱わない
+         * （必要なら ParticleSystem を使う）。SetGravity / SetDrag は既存の粒子にも
+         * 遡って効く。
+         */
+        class AnalyticParticleSystem {
+        public:
+            AnalyticParticleSystem();
+
+            /** @brief ParticleSystem::Emit と同じ放射状の放出 */
+            void Emit(const Vector2& pos, int count,
+                float minSpeed, float maxSpeed,
+                const Color& color, float life, float size = 3.0f);
+
+            /** @brief 時計を dt 進め、寿命が尽きて巻き戻し窓も過ぎた記録を先頭から捨てる */
+            void Update(float dt);
+            void Draw(Graphics::LineBatcher* batcher, float glow = 1.5f) const;
+            void Clear();
+
+            /**
+             * @brief 時計を直接設定（巻き戻し・早送り）
+             *
+             * 未来の記録は描かれないだけで残る。巻き戻した状態で Emit すると、
+             * それより後に放出された記録は捨てられる（履歴の分岐）。
+             * Update で捨てた記録は戻らないので、巻き戻しが正しく見えるのは
+             * 「直近 SetRewindWindow 秒以内に生きていた粒子」まで。
+             */
+            void SetTime(float t) { m_time = t; }
+            float Time() const { return m_time; }
+
+            /**
+             * @brief 寿命が尽きた記録を、さらに seconds 秒だけ残す（その分だけ巻き戻せる）
+             *
+             * 0（既定）なら期限切れはすぐ捨てる。窓を広げるほど保持する記録が増え、
+             * Draw はその分も期限切れとして読み飛ばす。
+             */
+            void SetRewindWindow(float seconds) { m_rewindWindow = std::max(seconds, 0.0f); }
+            float RewindWindow() const { return m_rewindWindow; }
+
+            /** @brief 保持している記録数（期限切れで先頭に詰まっていないものを含む） */
+            size_t Count() const { return m_spawns.size() - m_head; }
+            const ParticleSpawn* Spawns() const { return m_spawns.data() + m_head; }
+
+            void SetGravity(float g) { m_gravity = g; }
+            void SetDrag(float d) { m_drag = d; }
+            void SetSeed(uint64_t seed) { m_rng.Seed(seed); }
+
+        private:
+            std::vector<ParticleSpawn> m_spawns;   // [m_head, size) が有効, spawnTime 昇順
+            size_t m_head = 0;
+            std::vector<float> m_emitScratch;
+            float m_time = 0.0f;
+            float m_gravity = 0.0f;
+            float m_drag = 0.6f;
+            float m_rewindWindow = 0.0f;           // 期限切れ後も記録を残す秒数
+            Random m_rng;
+        };
+
+    } // namespace Effects
+} // namespace NeonVector
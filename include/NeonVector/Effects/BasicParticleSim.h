@@ -0,0 +1,102 @@
+#pragma once
+
+#include <NeonVector/Math/BasicVector2.h>
+#include <NeonVector/Math/Random.h>
+#include <NeonVector/Core/PackedColor.h>
+#include <NeonVector/Effects/ParticleColliders.h>
+#include <vector>
+#include <cstdint>
+
+namespace NeonVector {
+    namespace Graphics { class LineBatcher; }
+
+    namespace Effects {
+
+        /**
+         * @class BasicParticleSim
+         * @brief スカラー型を選べる、リプレイ・ロックステップ向けのパーティクル
+         *
+         * T = Fixed なら放出・積分・衝突の全てが整数演算になり、同じ seed と同じ dt の列から
+         * どの環境でも同じ状態（Checksum）になる。T = float は同じコードの速い版で、
+         * 固定小数点にするコストを測る基準にもなる。
+         *
+         * ParticleSystem（SIMD・並列・力場・サブエミッタ）の決定的な部分集合:
+         * 放射状の放出、一定の重力、速度の減衰、線分・円との掃引衝突。
+         * ParticleSystem 自体は float 専用で、float / Fixed の両方で動くのはこのクラスだけ。
+         * 放出・1 ステップの積分・衝突応答は ParticleStep.h、掃引判定は ColliderSweep.h を
+         * ParticleSystem と共有する（違うのは乱数の引き方と、衝突形状を総当たりで探すこと）。
+         * 粒子の順序は放出順のまま保たれる（消えた粒子は前に詰める）。
+         * 色・サイズは見た目だけの値なので float / RGBA8 のまま持つ。
+         */
+        template<class T>
+        class BasicParticleSim {
+        public:
+            using Scalar = T;
+            using Vec = BasicVector2<T>;
+            using Traits = ScalarTraits<T>;
+
+            struct Particle {
+                Vec pos;
+                Vec vel;
+                T life;        // 残り寿命（秒）
+                T maxLife;
+                ColorRGBA8 color;
+                float size;
+            };
+
+            struct Collider {
+                enum class Shape : uint8_t { Segment, Circle } shape = Shape::Segment;
+                CollisionResponse response = CollisionResponse::Bounce;
+                Vec a;         // Segment: 始点 / Circle: 中心
+                Vec b;         // Segment: 終点
+                T radius{};
+                T restitution{};
+                T friction{};  // 接線方向の速度を失う割合
+            };
+
+            explicit BasicParticleSim(uint64_t seed = 0) : m_rng(seed) {}
+
+            void SetSeed(uint64_t seed) { m_rng.Seed(seed); }
+            void SetGravity(const Vec& g) { m_gravity = g; }
+            /** @brief 毎秒残す速度割合（1 = 減衰なし。ParticleSystem::SetDrag と同じ） */
+            void SetDrag(T drag) { m_drag = drag; }
+
+            void Emit(const Vec& pos, int count, T minSpeed, T maxSpeed,
+                ColorRGBA8 color, T life, float size = 3.0f);
+
+            /** @brief 衝突形状（応答は ParticleSystem と同じ。粒子数 × 形状数の総当たりなので少数向け） */
+            void AddSegment(const Vec& a, const Vec& b,
+                CollisionResponse response = CollisionResponse::Bounce,
+                T restitution = Traits::FromFloat(0.6f), T friction = Traits::Zero());
+            void AddCircle(const Vec& center, T radius,
+                CollisionResponse response = CollisionResponse::Bounce,
+                T restitution = Traits::FromFloat(0.6f), T friction = Traits::Zero());
+            void ClearColliders() { m_colliders.clear(); }
+
+            void Update(T dt);
+
+            /** @param worldScale ワールド単位 → px（固定小数点では 1 単位を大きめに取るため） */
+            void Draw(Graphics::LineBatcher* batcher, float glow = 1.5f, float worldScale = 1.0f) const;
+
+            /** @brief 位置・速度・寿命のビット列のハッシュ（リプレイの一致確認用） */
+            uint64_t Checksum() const;
+
+            void Clear() { m_particles.clear(); }
+            size_t Count() const { return m_particles.size(); }
+            const std::vector<Particle>& Particles() const { return m_particles; }
+
+        private:
+            std::vector<Particle> m_particles;
+            std::vector<Collider> m_colliders;
+            Vec m_gravity;
+            T m_drag = Traits::One();
+            Random m_rng;
+        };
+
+        extern template class BasicParticleSim<float>;
+        extern template class BasicParticleSim<Fixed>;
+
+        using FixedParticleSim = BasicParticleSim<Fixed>;
+
+    } // namespace Effects
+} // namespace NeonVector
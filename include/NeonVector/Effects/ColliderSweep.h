@@ -0,0 +1,120 @@
+#pragma once
+
+#include <NeonVector/Math/Scalar.h>
+#include <algorithm>
+#include <type_traits>
+
+namespace NeonVector {
+    namespace Effects {
+
+        /** @brief SweepCircle の結果 */
+        enum class SweepContact {
+            None,     // 当たらない
+            Hit,      // 移動の途中で外から当たった
+            Inside,   // 始点が既に円の内側（t = 0、法線は外へ押し出す向き）
+        };
+
+        /**
+         * @brief from から d だけ動く点が線分 ab に最初に当たる位置
+         *
+         * V は Vector2 / BasicVector2<T>（スカラー型ごとの演算は ScalarTraits）。
+         * ParticleColliders と BasicParticleSim が float・固定小数点で同じ式を共有する。
+         * @param maxT これより先（t > maxT）の交差は無視する
+         * @return 当たれば true（t と、点の来た側を向く単位法線 normal）
+         */
+        template<class V>
+        bool SweepSegment(const V& from, const V& d, const V& a, const V& b,
+            decltype(V::x) maxT, decltype(V::x)& t, V& normal)
+        {
+            using Traits = ScalarTraits<decltype(V::x)>;
+            const auto zero = Traits::Zero();
+
+            // from + t d = a + u e を解く
+            const V e = b - a;
+            const auto denom = d.Cross(e);
+            if (Traits::Abs(denom) < Traits::Tolerance(1e-8f)) return false;   // 平行
+            const V w = a - from;
+            const auto tt = w.Cross(e) / denom;
+            const auto u = w.Cross(d) / denom;
+            if (tt < zero || tt > maxT || u < zero || u > Traits::One()) return false;
+
+            V n{ -e.y, e.x };
+            n.Normalize();
+            if (n.Dot(d) > zero) n = V{ -n.x, -n.y };   // 点の来た側を向ける
+            t = tt;
+            normal = n;
+            return true;
+        }
+
+        /**
+         * @brief from から d だけ動く点が円（center, radius）に最初に当たる位置
+         *
+         * float は 2 次方程式 |m + t d|^2 = r^2 をそのまま解く。Fixed は |m|^2 や b^2 が
+         * Q16.16 から溢れる（181 を超える長さで偽の Inside になる）ので、2 乗は全て
+         * ScalarTraits::Wide（Q32.32）で持ち、d の単位ベクトルに対する平行・垂直成分
+         * （どちらも長さの次元）から交点までの距離を求める。
+         */
+        template<class V>
+        SweepContact SweepCircle(const V& from, const V& d, const V& center, decltype(V::x) radius,
+            decltype(V::x) maxT, decltype(V::x)& t, V& normal)
+        {
+            using T = decltype(V::x);
+            using Traits = ScalarTraits<T>;
+            using Wide = typename Traits::Wide;
+            const auto zero = Traits::Zero();
+            const auto one = Traits::One();
+
+            const V m = from - center;
+            if constexpr (std::is_same_v<Wide, T>) {
+                const auto r2 = radius * radius;
+                const auto mm = m.Dot(m);
+                if (mm < r2) {
+                    // 内側から始まった（円が動いて点を飲み込んだ）: 外へ押し出す
+                    const auto len = Traits::Sqrt(mm);
+                    t = zero;
+                    normal = (len > Traits::Tolerance(1e-6f)) ? m * (one / len) : V{ zero, -one };
+                    return SweepContact::Inside;
+                }
+                const auto a = d.Dot(d);
+                if (a < Traits::Tolerance(1e-12f)) return SweepContact::None;
+                const auto b = m.Dot(d);
+                const auto disc = b * b - a * (mm - r2);
+                if (b > zero || disc < zero) return SweepContact::None;   // 遠ざかっている or 外れ
+                const auto tt = (-b - Traits::Sqrt(disc)) / a;
+                if (tt < zero || tt > maxT) return SweepContact::None;
+                t = tt;
+            } else {
+                const Wide r2 = Traits::MulWide(radius, radius);
+                const Wide mm = Traits::MulWide(m.x, m.x) + Traits::MulWide(m.y, m.y);
+                if (mm < r2) {
+                    const T len = Traits::SqrtWide(mm);
+                    t = zero;
+                    normal = (len > Traits::Tolerance(1e-6f)) ? V{ m.x / len, m.y / len } : V{ zero, -one };
+                    return SweepContact::Inside;
+                }
+                // 開平の前に安く落とす: 移動の外接矩形が円の外接矩形と離れている / 遠ざかっている
+                const T ex = d.x * maxT, ey = d.y * maxT;
+                if (std::min(m.x, m.x + ex) > radius || std::max(m.x, m.x + ex) < -radius ||
+                    std::min(m.y, m.y + ey) > radius || std::max(m.y, m.y + ey) < -radius)
+                    return SweepContact::None;
+                if (Traits::MulWide(m.x, d.x) + Traits::MulWide(m.y, d.y) > Wide(0))
+                    return SweepContact::None;
+
+                const T len = Traits::SqrtWide(Traits::MulWide(d.x, d.x) + Traits::MulWide(d.y, d.y));
+                if (len <= Traits::Tolerance(1e-6f)) return SweepContact::None;
+                const V u{ d.x / len, d.y / len };          // |u| = 1 なので以下は全て長さ（|m| 以下）
+                const T along = m.Dot(u);
+                const T across = m.Cross(u);
+                const Wide h2 = r2 - Traits::MulWide(across, across);
+                if (h2 < Wide(0)) return SweepContact::None;   // 外れ
+                const T dist = -along - Traits::SqrtWide(h2);  // 交点までの道のり（≥ 0）
+                if (dist < zero || dist > maxT * len) return SweepContact::None;
+                t = dist / len;
+            }
+
+            normal = (from + d * t - center) * (one / radius);
+            return SweepContact::Hit;
+        }
+
+    } // namespace Effects
+} // namespace NeonVector
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <NeonVector/Math/Vector2.h>
+#include <NeonVector/Core/Types.h>
+#include <vector>
+#include <cstdint>
+
+namespace NeonVector {
+    namespace Effects {
+
+        /**
+         * @brief 放出形状。direction / spread の解釈は形状ごとに異なる。
+         */
+        enum class EmitterShape {
+            Point,   // 位置から全方向（spread は無視）
+            Line,    // 位置を中心に direction と直交する長さ length の線分上から、direction ± spread/2 へ
+            Arc,     // 半径 radius の円弧（中心角 direction ± spread/2）上から外向きに
+            Cone,    // 位置から direction ± spread/2 の扇状に
+        };
+
+        /**
+         * @brief 放出スケジュール上のバースト
+         *
+         * エミッタ開始から time 秒後に count 個。cycles 回（0 = 無限）を interval 秒ごとに繰り返す。
+         */
+        struct EmitterBurst {
+            float time = 0.0f;
+            int count = 0;
+            int cycles = 1;
+            float interval = 0.0f;
+        };
+
+        /**
+         * @brief エミッタの設定（実行中に書き換えてよい）
+         */
+        struct EmitterDesc {
+            EmitterShape shape = EmitterShape::Point;
+            float rate = 0.0f;             // 連続放出（個/秒）。端数は次フレームへ持ち越す
+            std::vector<EmitterBurst> bursts;
+
+            float direction = 0.0f;        // 基準方向（ラジアン, 画面座標）
+            float spread = 6.28318530718f; // 放出角の幅（ラジアン）
+            float length = 0.0f;           // Line の長さ
+            float radius = 0.0f;           // Arc の半径
+
+            float minSpeed = 60.0f;
+            float maxSpeed = 240.0f;
+            float inheritVelocity = 0.0f;  // エミッタ移動速度を何割引き継ぐか
+
+            Color color = Color::White;
+            float life = 0.7f;             // 寿命（秒）。個体差 0.7〜1.0 倍
+            float size = 3.0f;
+        };
+
+        /** @brief ParticleSystem が所有するエミッタの識別子 */
+        struct EmitterId {
+            uint32_t index = ~0u;
+            uint32_t generation = 0;
+            bool IsValid() const { return index != ~0u; }
+        };
+
+        /**
+         * @class Emitter
+         * @brief 時間をかけて放出する発生源。ParticleSystem::Update で一括評価される。
+         *
+         * 毎フレーム SetPosition で動かすと、そのフレームの移動線分上に放出時刻どおり
+         * 散らして生成する（フレームレートに依らず同じ密度の尾になる）。
+         */
+        class Emitter {
+        public:
+            EmitterDesc desc;
+
+            /** @brief 移動（前フレーム位置との間を補間して放出し、移動速度を継承に使う） */
+            void SetPosition(const Vector2& p) { m_pos = p; }
+            /** @brief 補間せずに瞬間移動 */
+            void Teleport(const Vector2& p) { m_pos = p; m_prevPos = p; }
+            const Vector2& Position() const { return m_pos; }
+
+            void SetActive(bool active) { m_active = active; }
+            bool IsActive() const { return m_active; }
+
+            /** @brief 経過時間・端数・バースト履歴を初期化 */
+            void Restart()
+            {
+                m_time = 0.0f;
+                m_accum = 0.0f;
+                m_burstFired.assign(m_burstFired.size(), 0);
+            }
+            float Time() const { return m_time; }
+
+        private:
+            friend class ParticleSystem;
+
+            Vector2 m_pos;
+            Vector2 m_prevPos;
+            float m_time = 0.0f;
+            float m_accum = 0.0f;            // 連続放出の端数
+            bool m_active = true;
+            bool m_alive = false;            // スロット使用中
+            uint32_t m_generation = 0;
+            std::vector<int> m_burstFired;   // バースト毎の発火済み回数
+        };
+
+    } // namespace Effects
+} // namespace NeonVector
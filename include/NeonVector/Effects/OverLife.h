@@ -0,0 +1,116 @@
+#pragma once
+
+#include <NeonVector/Core/Types.h>
+#include <NeonVector/Core/PackedColor.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace NeonVector {
+    namespace Effects {
+
+        /**
+         * @class Curve
+         * @brief キーフレームで書くスカラー曲線（t = 0..1, キー間は線形補間）
+         *
+         * キーがなければ常に defaultValue。範囲外は端のキーの値を保つ。
+         */
+        class Curve {
+        public:
+            struct Key { float t; float value; };
+
+            explicit Curve(float defaultValue = 1.0f) : m_default(defaultValue) {}
+
+            /** @brief a → b の直線 */
+            static Curve Linear(float a, float b)
+            {
+                Curve c;
+                c.AddKey(0.0f, a).AddKey(1.0f, b);
+                return c;
+            }
+
+            /** @brief キーを追加（t 順に並べ直す。同じ t は後から足した方が後ろ） */
+            Curve& AddKey(float t, float value);
+            void Clear() { m_keys.clear(); }
+
+            float Evaluate(float t) const;
+            const std::vector<Key>& Keys() const { return m_keys; }
+
+        private:
+            std::vector<Key> m_keys;
+            float m_default;
+        };
+
+        /**
+         * @class Gradient
+         * @brief キーフレームで書く色の変化（t = 0..1, RGBA を線形補間）
+         */
+        class Gradient {
+        public:
+            struct Key { float t; Color color; };
+
+            explicit Gradient(const Color& defaultColor = Color::White) : m_default(defaultColor) {}
+
+            static Gradient Linear(const Color& a, const Color& b)
+            {
+                Gradient g;
+                g.AddKey(0.0f, a).AddKey(1.0f, b);
+                return g;
+            }
+
+            Gradient& AddKey(float t, const Color& color);
+            void Clear() { m_keys.clear(); }
+
+            Color Evaluate(float t) const;
+            const std::vector<Key>& Keys() const { return m_keys; }
+
+        private:
+            std::vector<Key> m_keys;
+            Color m_default;
+        };
+
+        /**
+         * @class OverLifeTable
+         * @brief 寿命に沿った色・α・サイズ倍率を焼き込んだ参照テーブル
+         *
+         * Bake で Gradient / Curve を kSize 段にサンプリングし、RGBA8 と float サイズの
+         * 配列に詰める。描画ループはキー数や補間の種類に関係なく、粒子ごとに
+         * 添字計算と 1 回の参照だけで済む。
+         *
+         * t は「経過割合」で 0 = 生まれた瞬間, 1 = 消える瞬間（Trail では 0 = 先端, 1 = 尾）。
+         * 色は粒子・トレイル自身の色への乗数として働く（白 = そのまま）。
+         * ParticleSystem / Trail はポインタを保持するだけなので、使用中は生かしておくこと。
+         */
+        class OverLifeTable {
+        public:
+            static constexpr size_t kSize = 256;
+
+            /** @brief 既定: 白のまま α を 1 → 0、サイズは 1 倍（ParticleSystem の従来の見た目） */
+            OverLifeTable();
+
+            /**
+             * @brief 曲線を焼き込む
+             * @param color 色の乗数（α も alpha と掛け合わせる）
+             * @param alpha α の乗数
+             * @param size  サイズ（太さ）の乗数
+             */
+            void Bake(const Gradient& color, const Curve& alpha, const Curve& size);
+
+            /** @brief t (0..1) に最も近い段の添字 */
+            static size_t Index(float t)
+            {
+                const float f = t * static_cast<float>(kSize - 1) + 0.5f;
+                const float c = (f < 0.0f) ? 0.0f : (f > static_cast<float>(kSize - 1) ? static_cast<float>(kSize - 1) : f);
+                return static_cast<size_t>(c);
+            }
+
+            ColorRGBA8 ColorAt(size_t i) const { return m_color[i]; }
+            float SizeAt(size_t i) const { return m_size[i]; }
+
+        private:
+            ColorRGBA8 m_color[kSize];
+            float m_size[kSize];
+        };
+
+    } // namespace Effects
+} // namespace NeonVector
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <NeonVector/Math/Vector2.h>
+#include <vector>
+#include <cstdint>
+
+namespace NeonVector {
+    namespace Effects {
+
+        /** @brief 粒子が当たったときの振る舞い */
+        enum class CollisionResponse {
+            Bounce,   // 法線方向を restitution 倍で反射
+            Kill,     // その場で消滅
+            Slide,    // 法線方向の速度を捨てて面に沿って滑る
+        };
+
+        /** @brief ParticleColliders に登録した形状の識別子 */
+        struct ColliderId {
+            uint32_t index = ~0u;
+            uint32_t generation = 0;
+            bool IsValid() const { return index != ~0u; }
+        };
+
+        /** @brief 掃引判定の結果 */
+        struct ColliderHit {
+            float t = 1.0f;        // 移動線分上の位置（0 = 始点, 1 = 終点）
+            Vector2 normal;        // 衝突面の法線（粒子側を向く, 正規化済み）
+            uint32_t collider = 0; // 当たった形状のインデックス
+        };
+
+        /**
+         * @class ParticleColliders
+         * @brief 粒子と衝突する線分・円の集合（一様グリッドの空間ハッシュ）
+         *
+         * 形状は外接矩形が重なるセルすべてに登録される。ParticleSystem は粒子ブロック
+         * ごとに 1 回だけ Query して候補を集め、ブロック内の各粒子はその候補とだけ
+         * 判定するので、コストは粒子数 × 形状数ではなく局所的な密度に比例する。
+         *
+         * Move で動かした形状はその場でセルを付け替える（動的な障害物）。
+         * Query は const で、複数スレッドから同時に呼んでよい（登録・移動は不可）。
+         */
+        class ParticleColliders {
+        public:
+            struct Collider {
+                enum class Shape : uint8_t { Segment, Circle } shape = Shape::Segment;
+                CollisionResponse response = CollisionResponse::Bounce;
+                Vector2 a;              // Segment: 始点 / Circle: 中心
+                Vector2 b;              // Segment: 終点
+                float radius = 0.0f;    // Circle
+                float restitution = 0.6f;
+                float friction = 0.0f;  // 接線方向の速度を失う割合
+            };
+
+            /** @param cellSize セルの一辺（px）。典型的な形状の大きさ程度にする */
+            explicit ParticleColliders(float cellSize = 64.0f, size_t bucketCount = 4096);
+
+            ColliderId AddSegment(const Vector2& a, const Vector2& b,
+                CollisionResponse response = CollisionResponse::Bounce,
+                float restitution = 0.6f, float friction = 0.0f);
+            ColliderId AddCircle(const Vector2& center, float radius,
+                CollisionResponse response = CollisionResponse::Bounce,
+                float restitution = 0.6f, float friction = 0.0f);
+
+            /** @brief 登録済みの形状を動かす（セルも付け替える） */
+            void MoveSegment(ColliderId id, const Vector2& a, const Vector2& b);
+            void MoveCircle(ColliderId id, const Vector2& center, float radius);
+            void Remove(ColliderId id);
+            void Clear();
+
+            size_t Count() const { return m_colliders.size() - m_free.size(); }
+            const Collider& Get(uint32_t index) const { return m_colliders[index].collider; }
+
+            /** @brief 矩形 [lo, hi] と重なりうる形状のインデックスを out に集める（重複なし） */
+            void Query(const Vector2& lo, const Vector2& hi, std::vector<uint32_t>& out) const;
+
+            /** @brief 矩形 [lo, hi] が覆うセル数（Query をまとめるか分けるかの判断用） */
+            size_t CellSpan(const Vector2& lo, const Vector2& hi) const;
+
+            /** @brief 点 p を含むセルに登録された形状（コピーなし, 重複なし） */
+            const std::vector<uint32_t>& CellAt(const Vector2& p) const;
+
+            /**
+             * @brief from → to の移動で最初に当たる形状を candidates から探す
+             * @return 当たれば true（hit に最小の t）
+             */
+            bool Sweep(const uint32_t* candidates, size_t count,
+                const Vector2& from, const Vector2& to, ColliderHit& hit) const;
+
+        private:
+            struct Slot {
+                Collider collider;
+                int x0 = 0, y0 = 0, x1 = -1, y1 = -1;   // 登録中のセル範囲
+                uint32_t generation = 0;
+                bool alive = false;
+            };
+
+            ColliderId add(const Collider& c);
+            Slot* find(ColliderId id);
+            void insertCells(uint32_t index);
+            void removeCells(uint32_t index);
+            void cellRange(const Collider& c, int& x0, int& y0, int& x1, int& y1) const;
+            size_t bucketOf(int cx, int cy) const;
+
+        private:
+            float m_cellSize;
+            float m_invCellSize;
+            std::vector<std::vector<uint32_t>> m_buckets;   // セル座標のハッシュ → 形状
+            std::vector<Slot> m_colliders;
+            std::vector<uint32_t> m_free;
+        };
+
+    } // namespace Effects
+} // namespace NeonVector
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <NeonVector/Effects/ParticleColliders.h>
+#include <NeonVector/Math/Scalar.h>
+
+namespace NeonVector {
+    namespace Effects {
+
+        /**
+         * @brief 放出する粒子の向き・速さ・寿命（単位乱数 [0, 1) から）
+         *
+         * ParticleSystem・AnalyticParticleSystem（float）と BasicParticleSim（float / Fixed）が
+         * 同じ式を共有する。乱数の引き方（列ごとの一括生成か 1 個ずつか）は各クラスの持ち物。
+         */
+        template<class T>
+        class EmitSampler {
+        public:
+            using Traits = ScalarTraits<T>;
+
+            EmitSampler(T minSpeed, T maxSpeed, T life)
+                : m_minSpeed(minSpeed), m_speedRange(maxSpeed - minSpeed), m_life(life),
+                  m_lifeMin(Traits::FromFloat(0.7f)), m_lifeRange(Traits::One() - m_lifeMin) {}
+
+            /** @brief 全方向の放出の角度（0..2π） */
+            static T Angle(T u) { return u * Traits::TwoPi(); }
+            T Speed(T u) const { return m_minSpeed + u * m_speedRange; }
+            /** @brief 寿命は life の 0.7〜1 倍 */
+            T Life(T u) const { return m_life * (m_lifeMin + u * m_lifeRange); }
+
+            /** @brief 角度の sin / cos と速さからの初速 */
+            template<class V>
+            static V Velocity(T s, T c, T speed) { return V{ c * speed, s * speed }; }
+
+        private:
+            T m_minSpeed, m_speedRange, m_life;
+            T m_lifeMin, m_lifeRange;
+        };
+
+        /** @brief dt 秒で速度に掛ける割合（drag = 1 秒後に残る割合。drag^dt） */
+        template<class T>
+        T DragScale(T drag, T dt) { return ScalarTraits<T>::Pow(drag, dt); }
+
+        /** @brief 1 ステップの移動が最初に当たった面と、その形状の応答 */
+        template<class V>
+        struct ParticleContact {
+            V normal;   // 粒子の来た側を向く単位法線
+            decltype(V::x) t{};   // 移動上の位置（0..1）
+            CollisionResponse response = CollisionResponse::Bounce;
+            decltype(V::x) restitution{};
+            decltype(V::x) friction{};
+        };
+
+        /**
+         * @brief from → next の移動が contact で当たったときの応答
+         *
+         * next を面のわずかに手前に止め、速度を法線・接線成分に分けて応答に従って直す。
+         * Kill は寿命を 0 にする（そのステップの終わりに消える）。
+         */
+        template<class V>
+        void ResolveHit(const V& from, V& next, V& vel, decltype(V::x)& life, const ParticleContact<V>& contact)
+        {
+            using Traits = ScalarTraits<decltype(V::x)>;
+            const auto zero = Traits::Zero();
+            const V& n = contact.normal;
+
+            next = from + (next - from) * contact.t + n * Traits::Tolerance(0.01f);
+            const auto vn = vel.Dot(n);
+            const V vt = (vel - n * vn) * (Traits::One() - contact.friction);
+            switch (contact.response) {
+            case CollisionResponse::Kill:
+                life = zero;
+                break;
+            case CollisionResponse::Bounce:
+                vel = (vn < zero) ? vt - n * (vn * contact.restitution) : vt + n * vn;
+                break;
+            case CollisionResponse::Slide:
+                vel = (vn < zero) ? vt : vt + n * vn;
+                break;
+            }
+        }
+
+        /**
+         * @brief 粒子 1 個の 1 ステップ
+         *
+         * 位置は今の速度で進め（当たれば ResolveHit）、その後で速度に減衰（keep = DragScale）と
+         * 重力をかけ、寿命を dt 減らす。0 以下になった粒子は呼び出し側で消す。
+         * collide(from, next, contact) は from → next の移動で最初に当たる面を探して contact に書き、
+         * 当たったかを返す（探し方は各クラスの持ち物）。位置・速度を参照で渡さないので、
+         * 判定が別の翻訳単位の関数でも呼び出し側はレジスタのまま回せる。
+         * @return 当たったか
+         */
+        template<class V, class Collide>
+        bool StepParticle(V& pos, V& vel, decltype(V::x)& life, decltype(V::x) dt,
+            decltype(V::x) keep, const V& gravity, Collide&& collide)
+        {
+            V next = pos + vel * dt;
+            ParticleContact<V> contact;
+            const bool hit = collide(pos, next, contact);
+            if (hit)
+                ResolveHit(pos, next, vel, life, contact);
+            pos = next;
+            vel = vel * keep + gravity * dt;
+            life -= dt;
+            return hit;
+        }
+
+    } // namespace Effects
+} // namespace NeonVector
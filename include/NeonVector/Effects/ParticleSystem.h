@@ -1,11 +1,20 @@
 #pragma once
 
 #include <NeonVector/Math/Vector2.h>
+#include <NeonVector/Math/Random.h>
 #include <NeonVector/Core/Types.h>
+#include <NeonVector/Core/PackedColor.h>
+#include <NeonVector/Effects/Emitter.h>
+#include <NeonVector/Effects/Affector.h>
+#include <NeonVector/Effects/ParticleColliders.h>
+#include <NeonVector/Effects/ParticleStep.h>
+#include <NeonVector/Effects/SubEmitter.h>
+#include <NeonVector/Effects/OverLife.h>
 #include <vector>
-#include <random>
+#include <cstdint>
 
 namespace NeonVector {
+    class JobSystem;
     namespace Graphics { class LineBatcher; }
 
     namespace Effects {
@@ -16,7 +25,21 @@ namespace NeonVector {
             float life;      // 残り寿命（秒）
             float maxLife;   // 初期寿命
             float size;
-            Color color;
+            ColorRGBA8 color;
+            uint8_t depth;   // サブエミッタの世代（0 = Emit / エミッタから直接）
+        };
+
+        /**
+         * @brief プール満杯時に新規放出をどう扱うか
+         *
+         * 粒子は放出順に詰めて持つので、ReplaceOldest は溢れた放出 1 回ごとに先頭の古い粒子を消して
+         * 残りを前へ詰める（生きている粒子数ぶんの memmove が 1 回。Update の詰め直しと同じ桁）。
+         * ReplaceDimmest は加えて明るさで nth_element をかける。
+         */
+        enum class OverflowPolicy {
+            DropNew,         // 入りきらない新規分を捨てる
+            ReplaceOldest,   // 最も古いものから置き換える（溢れるたびに全体を 1 回詰める）
+            ReplaceDimmest,  // 最も暗い（α×残り寿命比が小さい）ものから置き換える
         };
 
         /**
@@ -25,6 +48,28 @@ namespace NeonVector {
          *
          * Emit で放射状にばら撒き、Update で移動・減衰・寿命処理、Draw で速度方向の
          * 短い発光ストリークとして描く（bloom で光る）。
+         *
+         * SetCapacity で容量固定のプールモードになる。初回 Emit で一度だけ確保し、
+         * 以降は満杯時に OverflowPolicy に従うのでヒープ確保が発生しない。
+         *
+         * SetJobSystem を渡すと Update / Draw をチャンク単位で並列化する。各チャンクは
+         * 自分の範囲だけを書き（Draw は LineBatcher::AllocateLines で確保した頂点の
+         * 互いに素な区間）、ロックは取らない。
+         *
+         * AddEmitter で登録したエミッタは Update の最後に一括で評価され、放出時刻に
+         * 合わせて位置・寿命を補正した粒子を追加する。
+         *
+         * AddAffector の力場は Update のチャンク処理の中で、粒子ブロック（256 個）ごとに
+         * 評価する。ブロックの外接矩形と影響円が重ならない力場はそのブロックを飛ばすので、
+         * コストは「粒子数 × 力場数」ではなく重なりの量に比例する。ブロックの位置・速度は
+         * 列に取り出して Simd::Float8 で計算する（乱流の sin/cos は FastMath の一括版）。
+         *
+         * SetColliders を渡すと同じブロック単位で衝突段を行う（ブロックの移動範囲で
+         * 空間ハッシュを 1 回引き、各粒子はその候補とだけ掃引判定する）。
+         *
+         * AddSubEmitter の定義がある間は、チャンク処理が死亡・衝突をチャンク毎の
+         * イベントバッファへ書き出し、integrate の後にサブエミッタごと 1 回の一括放出に
+         * まとめる（イベントはチャンク順に読むのでスレッド数に依らず同じ結果になる）。
          */
         class ParticleSystem {
         public:
@@ -35,19 +80,138 @@ namespace NeonVector {
                 float minSpeed, float maxSpeed,
                 const Color& color, float life, float size = 3.0f);
 
+            /** @brief 既存粒子を dt 進め、サブエミッタ・全エミッタの順に評価して新規粒子を追加する */
             void Update(float dt);
             void Draw(Graphics::LineBatcher* batcher, float glow = 1.5f) const;
             void Clear();
 
             size_t Count() const { return m_particles.size(); }
+            /** @brief 生きている粒子（放出順, Count 個）。次の Update / Emit まで有効 */
+            const Particle* Particles() const { return m_particles.data(); }
+
+            /**
+             * @brief プールモード。capacity 個を上限に固定する（0 = 上限なしの従来動作）。
+             *
+             * 既に capacity を超えている場合は古いものから切り捨てる。
+             */
+            void SetCapacity(size_t capacity, OverflowPolicy policy = OverflowPolicy::DropNew);
+            size_t Capacity() const { return m_capacity; }
+            OverflowPolicy GetOverflowPolicy() const { return m_policy; }
+
+            /** @brief 生存数に合わせてメモリを返す（レベル遷移時に Clear と併用）。プールは次の Emit で再確保 */
+            void ShrinkToFit();
+
+            /** @brief エミッタを登録（position は初期位置） */
+            EmitterId AddEmitter(const EmitterDesc& desc, const Vector2& position = {});
+            /** @brief 無効・削除済みの id には nullptr（ポインタは次の AddEmitter まで有効） */
+            Emitter* GetEmitter(EmitterId id);
+            void RemoveEmitter(EmitterId id);
+            size_t EmitterCount() const { return m_emitters.size() - m_freeEmitters.size(); }
+
+            /** @brief 力場を登録（Update 時に gravity / drag より先に速度へ加算） */
+            AffectorId AddAffector(const Affector& affector);
+            /** @brief 無効・削除済みの id には nullptr（ポインタは次の AddAffector まで有効） */
+            Affector* GetAffector(AffectorId id);
+            void RemoveAffector(AffectorId id);
+            size_t AffectorCount() const { return m_affectors.size() - m_freeAffectors.size(); }
+
+            /** @brief サブエミッタを登録（同じイベントに複数の定義が反応してよい） */
+            void AddSubEmitter(const SubEmitterDesc& desc);
+            void ClearSubEmitters();
+            size_t SubEmitterCount() const { return m_subEmitters.size(); }
+            SubEmitterDesc& GetSubEmitter(size_t index) { return m_subEmitters[index]; }
+
+            /** @brief サブエミッタが 1 フレームに出す総数の上限（0 = 上限なし。既定 4096） */
+            void SetSubEmitterBudget(size_t maxPerFrame) { m_subBudget = maxPerFrame; }
+            size_t GetSubEmitterBudget() const { return m_subBudget; }
+
+            /**
+             * @brief 寿命に沿った色・α・サイズの変化（nullptr = α の線形フェードのみ）
+             *
+             * 所有はしない。Draw は粒子毎にテーブルを 1 回引くだけなので、曲線の複雑さで
+             * コストは変わらない。
+             */
+            void SetOverLife(const OverLifeTable* table) { m_overLife = table; }
+            const OverLifeTable* GetOverLife() const { return m_overLife; }
+
+            /** @brief 衝突する世界形状（nullptr = 衝突なし）。所有はしない。Update 中に変更しないこと */
+            void SetColliders(const ParticleColliders* colliders) { m_colliders = colliders; }
+
+            /** @brief 並列処理に使うジョブシステム（nullptr = シングルスレッド）。所有はしない */
+            void SetJobSystem(JobSystem* jobs) { m_jobs = jobs; }
+
+            /**
+             * @brief 決定論モード（既定 ON）
+             *
+             * ON: チャンク分割を固定サイズにし、結果をチャンク順に併合する。
+             *     スレッド数が変わっても結果はビット単位で一致する（リプレイ向け）。
+             * OFF: スレッド数に合わせてチャンクを大きくし、分配の負荷を減らす。
+             */
+            void SetDeterministic(bool enabled) { m_deterministic = enabled; }
+            bool IsDeterministic() const { return m_deterministic; }
+
+            /** @brief 乱数の種を固定する（リプレイ用。既定は起動毎にランダム） */
+            void SetSeed(uint64_t seed) { m_rng.Seed(seed); }
+            Random& GetRandom() { return m_rng; }
+
             void SetGravity(float g) { m_gravity = g; }   // +で下方向(画面座標)
             void SetDrag(float d) { m_drag = d; }         // 毎秒残す速度割合(1=減衰なし)
 
         private:
-            std::vector<Particle> m_particles;
+            size_t makeRoom(size_t count);
+            void compact();
+            void integrate(float dt);
+            void runEmitters(float dt);
+            void spawnFromEmitter(const Emitter& e, size_t count, float dt,
+                float firstAge, float ageStep);
+            /** @brief サブエミッタの発火元（Update 中にチャンク毎に記録） */
+            struct ParticleEvent {
+                Vector2 pos;
+                Vector2 vel;
+                ColorRGBA8 color;
+                uint8_t depth;
+                SubEmitterTrigger trigger;
+            };
+
+            size_t updateRange(size_t begin, size_t end, float dt, float velScale,
+                std::vector<ParticleEvent>& events);
+            void runSubEmitters();
+            size_t chunkSize(size_t count) const;
+            void applyAffectors(size_t begin, size_t end, float dt);
+            bool collide1(Vector2 from, Vector2 next, const uint32_t* candidates, size_t count,
+                ParticleContact<Vector2>& contact) const;
+
+            struct AffectorSlot {
+                Affector affector;
+                uint32_t generation = 0;
+                bool alive = false;
+            };
+
+        private:
+            std::vector<Particle> m_particles;   // 放出順（先頭ほど古い）を保つ
+            std::vector<uint32_t> m_scratch;     // ReplaceDimmest の選別用（容量分を確保済み）
+            size_t m_capacity = 0;
+            OverflowPolicy m_policy = OverflowPolicy::DropNew;
+            JobSystem* m_jobs = nullptr;
+            bool m_deterministic = true;
+            std::vector<size_t> m_chunkAlive;     // 並列 Update: チャンク毎の生存数
+            std::vector<float> m_emitScratch;     // Emit: 角度・速さ・寿命・sin・cos の一括生成用
+            std::vector<Emitter> m_emitters;
+            std::vector<uint32_t> m_freeEmitters;
+            std::vector<AffectorSlot> m_affectors;
+            std::vector<uint32_t> m_freeAffectors;
+            const ParticleColliders* m_colliders = nullptr;
+            const OverLifeTable* m_overLife = nullptr;
+            std::vector<SubEmitterDesc> m_subEmitters;
+            std::vector<std::vector<ParticleEvent>> m_chunkEvents;   // チャンク毎（逐次時は [0] のみ）
+            std::vector<const ParticleEvent*> m_subFired;   // 一括放出: 発火したイベント
+            size_t m_subBudget = 4096;
+            uint8_t m_eventMask = 0;              // 記録するトリガ（1 << SubEmitterTrigger）
+            uint8_t m_eventDepth = 0;             // depth がこれ未満の粒子だけ記録する
+            float m_time = 0.0f;                  // Turbulence の位相
             float m_gravity = 0.0f;
             float m_drag = 0.6f;
-            std::mt19937 m_rng;
+            Random m_rng;
         };
 
     } // namespace Effects
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <NeonVector/Core/Types.h>
+#include <cstdint>
+
+namespace NeonVector {
+    namespace Effects {
+
+        /** @brief サブエミッタを発火させる粒子側のイベント */
+        enum class SubEmitterTrigger : uint8_t {
+            Death,       // 寿命が尽きた、または Kill 応答の形状に当たった
+            Collision,   // 形状に当たった（Bounce / Slide / Kill すべて）
+        };
+
+        /**
+         * @brief 粒子のイベントで新しい粒子を出す定義（花火の二段割れ・連鎖爆発）
+         *
+         * 親粒子の depth が maxDepth 未満のときだけ発火し、子の depth は親 + 1 になる。
+         * 1 フレームに出す総数は ParticleSystem::SetSubEmitterBudget で頭打ちにできる。
+         */
+        struct SubEmitterDesc {
+            SubEmitterTrigger trigger = SubEmitterTrigger::Death;
+            int count = 8;                 // 1 イベントあたりの個数
+            float probability = 1.0f;      // イベントごとの発火確率
+            int maxDepth = 1;              // 連鎖の深さ（1 = 直接放出した粒子からだけ出る）
+
+            float spread = 6.28318530718f; // 親の進行方向を中心とした放出角の幅（2π = 全方向）
+            float minSpeed = 40.0f;
+            float maxSpeed = 160.0f;
+            float inheritVelocity = 0.0f;  // 親の速度を何割引き継ぐか
+
+            Color color = Color::White;
+            bool inheritColor = false;     // true なら親の色（color は無視）
+            float life = 0.5f;             // 寿命（秒）。個体差 0.7〜1.0 倍
+            float size = 2.0f;
+        };
+
+    } // namespace Effects
+} // namespace NeonVector
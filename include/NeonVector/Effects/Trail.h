@@ -3,36 +3,102 @@
 #include <NeonVector/Math/Vector2.h>
 #include <NeonVector/Core/Types.h>
 #include <deque>
+#include <vector>
+#include <cstdint>
 
 namespace NeonVector {
     namespace Graphics { class LineBatcher; }
 
     namespace Effects {
 
+        class OverLifeTable;
+
         /**
          * @class Trail
          * @brief 動く物体の残光（コメット状のトレイル）。
          *
          * 直近の位置を貯め、新しい端ほど明るく・太く、古い端ほど薄く・細く描く。
          * 毎フレーム Push(現在位置) を呼び、Draw で線として描画する。bloom で発光する。
+         *
+         * SetOverLife を渡すと太さ・α の既定の傾斜の代わりに、先端 (t = 0) から
+         * 尾 (t = 1) までをテーブルで引く。
+         *
+         * SetSampling で距離ベースの採取にすると、Push(p, dt) は呼ばれた回数ではなく
+         * 移動の道のり minSpacing ごとに点を置き（1 フレームで長く動けば間に補って置く）、
+         * ほぼ止まっているときは maxInterval ごとに残す。長さ・密度がフレームレートに依らない。
+         * SetSmoothing で Draw が点の間を centripetal Catmull-Rom で補間し、曲がり具合に
+         * 応じて分割数を決めるので、少ない点でも滑らかな尾になる。
+         *
+         * SetSimplify で、ほぼ一直線に並んだ点を積む時点で間引く（RDP）。やり直すのは
+         * 直近の未確定区間（最大 kSimplifyWindow 点）だけ。尾の長さと濃淡は間引く前の
+         * 点の通し番号で決まるので、間引いても見た目の長さは変わらない。
          */
         class Trail {
         public:
             explicit Trail(int maxPoints = 48);
 
+            /** @brief 点を 1 つ積む（採取設定に関係なく必ず残す） */
             void Push(const Vector2& p);
+            /**
+             * @brief 現在位置を渡す。距離ベース採取なら道のりに応じて点を置き、
+             *        点にならなかった現在位置も先端として描く（minSpacing = 0 なら Push(p) と同じ）
+             */
+            void Push(const Vector2& p, float dt);
             void Clear();
 
+            /**
+             * @brief 距離ベースの採取
+             * @param minSpacing  点の間隔（移動の道のり, px）。0 = 毎回残す従来の動作
+             * @param maxInterval 動きが遅くてもこの秒数ごとに点を残す（0 = 時間では残さない）
+             */
+            void SetSampling(float minSpacing, float maxInterval = 0.1f);
+
+            /** @brief 点を間引く許容誤差（元の点からのずれ, px）。0 = 間引かない（既定） */
+            void SetSimplify(float tolerance);
+
+            /** @brief 曲線補間の許容誤差（弦からのずれ, px）。0 = 点を直線で結ぶ（既定） */
+            void SetSmoothing(float tolerance) { m_tolerance = tolerance; }
+
             void Draw(Graphics::LineBatcher* batcher, const Color& color,
                 float thickness = 2.0f, float glow = 1.5f) const;
 
+            /** @brief 長さ方向の色・α・太さの変化（nullptr = 既定の傾斜）。所有はしない */
+            void SetOverLife(const OverLifeTable* table) { m_overLife = table; }
+
             void SetMaxPoints(int n);
             int  MaxPoints() const { return m_max; }
+            /** @brief 保持している点の数（間引いた後） */
             size_t Size() const { return m_points.size(); }
 
+            static constexpr size_t kSimplifyWindow = 32;
+
         private:
+            /** @brief 点と、間引く前の通し番号（長さ・濃淡の基準） */
+            struct Sample {
+                float x, y;
+                uint32_t seq;
+                Vector2 Pos() const { return { x, y }; }
+            };
+
+            void pushPoint(const Vector2& p);
+            void trim();
+
             int m_max;
-            std::deque<Vector2> m_points;   // front = 古い / back = 新しい
+            const OverLifeTable* m_overLife = nullptr;
+            std::deque<Sample> m_points;    // front = 古い / back = 新しい
+            uint32_t m_seq = 0;             // 次に積む点の通し番号
+            float m_simplify = 0.0f;
+            std::vector<Sample> m_tail;     // 間引き: 未確定区間の元の点（[0] は確定済みの固定端）
+            std::vector<Sample> m_tailWork; // 間引き: m_tail を簡略化する作業領域
+            size_t m_tailStored = 0;        // m_points 末尾のうち未確定区間から来た点の数
+            Vector2 m_head;                 // 距離ベース採取: まだ点として残していない現在位置
+            bool m_hasHead = false;
+            float m_minSpacing = 0.0f;
+            float m_maxInterval = 0.0f;
+            float m_elapsed = 0.0f;         // 最後に点を残してからの経過時間
+            float m_travel = 0.0f;          // 最後に点を残してからの道のり
+            Vector2 m_last;                 // 前回 Push された位置
+            float m_tolerance = 0.0f;
         };
 
     } // namespace Effects
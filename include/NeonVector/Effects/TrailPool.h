@@ -0,0 +1,87 @@
+#pragma once
+
+#include <NeonVector/Math/Vector2.h>
+#include <NeonVector/Core/Types.h>
+#include <NeonVector/Core/PackedColor.h>
+#include <span>
+#include <vector>
+#include <cstdint>
+
+namespace NeonVector {
+    namespace Graphics { class LineBatcher; }
+
+    namespace Effects {
+
+        class OverLifeTable;
+
+        /** @brief TrailPool 内のトレイルの識別子（index = スロット番号） */
+        struct TrailHandle {
+            uint32_t index = ~0u;
+            uint32_t generation = 0;
+            bool IsValid() const { return index != ~0u; }
+        };
+
+        /**
+         * @class TrailPool
+         * @brief 多数のトレイルを 1 本の連続領域にまとめて持つ（弾幕の弾ごとの残光など）
+         *
+         * 各トレイルは pointsPerTrail 点の固定長リングバッファで、全スロット分を
+         * 構築時に 1 回だけ確保する。Create / Destroy / Push でヒープ確保は起きない。
+         * 見た目は Trail と同じ（先端ほど濃く太い）で、Draw は生存中の全トレイルの
+         * 線分を LineBatcher の頂点へ直接書く 1 パス。
+         */
+        class TrailPool {
+        public:
+            TrailPool(size_t maxTrails, size_t pointsPerTrail = 16);
+
+            /** @brief 空きスロットがなければ無効な handle */
+            TrailHandle Create(const Color& color, float thickness = 2.0f, float glow = 1.5f);
+            void Destroy(TrailHandle h);
+            bool IsAlive(TrailHandle h) const;
+
+            void Push(TrailHandle h, const Vector2& p);
+            /** @brief 点を捨てて空にする（スロットは保持） */
+            void Reset(TrailHandle h);
+            void SetColor(TrailHandle h, const Color& color);
+
+            /** @brief handles[i] に positions[i] を積む（無効な handle は飛ばす） */
+            void PushAll(std::span<const TrailHandle> handles, std::span<const Vector2> positions);
+            /** @brief スロット i に positions[i] を積む（未使用スロットの分は無視） */
+            void PushAll(std::span<const Vector2> positions);
+
+            /** @brief 全トレイルを破棄 */
+            void Clear();
+
+            void Draw(Graphics::LineBatcher* batcher) const;
+
+            /** @brief 長さ方向の色・α・太さの変化（nullptr = Trail と同じ既定の傾斜）。所有はしない */
+            void SetOverLife(const OverLifeTable* table) { m_overLife = table; }
+
+            size_t Count() const { return m_alive.size() - m_free.size(); }
+            size_t SlotCount() const { return m_alive.size(); }
+            size_t PointsPerTrail() const { return m_stride; }
+
+        private:
+            bool valid(TrailHandle h) const
+            {
+                return h.index < m_alive.size() && m_alive[h.index] && m_generation[h.index] == h.generation;
+            }
+            void push(uint32_t slot, const Vector2& p);
+
+        private:
+            size_t m_stride;                 // 1 トレイルの点数（リングの容量）
+            std::vector<Vector2> m_points;   // スロット s の点は [s * m_stride, (s + 1) * m_stride)
+            // スロット毎の状態（SoA）
+            std::vector<uint32_t> m_head;    // 最古の点の位置
+            std::vector<uint32_t> m_count;
+            std::vector<uint32_t> m_generation;
+            std::vector<uint8_t> m_alive;
+            std::vector<ColorRGBA8> m_color;
+            std::vector<float> m_thickness;
+            std::vector<float> m_glow;
+            std::vector<uint32_t> m_free;
+            const OverLifeTable* m_overLife = nullptr;
+        };
+
+    } // namespace Effects
+} // namespace NeonVector
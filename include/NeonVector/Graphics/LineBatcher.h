@@ -5,6 +5,7 @@
 #pragma once
 
 #include <NeonVector/Core/Types.h>
+#include <NeonVector/Core/PackedColor.h>
 #include <NeonVector/Math/Vector2.h>
 #include <d3d12.h>
 #include <dxgi1_6.h>
@@ -20,17 +21,17 @@ namespace NeonVector {
 
         /**
          * @struct LineVertex
-         * @brief 線描画用の頂点データ
+         * @brief 線描画用の頂点データ（20 バイト。色は R8G8B8A8_UNORM で渡す）
          */
         struct LineVertex {
             DirectX::XMFLOAT2 position;
-            DirectX::XMFLOAT4 color;
+            ColorRGBA8 color;
             float thickness;
             float glow;
 
             LineVertex()
                 : position(0.0f, 0.0f)
-                , color(1.0f, 1.0f, 1.0f, 1.0f)
+                , color()
                 , thickness(1.0f)
                 , glow(1.0f)
             {
@@ -39,7 +40,16 @@ namespace NeonVector {
             LineVertex(const Vector2& pos, const Color& col,
                 float thick = 1.0f, float glowVal = 1.0f)
                 : position(pos.x, pos.y)
-                , color(col.r, col.g, col.b, col.a)
+                , color(ColorRGBA8::FromColor(col))
+                , thickness(thick)
+                , glow(glowVal)
+            {
+            }
+
+            LineVertex(const Vector2& pos, ColorRGBA8 col,
+                float thick = 1.0f, float glowVal = 1.0f)
+                : position(pos.x, pos.y)
+                , color(col)
                 , thickness(thick)
                 , glow(glowVal)
             {
@@ -68,10 +78,47 @@ namespace NeonVector {
                 float thickness = 1.0f,
                 float glow = 1.0f);
 
+            void AddLine(const Vector2& start,
+                const Vector2& end,
+                ColorRGBA8 color,
+                float thickness = 1.0f,
+                float glow = 1.0f);
+
+            /** @brief 色を SetPalette で渡したパレットから引く（未設定なら白） */
+            void AddLine(const Vector2& start,
+                const Vector2& end,
+                PaletteIndex color,
+                float thickness = 1.0f,
+                float glow = 1.0f);
+
+            /**
+             * @brief PaletteIndex で指定した色を引くパレットを設定する（nullptr で解除）
+             *
+             * パレットは呼び出し側が所有し、使う間は生存させること。
+             */
+            void SetPalette(const ColorPalette* palette) { m_palette = palette; }
+            const ColorPalette* GetPalette() const { return m_palette; }
+
+            /**
+             * @brief count 本ぶんの頂点（2 * count 個）を確保し、先頭を返す
+             *
+             * 大量の線を自前のループ（並列可）で直接書き込むための経路。
+             * count は GetFreeLineCount() 以下であること（超えると nullptr）。
+             * 確保した領域は次の Flush までに全て書き込むこと。
+             */
+            LineVertex* AllocateLines(size_t count);
+
+            /** @brief AllocateLines で確保して使わなかった末尾 count 本を返す */
+            void ReleaseLines(size_t count);
+
             void Flush();
             void Clear();
 
             size_t GetLineCount() const { return m_vertexCount / 2; }
+            /** @brief 次の Flush で送る頂点（2 * GetLineCount() 個。Flush / Clear まで有効） */
+            const LineVertex* GetVertices() const { return m_vertices.data(); }
+            size_t GetFreeLineCount() const { return kMaxLines - m_vertexCount / 2; }
+            static constexpr size_t GetMaxLineCount() { return kMaxLines; }
             bool IsFull() const { return m_vertexCount >= kMaxVertices; }
 
             void UpdateScreenSize(int width, int height);
@@ -100,8 +147,9 @@ namespace NeonVector {
             ComPtr<ID3DBlob> m_vertexShader;
             ComPtr<ID3DBlob> m_pixelShader;
 
-            std::vector<LineVertex> m_vertices;
+            std::vector<LineVertex> m_vertices;   // kMaxVertices 固定長, 先頭 m_vertexCount 個が有効
             size_t m_vertexCount;
+            const ColorPalette* m_palette;
 
             int m_screenWidth;
             int m_screenHeight;
@@ -38,6 +38,16 @@ namespace NeonVector {
             const std::vector<Vector2>& points, const Color& color,
             bool closed = true, float thickness = 1.0f, float glow = 1.0f);
 
+        /**
+         * @brief 頂点列を tolerance px 以内のずれで間引いてから描く（読み込んだ輪郭など）
+         *
+         * 毎フレーム間引き直すので、形が変わらないなら Polyline::SimplifyRDP で
+         * 一度だけ間引いた頂点列を DrawPolygon に渡す方が安い。
+         */
+        void DrawPolygonSimplified(LineBatcher* batcher,
+            const std::vector<Vector2>& points, float tolerance, const Color& color,
+            bool closed = true, float thickness = 1.0f, float glow = 1.0f);
+
         /** @brief 正多角形（中心 + 外接半径 + 辺数, rotation ラジアン） */
         void DrawRegularPolygon(LineBatcher* batcher,
             const Vector2& center, float radius, int sides, const Color& color,
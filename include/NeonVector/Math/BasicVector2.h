@@ -0,0 +1,73 @@
+/**
+ * @file BasicVector2.h
+ * @brief スカラー型を選べる 2 次元ベクトル（float / Q16.16 固定小数点）
+ */
+#pragma once
+
+#include <NeonVector/Math/Scalar.h>
+#include <NeonVector/Math/Vector2.h>
+
+namespace NeonVector
+{
+
+    /**
+     * @struct BasicVector2
+     * @brief スカラー型 T の 2 次元ベクトル
+     *
+     * シミュレーションを float と固定小数点のどちらでも書けるようにするためのもの。
+     * メンバ名・意味は Vector2 と同じ（ColliderSweep などは両方をそのまま受け取れる）。
+     * 描画など float の Vector2 が要る所では ToVector2 で変換する。
+     */
+    template <class T>
+    struct BasicVector2
+    {
+        using Scalar = T;
+        using Traits = ScalarTraits<T>;
+
+        T x, y;
+
+        constexpr BasicVector2() : x(), y() {}
+        constexpr BasicVector2(T x, T y) : x(x), y(y) {}
+
+        static BasicVector2 FromVector2(const Vector2 &v) { return {Traits::FromFloat(v.x), Traits::FromFloat(v.y)}; }
+        Vector2 ToVector2() const { return {Traits::ToFloat(x), Traits::ToFloat(y)}; }
+
+        BasicVector2 operator+(const BasicVector2 &other) const { return {x + other.x, y + other.y}; }
+        BasicVector2 operator-(const BasicVector2 &other) const { return {x - other.x, y - other.y}; }
+        BasicVector2 operator-() const { return {-x, -y}; }
+        BasicVector2 operator*(T scalar) const { return {x * scalar, y * scalar}; }
+        BasicVector2 operator/(T scalar) const { return {x / scalar, y / scalar}; }
+        BasicVector2 &operator+=(const BasicVector2 &other) { return *this = *this + other; }
+        BasicVector2 &operator-=(const BasicVector2 &other) { return *this = *this - other; }
+
+        bool operator==(const BasicVector2 &other) const { return x == other.x && y == other.y; }
+        bool operator!=(const BasicVector2 &other) const { return !(*this == other); }
+
+        T Dot(const BasicVector2 &other) const { return x * other.x + y * other.y; }
+        T Cross(const BasicVector2 &other) const { return x * other.y - y * other.x; }
+        T LengthSquared() const { return x * x + y * y; }
+        T Length() const { return Traits::Sqrt(LengthSquared()); }
+
+        void Normalize()
+        {
+            const T len = Length();
+            if (len > Traits::Zero())
+            {
+                x = x / len;
+                y = y / len;
+            }
+        }
+
+        BasicVector2 Rotate(T c, T s) const { return {x * c - y * s, x * s + y * c}; }
+
+        static BasicVector2 FromAngle(T radians)
+        {
+            T s, c;
+            Traits::SinCos(radians, s, c);
+            return {c, s};
+        }
+    };
+
+    using FixedVector2 = BasicVector2<Fixed>;
+
+} // namespace NeonVector
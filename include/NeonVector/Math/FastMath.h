@@ -0,0 +1,312 @@
+#pragma once
+
+#include <NeonVector/Math/Simd.h>
+#include <NeonVector/Math/Vector2.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace NeonVector
+{
+    /**
+     * @namespace FastMath
+     * @brief ホットパス用の多項式近似（libm を呼ばない）
+     *
+     * どの関数にも精度の段階が 2 つある。
+     * - Accurate: float として十分な精度（誤差は各関数のコメント、数 ulp 程度）
+     * - Fast: 描画やエフェクト向け。多項式の次数を落として速さを優先する
+     *
+     * 呼び出し側で FastMath::SinCos<Precision::Fast>(...) のように選べる。指定しない
+     * 呼び出しは kDefaultPrecision（通常 Accurate。NEONVECTOR_FASTMATH_FAST を定義すると
+     * Fast）になる。配列版（Simd::Float4）はスカラー版と同じ手順で計算するので、SSE 環境では
+     * 結果がビット単位で一致する。
+     *
+     * ulp の値は float の全域ではなく、各関数のコメントにある範囲で double 版と比べた最大値。
+     */
+    namespace FastMath
+    {
+
+        enum class Precision : uint8_t
+        {
+            Accurate,
+            Fast,
+        };
+
+#if defined(NEONVECTOR_FASTMATH_FAST)
+        constexpr Precision kDefaultPrecision = Precision::Fast;
+#else
+        constexpr Precision kDefaultPrecision = Precision::Accurate;
+#endif
+
+        namespace Detail
+        {
+            // π/2 の Cody-Waite 3 分割（先頭 2 つは下位ビットが 0 なので j 倍しても誤差が出ない）
+            constexpr float kTwoOverPi = 0.636619772367581343f;
+            constexpr float kPiOver2A = 1.5703125f;
+            constexpr float kPiOver2B = 4.837512969970703125e-4f;
+            constexpr float kPiOver2C = 7.54978995489188216e-8f;
+
+            // [-π/4, π/4] の minimax 係数（Cephes sinf / cosf）
+            constexpr float kSin1 = -1.6666654611e-1f;
+            constexpr float kSin2 = 8.3321608736e-3f;
+            constexpr float kSin3 = -1.9515295891e-4f;
+            constexpr float kCos1 = 4.166664568298827e-2f;
+            constexpr float kCos2 = -1.388731625493765e-3f;
+            constexpr float kCos3 = 2.443315711809948e-5f;
+
+            // Fast 版: sin は 5 次、cos は 4 次の相対誤差 minimax
+            constexpr float kSinFast1 = -1.6663390384e-1f;
+            constexpr float kSinFast2 = 8.1632820503e-3f;
+            constexpr float kCosFast1 = -4.9976055736e-1f;
+            constexpr float kCosFast2 = 4.0458452824e-2f;
+
+            // atan: Accurate は Cephes atanf（[0, tan π/8] に縮めて 9 次）、Fast は [0, 1] で 7 次
+            constexpr float kTanPiOver8 = 0.4142135623730950f;
+            constexpr float kAtan1 = -3.33329491539e-1f;
+            constexpr float kAtan2 = 1.99777106478e-1f;
+            constexpr float kAtan3 = -1.38776856032e-1f;
+            constexpr float kAtan4 = 8.05374449538e-2f;
+            constexpr float kAtanFast0 = 9.9978856793e-1f;
+            constexpr float kAtanFast1 = -3.2581421152e-1f;
+            constexpr float kAtanFast2 = 1.5559026826e-1f;
+            constexpr float kAtanFast3 = -4.4333186835e-2f;
+            constexpr float kPi = 3.14159265358979f;
+            constexpr float kPiOver2 = 1.57079632679490f;
+            constexpr float kPiOver4 = 0.785398163397448f;
+
+            // 2^f（f ∈ [-0.5, 0.5]）: Accurate は Cephes exp2f の 6 次、Fast は 3 次
+            constexpr float kExp2_1 = 6.931472028550421e-1f;
+            constexpr float kExp2_2 = 2.402264791363012e-1f;
+            constexpr float kExp2_3 = 5.550332471162809e-2f;
+            constexpr float kExp2_4 = 9.618437357674640e-3f;
+            constexpr float kExp2_5 = 1.339887440266574e-3f;
+            constexpr float kExp2_6 = 1.535336188319500e-4f;
+            constexpr float kExp2Fast1 = 6.9328293267e-1f;
+            constexpr float kExp2Fast2 = 2.4221096790e-1f;
+            constexpr float kExp2Fast3 = 5.5008903050e-2f;
+            constexpr float kExp2Min = -126.0f;
+            constexpr float kExp2Max = 127.0f;
+
+            inline int RoundToInt(float x)
+            {
+                return static_cast<int>(x + (x >= 0.0f ? 0.5f : -0.5f));
+            }
+
+            inline float FromBits(uint32_t i)
+            {
+                float f;
+                std::memcpy(&f, &i, sizeof(f));
+                return f;
+            }
+
+            /** @brief [0, 1] の atan（Precision で多項式を切り替える） */
+            template <Precision P>
+            float AtanUnit(float t)
+            {
+                if constexpr (P == Precision::Accurate)
+                {
+                    float base = 0.0f;
+                    if (t > kTanPiOver8)
+                    {
+                        base = kPiOver4;
+                        t = (t - 1.0f) / (t + 1.0f);
+                    }
+                    const float z = t * t;
+                    return base + ((((kAtan4 * z + kAtan3) * z + kAtan2) * z + kAtan1) * z * t + t);
+                }
+                else
+                {
+                    const float z = t * t;
+                    return t * (kAtanFast0 + z * (kAtanFast1 + z * (kAtanFast2 + z * kAtanFast3)));
+                }
+            }
+
+            /**
+             * @brief 相対誤差 1e-3 程度以下の 1/sqrt 初期値（Rsqrt の Fast はこれをそのまま返す）
+             *
+             * SSE は rsqrtss（12bit）そのもの。NEON の vrsqrte は 8bit しかないので、
+             * vrsqrts でニュートン法を 1 回かけてから返す。どちらも無ければビット演算の値に 1 回。
+             */
+            inline float RsqrtEstimate(float x)
+            {
+#if defined(NEONVECTOR_SIMD_SSE)
+                return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#elif defined(NEONVECTOR_SIMD_NEON)
+                const float y = vrsqrtes_f32(x);
+                return y * vrsqrtss_f32(x * y, y);
+#else
+                // ビット演算による初期値（0x5f375a86）にニュートン法 1 回
+                uint32_t i;
+                std::memcpy(&i, &x, sizeof(i));
+                const float y = FromBits(0x5f375a86u - (i >> 1));
+                return y * (1.5f - 0.5f * x * y * y);
+#endif
+            }
+        }
+
+        /**
+         * @brief sin と cos を同時に求める
+         *
+         * Accurate は |x| ≤ π で最大 1.6 ulp。|x| が大きいと 0 をまたぐ付近の ulp 誤差が
+         * 増えるが、|x| ≤ 1e4 でも絶対誤差は 1e-7 程度に収まる。Fast は相対誤差 1.5e-5
+         * （約 230 ulp）。象限で振り分けるだけで分岐が少なく、libm の sin + cos より速い。
+         */
+        template <Precision P = kDefaultPrecision>
+        void SinCos(float x, float &s, float &c)
+        {
+            using namespace Detail;
+            const int j = RoundToInt(x * kTwoOverPi);
+            const float fj = static_cast<float>(j);
+            const float r = ((x - fj * kPiOver2A) - fj * kPiOver2B) - fj * kPiOver2C;
+            const float r2 = r * r;
+
+            float ps, pc;
+            if constexpr (P == Precision::Accurate)
+            {
+                ps = r + r * r2 * (kSin1 + r2 * (kSin2 + r2 * kSin3));
+                pc = 1.0f - 0.5f * r2 + r2 * r2 * (kCos1 + r2 * (kCos2 + r2 * kCos3));
+            }
+            else
+            {
+                ps = r + r * r2 * (kSinFast1 + r2 * kSinFast2);
+                pc = 1.0f + r2 * (kCosFast1 + r2 * kCosFast2);
+            }
+
+            switch (j & 3)
+            {
+            case 0: s = ps;  c = pc;  break;
+            case 1: s = pc;  c = -ps; break;
+            case 2: s = -ps; c = -pc; break;
+            default: s = -pc; c = ps; break;
+            }
+        }
+
+        /**
+         * @brief atan2(y, x)（戻り値は [-π, π]）
+         *
+         * Accurate は最大 3.1 ulp、Fast は絶対誤差 1.7e-4 rad（約 0.01°、最大 3500 ulp 程度）。
+         * x = y = 0 のときは ±0 か ±π（std::atan2 と同じ）。
+         */
+        template <Precision P = kDefaultPrecision>
+        float Atan2(float y, float x)
+        {
+            using namespace Detail;
+            const float ax = std::fabs(x), ay = std::fabs(y);
+            const float hi = std::max(ax, ay), lo = std::min(ax, ay);
+            const float t = (hi > 0.0f) ? lo / hi : 0.0f;
+            float a = AtanUnit<P>(t);
+            if (ay > ax)
+                a = kPiOver2 - a;
+            if (std::signbit(x))
+                a = kPi - a;
+            return std::copysign(a, y);
+        }
+
+        /**
+         * @brief 2^x
+         *
+         * Accurate は最大 1.2 ulp、Fast は相対誤差 1.1e-4（約 1350 ulp）。x は [-126, 127] に丸める
+         * （結果が正規化数の範囲に収まる。2^-126 より小さい値や無限大は返さない）。
+         */
+        template <Precision P = kDefaultPrecision>
+        float Exp2(float x)
+        {
+            using namespace Detail;
+            const float xc = std::min(std::max(x, kExp2Min), kExp2Max);
+            const int j = RoundToInt(xc);
+            const float f = xc - static_cast<float>(j);
+            float p;
+            if constexpr (P == Precision::Accurate)
+                p = 1.0f + f * (kExp2_1 + f * (kExp2_2 + f * (kExp2_3 + f * (kExp2_4 + f * (kExp2_5 + f * kExp2_6)))));
+            else
+                p = 1.0f + f * (kExp2Fast1 + f * (kExp2Fast2 + f * kExp2Fast3));
+            return p * FromBits(static_cast<uint32_t>(j + 127) << 23);
+        }
+
+        /**
+         * @struct ConstPow
+         * @brief 底が固定の累乗 base^y（log2(base) を先に求めておき、以後は Exp2 だけ）
+         *
+         * 抵抗の pow(drag, dt) のように底が変わらず指数だけが毎回変わる用途向け。
+         * 誤差は Exp2 の誤差に、y * log2(base) の丸め（|y * log2(base)| に比例）が加わる
+         * （0.98^dt, dt ≤ 1/15 で 0.6 ulp、10^y, |y| ≤ 5 で 16 ulp）。base は正であること。
+         */
+        struct ConstPow
+        {
+            float log2Base = 0.0f;
+
+            ConstPow() = default;
+            explicit ConstPow(float base) : log2Base(std::log2(base)) {}
+
+            template <Precision P = kDefaultPrecision>
+            float Eval(float y) const { return Exp2<P>(y * log2Base); }
+
+            /** @brief out[i] = base^y[i] */
+            template <Precision P = kDefaultPrecision>
+            void Eval(const float *y, float *out, size_t count) const;
+        };
+
+        /**
+         * @brief 1/sqrt(x)（x > 0）
+         *
+         * Fast は命令セットごとの初期値（Detail::RsqrtEstimate）をそのまま返し、Accurate は
+         * それにニュートン法をもう 1 回かける。精度は初期値の作り方で変わる:
+         * - SSE: Fast は rsqrtss のみで相対誤差 3.3e-4（12bit、約 5000 ulp）、Accurate は最大 4 ulp
+         * - NEON: vrsqrte（8bit）にニュートン法 1 回済みなので、Fast でも相対誤差 2.5e-5 程度
+         *   （理論値）。Accurate は 2 回目のニュートン法で SSE と同程度になる
+         * - どちらも無い環境: 初期値をビット演算とニュートン法 1 回で作るので粗くなり、Fast で
+         *   相対誤差 1.8e-3、Accurate でも 4.8e-6（約 80 ulp）に留まる（1/std::sqrt と同じ精度にはならない）
+         */
+        template <Precision P = kDefaultPrecision>
+        float Rsqrt(float x)
+        {
+            const float y = Detail::RsqrtEstimate(x);
+            if constexpr (P == Precision::Accurate)
+                return y * (1.5f - 0.5f * x * y * y);
+            else
+                return y;
+        }
+
+        /**
+         * @brief v / |v|（Rsqrt を使う）。長さがほぼ 0 ならそのまま返す
+         *
+         * 各成分の誤差は SSE で Accurate 最大 5 ulp、Fast で相対 3.3e-4（他の環境は Rsqrt の段階に従う）。
+         */
+        template <Precision P = kDefaultPrecision>
+        Vector2 Normalize(const Vector2 &v)
+        {
+            const float len2 = v.x * v.x + v.y * v.y;
+            if (!(len2 >= 1.17549435e-38f))
+                return v;
+            const float inv = Rsqrt<P>(len2);
+            return {v.x * inv, v.y * inv};
+        }
+
+        /**
+         * @brief count 個の角度から sin / cos をまとめて求める（Simd::Float4 で 4 要素ずつ）
+         *
+         * 結果はスカラー版 SinCos と一致する。s / c は angles と重なってはならない。
+         */
+        template <Precision P = kDefaultPrecision>
+        void SinCos(const float *angles, float *s, float *c, size_t count);
+
+        /** @brief out[i] = Atan2(y[i], x[i]) */
+        template <Precision P = kDefaultPrecision>
+        void Atan2(const float *y, const float *x, float *out, size_t count);
+
+        /** @brief out[i] = Exp2(x[i])（out は x と同じ配列でもよい） */
+        template <Precision P = kDefaultPrecision>
+        void Exp2(const float *x, float *out, size_t count);
+
+        /** @brief out[i] = Rsqrt(x[i])（out は x と同じ配列でもよい） */
+        template <Precision P = kDefaultPrecision>
+        void Rsqrt(const float *x, float *out, size_t count);
+
+        /** @brief out[i] = Normalize(in[i])（out は in と同じ配列でもよい） */
+        template <Precision P = kDefaultPrecision>
+        void Normalize(const Vector2 *in, Vector2 *out, size_t count);
+
+    } // namespace FastMath
+} // namespace NeonVector
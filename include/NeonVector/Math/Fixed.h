@@ -0,0 +1,138 @@
+/**
+ * @file Fixed.h
+ * @brief Q16.16 固定小数点数と、その三角関数・平方根・冪乗
+ */
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+
+namespace NeonVector
+{
+
+    /**
+     * @class Fixed
+     * @brief Q16.16 の固定小数点数（int32 の生値 / 65536）
+     *
+     * 全ての演算は整数演算だけで行うので、コンパイラ・SIMD の有無・最適化設定に関係なく
+     * 同じ入力から同じビット列が出る（リプレイ・ロックステップ用）。
+     * 表せる範囲は ±32768、刻みは 1/65536。加減算は 2 の補数で巻き戻り、乗算は最近接丸め、
+     * 除算は 0 方向への切り捨て（0 除算は呼び出し側で避けること）。
+     *
+     * 二乗が 32768 を超えると巻き戻るので、長さの二乗を扱う計算（衝突判定など）は
+     * 1 単位 = 数十 px 程度のワールド単位で行うこと。
+     */
+    class Fixed
+    {
+    public:
+        static constexpr int kFracBits = 16;
+        static constexpr int32_t kOneRaw = 1 << kFracBits;
+
+        constexpr Fixed() : m_raw(0) {}
+
+        static constexpr Fixed FromRaw(int32_t raw)
+        {
+            Fixed f;
+            f.m_raw = raw;
+            return f;
+        }
+
+        static constexpr Fixed FromInt(int v) { return FromRaw(static_cast<int32_t>(static_cast<uint32_t>(v) << kFracBits)); }
+
+        /** @brief float → 固定小数点（最近接丸め、範囲外は飽和）。設定値の取り込み用 */
+        static Fixed FromFloat(float v)
+        {
+            const double scaled = std::floor(static_cast<double>(v) * kOneRaw + 0.5);   // double なら 2^16 倍も +0.5 も正確
+            if (!(scaled > -2147483648.0))
+                return FromRaw(INT32_MIN);
+            if (scaled > 2147483647.0)
+                return FromRaw(INT32_MAX);
+            return FromRaw(static_cast<int32_t>(scaled));
+        }
+
+        constexpr int32_t Raw() const { return m_raw; }
+        constexpr float ToFloat() const { return static_cast<float>(m_raw) * (1.0f / kOneRaw); }
+        /** @brief 整数部（-∞ 方向への切り捨て） */
+        constexpr int ToInt() const { return m_raw >> kFracBits; }
+
+        static constexpr Fixed Zero() { return FromRaw(0); }
+        static constexpr Fixed One() { return FromRaw(kOneRaw); }
+        static constexpr Fixed Half() { return FromRaw(kOneRaw / 2); }
+        static constexpr Fixed Pi() { return FromRaw(205887); }
+        static constexpr Fixed TwoPi() { return FromRaw(411775); }
+        static constexpr Fixed HalfPi() { return FromRaw(102944); }
+        /** @brief 表せる最小の正の値 */
+        static constexpr Fixed Epsilon() { return FromRaw(1); }
+
+        constexpr Fixed operator+(Fixed o) const { return FromRaw(wrap(static_cast<uint32_t>(m_raw) + static_cast<uint32_t>(o.m_raw))); }
+        constexpr Fixed operator-(Fixed o) const { return FromRaw(wrap(static_cast<uint32_t>(m_raw) - static_cast<uint32_t>(o.m_raw))); }
+        constexpr Fixed operator-() const { return FromRaw(wrap(0u - static_cast<uint32_t>(m_raw))); }
+
+        constexpr Fixed operator*(Fixed o) const
+        {
+            const int64_t p = static_cast<int64_t>(m_raw) * o.m_raw + (int64_t(1) << (kFracBits - 1));
+            return FromRaw(wrap(static_cast<uint32_t>(static_cast<uint64_t>(p >> kFracBits))));
+        }
+
+        constexpr Fixed operator/(Fixed o) const
+        {
+            const int64_t q = (static_cast<int64_t>(m_raw) * kOneRaw) / o.m_raw;
+            return FromRaw(wrap(static_cast<uint32_t>(static_cast<uint64_t>(q))));
+        }
+
+        constexpr Fixed operator*(int k) const { return FromRaw(wrap(static_cast<uint32_t>(m_raw) * static_cast<uint32_t>(k))); }
+
+        constexpr Fixed &operator+=(Fixed o) { return *this = *this + o; }
+        constexpr Fixed &operator-=(Fixed o) { return *this = *this - o; }
+        constexpr Fixed &operator*=(Fixed o) { return *this = *this * o; }
+        constexpr Fixed &operator/=(Fixed o) { return *this = *this / o; }
+
+        constexpr bool operator==(const Fixed &o) const = default;
+        constexpr auto operator<=>(const Fixed &o) const = default;
+
+    private:
+        // uint32 → int32 の 2 の補数としての読み替え（C++20 で定義済みの変換）
+        static constexpr int32_t wrap(uint32_t v) { return static_cast<int32_t>(v); }
+
+        int32_t m_raw;
+    };
+
+    static_assert(sizeof(Fixed) == 4, "Fixed は int32 と同じ大きさであること");
+
+    inline Fixed Abs(Fixed v) { return (v.Raw() < 0) ? -v : v; }
+    inline Fixed Min(Fixed a, Fixed b) { return (b < a) ? b : a; }
+    inline Fixed Max(Fixed a, Fixed b) { return (a < b) ? b : a; }
+
+    /** @brief 平方根（負は 0。整数の開平なので結果は切り捨て、誤差 1/65536 未満） */
+    Fixed Sqrt(Fixed v);
+
+    /**
+     * @brief Q32.32 の生値（Fixed 同士の積を 2^16 で割らずに持ったもの）の平方根
+     *
+     * 距離の 2 乗のように Q16.16 に収まらない値の平方根を求める。負は 0、
+     * 結果が Fixed に収まらなければ最大値に飽和する。
+     */
+    Fixed SqrtWide(int64_t q32);
+
+    /**
+     * @brief sin / cos（ラジアン）
+     *
+     * 角度を 1 周 = 2^32 の整数角に直し、1/4 周 257 点の表を線形補間する。
+     * 誤差は 2/65536 以内。表はコンパイル時に作るので実行環境に依らない。
+     */
+    void SinCos(Fixed radians, Fixed &s, Fixed &c);
+    Fixed Sin(Fixed radians);
+    Fixed Cos(Fixed radians);
+
+    /** @brief atan2（-π..π。atan2(0, 0) = 0）。誤差 2/65536 以内 */
+    Fixed Atan2(Fixed y, Fixed x);
+
+    /**
+     * @brief base^exponent（base が 0 以下なら 0）
+     *
+     * log2 と exp2 を 30bit の整数演算で求めるので実行環境に依らない。
+     * 誤差は結果が 1 以下なら 1/65536 以内、1 を超えれば相対 2^-17 程度。Fixed に収まらなければ最大値に飽和する。
+     */
+    Fixed Pow(Fixed base, Fixed exponent);
+
+} // namespace NeonVector
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace NeonVector
+{
+    /**
+     * @namespace Polyline
+     * @brief 折れ線の簡略化（ほぼ一直線に並んだ点を間引いて線分数を減らす）
+     *
+     * どれも [first, last) をその場で詰めて新しい終端を返す（std::remove と同じ作法。
+     * 呼び出し側が erase(newEnd, end) する）。両端の点は必ず残す。
+     * 点の型は x / y メンバ（float）を持てばよく、Vector2 以外の構造体も渡せる。
+     * 作業領域はスレッド毎に使い回すので、点数が増えない限り確保は起きない。
+     */
+    namespace Polyline
+    {
+
+        namespace Detail
+        {
+            inline std::vector<uint8_t> &KeepScratch()
+            {
+                static thread_local std::vector<uint8_t> keep;
+                return keep;
+            }
+
+            inline std::vector<std::pair<uint32_t, uint32_t>> &RangeScratch()
+            {
+                static thread_local std::vector<std::pair<uint32_t, uint32_t>> ranges;
+                return ranges;
+            }
+
+            struct VwNode
+            {
+                float area;
+                int32_t prev;
+                int32_t next;
+            };
+
+            inline std::vector<VwNode> &NodeScratch()
+            {
+                static thread_local std::vector<VwNode> nodes;
+                return nodes;
+            }
+
+            inline std::vector<std::pair<float, uint32_t>> &HeapScratch()
+            {
+                static thread_local std::vector<std::pair<float, uint32_t>> heap;
+                return heap;
+            }
+
+            /** @brief 点 p から線分 ab までの距離の 2 乗 */
+            template <class P>
+            float SegmentDistanceSq(const P &p, const P &a, const P &b)
+            {
+                const float abx = b.x - a.x, aby = b.y - a.y;
+                const float apx = p.x - a.x, apy = p.y - a.y;
+                const float len2 = abx * abx + aby * aby;
+                float t = (len2 > 0.0f) ? (apx * abx + apy * aby) / len2 : 0.0f;
+                t = std::min(std::max(t, 0.0f), 1.0f);
+                const float dx = apx - abx * t, dy = apy - aby * t;
+                return dx * dx + dy * dy;
+            }
+
+            /** @brief 三角形 abc の面積 */
+            template <class P>
+            float TriangleArea(const P &a, const P &b, const P &c)
+            {
+                const float cross = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+                return 0.5f * (cross < 0.0f ? -cross : cross);
+            }
+
+            /** @brief keep[i] != 0 の点だけを前へ詰める */
+            template <class RandomIt>
+            RandomIt Compact(RandomIt first, size_t n, const std::vector<uint8_t> &keep)
+            {
+                size_t w = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    if (!keep[i])
+                        continue;
+                    if (w != i)
+                        first[w] = std::move(first[i]);
+                    ++w;
+                }
+                return first + static_cast<std::ptrdiff_t>(w);
+            }
+        }
+
+        /**
+         * @brief Ramer–Douglas–Peucker 法
+         *
+         * 元の各点から簡略化後の折れ線までの距離が tolerance（px）以内に収まる。
+         * 再帰の代わりに区間のスタックを使う（長い輪郭でもスタックを食わない）。
+         */
+        template <class RandomIt>
+        RandomIt SimplifyRDP(RandomIt first, RandomIt last, float tolerance)
+        {
+            const size_t n = static_cast<size_t>(std::distance(first, last));
+            if (n < 3 || tolerance <= 0.0f)
+                return last;
+
+            std::vector<uint8_t> &keep = Detail::KeepScratch();
+            std::vector<std::pair<uint32_t, uint32_t>> &ranges = Detail::RangeScratch();
+            keep.assign(n, 0);
+            keep[0] = keep[n - 1] = 1;
+            ranges.clear();
+            ranges.emplace_back(0u, static_cast<uint32_t>(n - 1));
+
+            const float tol2 = tolerance * tolerance;
+            while (!ranges.empty())
+            {
+                const auto [a, b] = ranges.back();
+                ranges.pop_back();
+                if (b <= a + 1)
+                    continue;
+
+                // 弦 a-b から最も離れた点を探す
+                float worst = -1.0f;
+                uint32_t at = a;
+                for (uint32_t i = a + 1; i < b; ++i)
+                {
+                    const float d = Detail::SegmentDistanceSq(first[i], first[a], first[b]);
+                    if (d > worst)
+                    {
+                        worst = d;
+                        at = i;
+                    }
+                }
+                if (worst > tol2)
+                {
+                    keep[at] = 1;
+                    ranges.emplace_back(a, at);
+                    ranges.emplace_back(at, b);
+                }
+            }
+            return Detail::Compact(first, n, keep);
+        }
+
+        /**
+         * @brief Visvalingam–Whyatt 法
+         *
+         * 前後の点と作る三角形の面積（有効面積）が最小の点から順に取り除き、
+         * 残りがすべて minArea（px^2）以上になったら止める。RDP より形の「面」が
+         * 保たれやすく、細かい凹凸から先に消える。tolerance px 相当にしたいときは
+         * minArea = tolerance^2 程度が目安。
+         */
+        template <class RandomIt>
+        RandomIt SimplifyVisvalingam(RandomIt first, RandomIt last, float minArea)
+        {
+            const size_t n = static_cast<size_t>(std::distance(first, last));
+            if (n < 3 || minArea <= 0.0f)
+                return last;
+
+            std::vector<Detail::VwNode> &nodes = Detail::NodeScratch();
+            std::vector<std::pair<float, uint32_t>> &heap = Detail::HeapScratch();
+            std::vector<uint8_t> &keep = Detail::KeepScratch();
+            nodes.resize(n);
+            keep.assign(n, 1);
+            heap.clear();
+
+            // 最小ヒープ（面積, 添字）。面積が更新された古い要素は取り出し時に読み捨てる
+            auto greater = [](const std::pair<float, uint32_t> &l, const std::pair<float, uint32_t> &r)
+            { return l.first > r.first; };
+            for (size_t i = 0; i < n; ++i)
+            {
+                nodes[i].prev = static_cast<int32_t>(i) - 1;
+                nodes[i].next = (i + 1 < n) ? static_cast<int32_t>(i + 1) : -1;
+                nodes[i].area = (i == 0 || i + 1 == n)
+                                    ? 0.0f
+                                    : Detail::TriangleArea(first[i - 1], first[i], first[i + 1]);
+                if (i != 0 && i + 1 != n)
+                    heap.emplace_back(nodes[i].area, static_cast<uint32_t>(i));
+            }
+            std::make_heap(heap.begin(), heap.end(), greater);
+
+            auto update = [&](int32_t i, float floorArea)
+            {
+                Detail::VwNode &node = nodes[static_cast<size_t>(i)];
+                if (node.prev < 0 || node.next < 0)
+                    return; // 端点は動かさない
+                const float area = Detail::TriangleArea(first[node.prev], first[i], first[node.next]);
+                // 面積が前に消した点より小さくならないようにする（消す順序の単調性）
+                node.area = std::max(area, floorArea);
+                heap.emplace_back(node.area, static_cast<uint32_t>(i));
+                std::push_heap(heap.begin(), heap.end(), greater);
+            };
+
+            while (!heap.empty())
+            {
+                std::pop_heap(heap.begin(), heap.end(), greater);
+                const auto [area, i] = heap.back();
+                heap.pop_back();
+                if (!keep[i] || area != nodes[i].area)
+                    continue; // 取り除き済み or 古い面積
+                if (area >= minArea)
+                    break;
+
+                keep[i] = 0;
+                const int32_t prev = nodes[i].prev, next = nodes[i].next;
+                nodes[static_cast<size_t>(prev)].next = next;
+                nodes[static_cast<size_t>(next)].prev = prev;
+                update(prev, area);
+                update(next, area);
+            }
+            return Detail::Compact(first, n, keep);
+        }
+
+        /**
+         * @brief 伸び続ける折れ線の追記分だけを RDP で簡略化する
+         *
+         * [first, tailBegin) は簡略化済みとして触らず、その最後の点を固定端にして
+         * [tailBegin, last) を間引く。毎フレーム全体をやり直す代わりに使う
+         * （コストは追記分の長さだけで決まる）。
+         */
+        template <class RandomIt>
+        RandomIt SimplifyTail(RandomIt first, RandomIt tailBegin, RandomIt last, float tolerance)
+        {
+            if (tailBegin == first)
+                return SimplifyRDP(first, last, tolerance);
+            return SimplifyRDP(tailBegin - 1, last, tolerance);
+        }
+
+    } // namespace Polyline
+} // namespace NeonVector
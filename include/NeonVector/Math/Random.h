@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NeonVector
+{
+
+    /**
+     * @class Random
+     * @brief カウンタベースの高速乱数（SplitMix64 系）
+     *
+     * i 番目の出力は Mix(key + i * gamma) で決まる（状態はカウンタだけ）。
+     * そのため任意位置へのジャンプ・巻き戻しができ、同じ seed なら必ず同じ列になる。
+     * stream ごとに gamma（奇数）を変えるので、スレッド毎の独立したストリームが作れる。
+     */
+    class Random
+    {
+    public:
+        explicit Random(uint64_t seed = 0, uint64_t stream = 0) { Seed(seed, stream); }
+
+        void Seed(uint64_t seed, uint64_t stream = 0)
+        {
+            m_key = Mix(seed);
+            m_gamma = Mix(stream + kGolden) | 1u;   // 奇数なら周期 2^64
+            m_counter = 0;
+        }
+
+        /** @brief 同じ seed から独立したストリームを作る（スレッド毎・用途毎） */
+        Random Stream(uint64_t stream) const
+        {
+            Random r;
+            r.m_key = m_key;
+            r.m_gamma = Mix(stream + kGolden) | 1u;
+            return r;
+        }
+
+        uint64_t NextU64() { return At(m_counter++); }
+        uint32_t NextU32() { return static_cast<uint32_t>(NextU64() >> 32); }
+
+        /** @brief [0, 1) の一様乱数（24bit 精度） */
+        float NextFloat() { return ToUnitFloat(NextU64()); }
+
+        /** @brief [lo, hi) の一様乱数 */
+        float Range(float lo, float hi) { return lo + (hi - lo) * NextFloat(); }
+
+        /**
+         * @brief [lo, hi) の一様乱数を count 個まとめて書く
+         *
+         * 各要素は互いに独立に計算できる（依存チェーンなし）のでループがよく回る。
+         * NextFloat を count 回呼んだのと同じ値になる。
+         */
+        void FillUniform(float *out, size_t count, float lo = 0.0f, float hi = 1.0f)
+        {
+            const float scale = hi - lo;
+            const uint64_t base = m_counter;
+            for (size_t i = 0; i < count; ++i)
+                out[i] = lo + scale * ToUnitFloat(At(base + i));
+            m_counter += count;
+        }
+
+        /** @brief 現在位置（リプレイ用の保存・復元） */
+        uint64_t GetCounter() const { return m_counter; }
+        void SetCounter(uint64_t counter) { m_counter = counter; }
+
+        /** @brief 64bit ハッシュ（SplitMix64 の出力関数） */
+        static uint64_t Mix(uint64_t z)
+        {
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+    private:
+        static constexpr uint64_t kGolden = 0x9E3779B97F4A7C15ull;
+
+        uint64_t At(uint64_t counter) const { return Mix(m_key + counter * m_gamma); }
+
+        static float ToUnitFloat(uint64_t bits)
+        {
+            return static_cast<float>(bits >> 40) * (1.0f / 16777216.0f);
+        }
+
+        uint64_t m_key = 0;
+        uint64_t m_gamma = kGolden;
+        uint64_t m_counter = 0;
+    };
+
+} // namespace NeonVector
@@ -0,0 +1,87 @@
+/**
+ * @file Scalar.h
+ * @brief シミュレーションのスカラー型（float / Fixed）を切り替えるための型特性
+ */
+#pragma once
+
+#include <NeonVector/Math/Fixed.h>
+#include <NeonVector/Math/FastMath.h>
+#include <cmath>
+#include <cstdint>
+
+namespace NeonVector
+{
+
+    /**
+     * @struct ScalarTraits
+     * @brief テンプレート化したシミュレーションコードが使う、スカラー型ごとの演算
+     *
+     * float 版は速さ優先（処理系・SIMD 経路で結果が変わりうる）、
+     * Fixed 版は整数演算だけで決定的（リプレイ・ロックステップ向け）。
+     */
+    template <class T>
+    struct ScalarTraits;
+
+    template <>
+    struct ScalarTraits<float>
+    {
+        static constexpr bool kDeterministic = false;
+
+        static constexpr float Zero() { return 0.0f; }
+        static constexpr float One() { return 1.0f; }
+        static constexpr float TwoPi() { return 6.28318530718f; }
+        static float FromFloat(float v) { return v; }
+        static float ToFloat(float v) { return v; }
+        /** @brief 乱数の 32bit → [0, 1) */
+        static float FromUnitBits(uint32_t bits) { return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f); }
+        /** @brief 判定に使う小さな閾値（float はそのまま） */
+        static float Tolerance(float v) { return v; }
+
+        static float Abs(float v) { return std::fabs(v); }
+        static float Sqrt(float v) { return std::sqrt(v); }
+
+        /** @brief 積を溢れさせずに持つ型（float はそのまま float） */
+        using Wide = float;
+        static Wide MulWide(float a, float b) { return a * b; }
+        static float SqrtWide(Wide v) { return std::sqrt(v); }
+        static void SinCos(float radians, float &s, float &c) { FastMath::SinCos(radians, s, c); }
+        static float Atan2(float y, float x) { return FastMath::Atan2(y, x); }
+        static float Pow(float base, float exponent) { return std::pow(base, exponent); }
+    };
+
+    template <>
+    struct ScalarTraits<Fixed>
+    {
+        static constexpr bool kDeterministic = true;
+
+        static constexpr Fixed Zero() { return Fixed::Zero(); }
+        static constexpr Fixed One() { return Fixed::One(); }
+        static constexpr Fixed TwoPi() { return Fixed::TwoPi(); }
+        static Fixed FromFloat(float v) { return Fixed::FromFloat(v); }
+        static float ToFloat(Fixed v) { return v.ToFloat(); }
+        static Fixed FromUnitBits(uint32_t bits) { return Fixed::FromRaw(static_cast<int32_t>(bits >> 16)); }
+        /** @brief 0 に丸まる閾値は最小の正の値に（「|x| < ε」が「x == 0」になるように） */
+        static Fixed Tolerance(float v)
+        {
+            const Fixed f = Fixed::FromFloat(v);
+            return (f < Fixed::Epsilon()) ? Fixed::Epsilon() : f;
+        }
+
+        static Fixed Abs(Fixed v) { return NeonVector::Abs(v); }
+        static Fixed Sqrt(Fixed v) { return NeonVector::Sqrt(v); }
+
+        /**
+         * @brief 積を溢れさせずに持つ型（Q32.32 の生値）
+         *
+         * Q16.16 は ±32768 までなので、181 を超える長さの 2 乗は Fixed では溢れる。
+         * 距離の 2 乗の比較や平方根はこちらで行う。
+         */
+        using Wide = int64_t;
+        static Wide MulWide(Fixed a, Fixed b) { return static_cast<int64_t>(a.Raw()) * b.Raw(); }
+        static Fixed SqrtWide(Wide v) { return NeonVector::SqrtWide(v); }
+        static void SinCos(Fixed radians, Fixed &s, Fixed &c) { NeonVector::SinCos(radians, s, c); }
+        static Fixed Atan2(Fixed y, Fixed x) { return NeonVector::Atan2(y, x); }
+        static Fixed Pow(Fixed base, Fixed exponent) { return NeonVector::Pow(base, exponent); }
+    };
+
+} // namespace NeonVector
@@ -0,0 +1,621 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// 命令セットの選択: x64 は SSE2 が常にあるので SSE を基本にし、/arch:AVX 等で AVX が
+// 有効なら Float8 を 256bit 1 本で持つ。AArch64 は NEON。どれもなければスカラー。
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NEONVECTOR_SIMD_SSE 1
+#if defined(__AVX__)
+#include <immintrin.h>
+#define NEONVECTOR_SIMD_AVX 1
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define NEONVECTOR_SIMD_NEON 1
+#endif
+
+namespace NeonVector
+{
+    /**
+     * @namespace Simd
+     * @brief 4 / 8 レーンの float を命令セットに依らず扱う薄いラッパ
+     *
+     * 四則演算・sqrt・min/max・比較と選択だけを提供する。どれも IEEE の丸めが
+     * スカラー演算と同じ命令なので、同じ順序で計算すればスカラー版とビット単位で一致する
+     * （近似の rcp は意図的に含めない。RsqrtEstimate だけは FastMath 用の例外で、値が命令セットで変わる）。
+     *
+     * Int4 は 32bit 整数 4 レーン。FastMath の範囲縮約（丸め・象限・指数部の組み立て）と
+     * ColorBatch の 8bit / 16bit 変換に要る分だけの整数演算・幅の変換と、Float4 とのビット単位の
+     * 相互変換を持つ。Load / Store は 16 バイトをそのまま読み書きする（8bit や 16bit の列もこれで運ぶ）。
+     * 比較の結果（マスク）は、条件を満たすレーンの全ビットが 1 になる。
+     */
+    namespace Simd
+    {
+
+        struct Float4
+        {
+#if defined(NEONVECTOR_SIMD_SSE)
+            __m128 v;
+#elif defined(NEONVECTOR_SIMD_NEON)
+            float32x4_t v;
+#else
+            float v[4];
+#endif
+            static constexpr size_t kWidth = 4;
+
+            static Float4 Load(const float *p)
+            {
+#if defined(NEONVECTOR_SIMD_SSE)
+                return {_mm_loadu_ps(p)};
+#elif defined(NEONVECTOR_SIMD_NEON)
+                return {vld1q_f32(p)};
+#else
+                return {{p[0], p[1], p[2], p[3]}};
+#endif
+            }
+
+            static Float4 Set1(float s)
+            {
+#if defined(NEONVECTOR_SIMD_SSE)
+                return {_mm_set1_ps(s)};
+#elif defined(NEONVECTOR_SIMD_NEON)
+                return {vdupq_n_f32(s)};
+#else
+                return {{s, s, s, s}};
+#endif
+            }
+
+            void Store(float *p) const
+            {
+#if defined(NEONVECTOR_SIMD_SSE)
+                _mm_storeu_ps(p, v);
+#elif defined(NEONVECTOR_SIMD_NEON)
+                vst1q_f32(p, v);
+#else
+                for (size_t i = 0; i < 4; ++i)
+                    p[i] = v[i];
+#endif
+            }
+        };
+
+        struct Int4
+        {
+#if defined(NEONVECTOR_SIMD_SSE)
+            __m128i v;
+#elif defined(NEONVECTOR_SIMD_NEON)
+            int32x4_t v;
+#else
+            int32_t v[4];
+#endif
+            static constexpr size_t kWidth = 4;
+
+            static Int4 Set1(int32_t s)
+            {
+#if defined(NEONVECTOR_SIMD_SSE)
+                return {_mm_set1_epi32(s)};
+#elif defined(NEONVECTOR_SIMD_NEON)
+                return {vdupq_n_s32(s)};
+#else
+                return {{s, s, s, s}};
+#endif
+            }
+
+            /** @brief 16 バイト（境界は問わない） */
+            static Int4 Load(const void *p)
+            {
+#if defined(NEONVECTOR_SIMD_SSE)
+                return {_mm_loadu_si128(static_cast<const __m128i *>(p))};
+#elif defined(NEONVECTOR_SIMD_NEON)
+                return {vreinterpretq_s32_u8(vld1q_u8(static_cast<const uint8_t *>(p)))};
+#else
+                Int4 r;
+                std::memcpy(r.v, p, sizeof(r.v));
+                return r;
+#endif
+            }
+
+            void Store(void *p) const
+            {
+#if defined(NEONVECTOR_SIMD_SSE)
+                _mm_storeu_si128(static_cast<__m128i *>(p), v);
+#elif defined(NEONVECTOR_SIMD_NEON)
+                vst1q_u8(static_cast<uint8_t *>(p), vreinterpretq_u8_s32(v));
+#else
+                std::memcpy(p, v, sizeof(v));
+#endif
+            }
+        };
+
+#if defined(NEONVECTOR_SIMD_SSE)
+        inline Float4 operator+(Float4 a, Float4 b) { return {_mm_add_ps(a.v, b.v)}; }
+        inline Float4 operator-(Float4 a, Float4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+        inline Float4 operator*(Float4 a, Float4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+        inline Float4 operator/(Float4 a, Float4 b) { return {_mm_div_ps(a.v, b.v)}; }
+        inline Float4 Sqrt(Float4 a) { return {_mm_sqrt_ps(a.v)}; }
+        inline Float4 Min(Float4 a, Float4 b) { return {_mm_min_ps(a.v, b.v)}; }
+        inline Float4 Max(Float4 a, Float4 b) { return {_mm_max_ps(a.v, b.v)}; }
+        /** @brief a > b のレーンを全ビット 1 にしたマスク */
+        inline Float4 Greater(Float4 a, Float4 b) { return {_mm_cmpgt_ps(a.v, b.v)}; }
+        inline Float4 GreaterEqual(Float4 a, Float4 b) { return {_mm_cmpge_ps(a.v, b.v)}; }
+        inline Float4 IsNan(Float4 a) { return {_mm_cmpunord_ps(a.v, a.v)}; }
+        inline Float4 operator&(Float4 a, Float4 b) { return {_mm_and_ps(a.v, b.v)}; }
+        inline Float4 operator|(Float4 a, Float4 b) { return {_mm_or_ps(a.v, b.v)}; }
+        inline Float4 operator^(Float4 a, Float4 b) { return {_mm_xor_ps(a.v, b.v)}; }
+        /** @brief ~a & b */
+        inline Float4 AndNot(Float4 a, Float4 b) { return {_mm_andnot_ps(a.v, b.v)}; }
+        /** @brief 1/sqrt の近似（rsqrtps, 相対誤差 3.3e-4） */
+        inline Float4 RsqrtEstimate(Float4 a) { return {_mm_rsqrt_ps(a.v)}; }
+        /** @brief mask のレーンは a、それ以外は b */
+        inline Float4 Select(Float4 mask, Float4 a, Float4 b)
+        {
+            return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};
+        }
+        inline float ReduceMin(Float4 a)
+        {
+            __m128 m = _mm_min_ps(a.v, _mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(1, 0, 3, 2)));
+            m = _mm_min_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_cvtss_f32(m);
+        }
+        inline float ReduceMax(Float4 a)
+        {
+            __m128 m = _mm_max_ps(a.v, _mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(1, 0, 3, 2)));
+            m = _mm_max_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_cvtss_f32(m);
+        }
+
+        inline Int4 operator+(Int4 a, Int4 b) { return {_mm_add_epi32(a.v, b.v)}; }
+        inline Int4 operator-(Int4 a, Int4 b) { return {_mm_sub_epi32(a.v, b.v)}; }
+        inline Int4 operator&(Int4 a, Int4 b) { return {_mm_and_si128(a.v, b.v)}; }
+        inline Int4 operator|(Int4 a, Int4 b) { return {_mm_or_si128(a.v, b.v)}; }
+        inline Int4 operator^(Int4 a, Int4 b) { return {_mm_xor_si128(a.v, b.v)}; }
+        /** @brief ~a & b */
+        inline Int4 AndNot(Int4 a, Int4 b) { return {_mm_andnot_si128(a.v, b.v)}; }
+        inline Int4 Equal(Int4 a, Int4 b) { return {_mm_cmpeq_epi32(a.v, b.v)}; }
+        /** @brief 符号付きで a > b */
+        inline Int4 Greater(Int4 a, Int4 b) { return {_mm_cmpgt_epi32(a.v, b.v)}; }
+        template <int N>
+        inline Int4 ShiftLeft(Int4 a) { return {_mm_slli_epi32(a.v, N)}; }
+        /** @brief 論理シフト（上位を 0 で埋める） */
+        template <int N>
+        inline Int4 ShiftRight(Int4 a) { return {_mm_srli_epi32(a.v, N)}; }
+        /** @brief 算術シフト（上位を符号で埋める） */
+        template <int N>
+        inline Int4 ShiftRightArith(Int4 a) { return {_mm_srai_epi32(a.v, N)}; }
+        inline Float4 ToFloat(Int4 a) { return {_mm_cvtepi32_ps(a.v)}; }
+        /** @brief 0 方向への切り捨てで整数化（static_cast<int32_t> と同じ） */
+        inline Int4 TruncateToInt(Float4 a) { return {_mm_cvttps_epi32(a.v)}; }
+        inline Float4 AsFloat(Int4 a) { return {_mm_castsi128_ps(a.v)}; }
+        inline Int4 AsInt(Float4 a) { return {_mm_castps_si128(a.v)}; }
+
+        /** @brief 16 バイトのうち [4K, 4K + 4) 番目を 0 拡張して 32bit × 4 に */
+        template <int K>
+        inline Int4 Widen8(Int4 bytes)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i w = (K < 2) ? _mm_unpacklo_epi8(bytes.v, zero) : _mm_unpackhi_epi8(bytes.v, zero);
+            return {(K % 2 == 0) ? _mm_unpacklo_epi16(w, zero) : _mm_unpackhi_epi16(w, zero)};
+        }
+        /** @brief 16bit × 8 のうち [4K, 4K + 4) 番目を 0 拡張して 32bit × 4 に */
+        template <int K>
+        inline Int4 Widen16(Int4 halves)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            return {(K == 0) ? _mm_unpacklo_epi16(halves.v, zero) : _mm_unpackhi_epi16(halves.v, zero)};
+        }
+        /** @brief a, b の各レーンの下位 16bit を並べて 16bit × 8 に（上位は捨てる） */
+        inline Int4 Narrow16(Int4 a, Int4 b)
+        {
+            // SSE2 には符号なしの pack がないので、符号拡張してから符号付きで飽和させる（値は変わらない）
+            const __m128i la = _mm_srai_epi32(_mm_slli_epi32(a.v, 16), 16);
+            const __m128i lb = _mm_srai_epi32(_mm_slli_epi32(b.v, 16), 16);
+            return {_mm_packs_epi32(la, lb)};
+        }
+        /** @brief a, b, c, d の 16 レーンを [0, 255] に飽和させて 8bit × 16 に */
+        inline Int4 NarrowSaturate8(Int4 a, Int4 b, Int4 c, Int4 d)
+        {
+            return {_mm_packus_epi16(_mm_packs_epi32(a.v, b.v), _mm_packs_epi32(c.v, d.v))};
+        }
+#elif defined(NEONVECTOR_SIMD_NEON)
+        inline Float4 operator+(Float4 a, Float4 b) { return {vaddq_f32(a.v, b.v)}; }
+        inline Float4 operator-(Float4 a, Float4 b) { return {vsubq_f32(a.v, b.v)}; }
+        inline Float4 operator*(Float4 a, Float4 b) { return {vmulq_f32(a.v, b.v)}; }
+        inline Float4 operator/(Float4 a, Float4 b) { return {vdivq_f32(a.v, b.v)}; }
+        inline Float4 Sqrt(Float4 a) { return {vsqrtq_f32(a.v)}; }
+        inline Float4 Min(Float4 a, Float4 b) { return {vminq_f32(a.v, b.v)}; }
+        inline Float4 Max(Float4 a, Float4 b) { return {vmaxq_f32(a.v, b.v)}; }
+        inline Float4 Greater(Float4 a, Float4 b) { return {vreinterpretq_f32_u32(vcgtq_f32(a.v, b.v))}; }
+        inline Float4 GreaterEqual(Float4 a, Float4 b) { return {vreinterpretq_f32_u32(vcgeq_f32(a.v, b.v))}; }
+        inline Float4 IsNan(Float4 a) { return {vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32(a.v, a.v)))}; }
+        inline Float4 operator&(Float4 a, Float4 b)
+        {
+            return {vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v)))};
+        }
+        inline Float4 operator|(Float4 a, Float4 b)
+        {
+            return {vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v)))};
+        }
+        inline Float4 operator^(Float4 a, Float4 b)
+        {
+            return {vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v)))};
+        }
+        inline Float4 AndNot(Float4 a, Float4 b)
+        {
+            return {vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(b.v), vreinterpretq_u32_f32(a.v)))};
+        }
+        /** @brief vrsqrte（8bit）にニュートン法 1 回（FastMath::Detail::RsqrtEstimate と同じ値） */
+        inline Float4 RsqrtEstimate(Float4 a)
+        {
+            const float32x4_t y = vrsqrteq_f32(a.v);
+            return {vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(a.v, y), y))};
+        }
+        inline Float4 Select(Float4 mask, Float4 a, Float4 b)
+        {
+            return {vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v)};
+        }
+        inline float ReduceMin(Float4 a) { return vminvq_f32(a.v); }
+        inline float ReduceMax(Float4 a) { return vmaxvq_f32(a.v); }
+
+        inline Int4 operator+(Int4 a, Int4 b) { return {vaddq_s32(a.v, b.v)}; }
+        inline Int4 operator-(Int4 a, Int4 b) { return {vsubq_s32(a.v, b.v)}; }
+        inline Int4 operator&(Int4 a, Int4 b) { return {vandq_s32(a.v, b.v)}; }
+        inline Int4 operator|(Int4 a, Int4 b) { return {vorrq_s32(a.v, b.v)}; }
+        inline Int4 operator^(Int4 a, Int4 b) { return {veorq_s32(a.v, b.v)}; }
+        inline Int4 AndNot(Int4 a, Int4 b) { return {vbicq_s32(b.v, a.v)}; }
+        inline Int4 Equal(Int4 a, Int4 b) { return {vreinterpretq_s32_u32(vceqq_s32(a.v, b.v))}; }
+        inline Int4 Greater(Int4 a, Int4 b) { return {vreinterpretq_s32_u32(vcgtq_s32(a.v, b.v))}; }
+        template <int N>
+        inline Int4 ShiftLeft(Int4 a) { return {vshlq_n_s32(a.v, N)}; }
+        template <int N>
+        inline Int4 ShiftRight(Int4 a) { return {vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(a.v), N))}; }
+        template <int N>
+        inline Int4 ShiftRightArith(Int4 a) { return {vshrq_n_s32(a.v, N)}; }
+        inline Float4 ToFloat(Int4 a) { return {vcvtq_f32_s32(a.v)}; }
+        inline Int4 TruncateToInt(Float4 a) { return {vcvtq_s32_f32(a.v)}; }
+        inline Float4 AsFloat(Int4 a) { return {vreinterpretq_f32_s32(a.v)}; }
+        inline Int4 AsInt(Float4 a) { return {vreinterpretq_s32_f32(a.v)}; }
+
+        template <int K>
+        inline Int4 Widen8(Int4 bytes)
+        {
+            const uint8x16_t b = vreinterpretq_u8_s32(bytes.v);
+            const uint16x8_t w = vmovl_u8((K < 2) ? vget_low_u8(b) : vget_high_u8(b));
+            return {vreinterpretq_s32_u32(vmovl_u16((K % 2 == 0) ? vget_low_u16(w) : vget_high_u16(w)))};
+        }
+        template <int K>
+        inline Int4 Widen16(Int4 halves)
+        {
+            const uint16x8_t h = vreinterpretq_u16_s32(halves.v);
+            return {vreinterpretq_s32_u32(vmovl_u16((K == 0) ? vget_low_u16(h) : vget_high_u16(h)))};
+        }
+        inline Int4 Narrow16(Int4 a, Int4 b)
+        {
+            return {vreinterpretq_s32_s16(vcombine_s16(vmovn_s32(a.v), vmovn_s32(b.v)))};
+        }
+        inline Int4 NarrowSaturate8(Int4 a, Int4 b, Int4 c, Int4 d)
+        {
+            const int16x8_t lo = vcombine_s16(vqmovn_s32(a.v), vqmovn_s32(b.v));
+            const int16x8_t hi = vcombine_s16(vqmovn_s32(c.v), vqmovn_s32(d.v));
+            return {vreinterpretq_s32_u8(vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)))};
+        }
+#else
+        namespace Detail
+        {
+            template <class Fn>
+            Float4 Map(Float4 a, Float4 b, Fn fn)
+            {
+                Float4 r;
+                for (size_t i = 0; i < 4; ++i)
+                    r.v[i] = fn(a.v[i], b.v[i]);
+                return r;
+            }
+
+            template <class Fn>
+            Int4 MapInt(Int4 a, Int4 b, Fn fn)
+            {
+                Int4 r;
+                for (size_t i = 0; i < 4; ++i)
+                    r.v[i] = static_cast<int32_t>(fn(static_cast<uint32_t>(a.v[i]), static_cast<uint32_t>(b.v[i])));
+                return r;
+            }
+
+            inline uint32_t Bits(float f)
+            {
+                uint32_t u;
+                std::memcpy(&u, &f, sizeof(u));
+                return u;
+            }
+
+            inline float FromBits(uint32_t u)
+            {
+                float f;
+                std::memcpy(&f, &u, sizeof(f));
+                return f;
+            }
+
+            /** @brief 条件を満たせば全ビット 1（NaN のビット列）、満たさなければ 0 */
+            inline float Mask(bool b) { return FromBits(b ? 0xffffffffu : 0u); }
+
+            template <class Fn>
+            Float4 MapBits(Float4 a, Float4 b, Fn fn)
+            {
+                return Map(a, b, [fn](float x, float y) { return FromBits(fn(Bits(x), Bits(y))); });
+            }
+        }
+        inline Float4 operator+(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x + y; }); }
+        inline Float4 operator-(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x - y; }); }
+        inline Float4 operator*(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x * y; }); }
+        inline Float4 operator/(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x / y; }); }
+        inline Float4 Sqrt(Float4 a) { return Detail::Map(a, a, [](float x, float) { return std::sqrt(x); }); }
+        inline Float4 Min(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x < y ? x : y; }); }
+        inline Float4 Max(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x > y ? x : y; }); }
+        inline Float4 Greater(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return Detail::Mask(x > y); }); }
+        inline Float4 GreaterEqual(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return Detail::Mask(x >= y); }); }
+        inline Float4 IsNan(Float4 a) { return Detail::Map(a, a, [](float x, float) { return Detail::Mask(x != x); }); }
+        inline Float4 operator&(Float4 a, Float4 b) { return Detail::MapBits(a, b, [](uint32_t x, uint32_t y) { return x & y; }); }
+        inline Float4 operator|(Float4 a, Float4 b) { return Detail::MapBits(a, b, [](uint32_t x, uint32_t y) { return x | y; }); }
+        inline Float4 operator^(Float4 a, Float4 b) { return Detail::MapBits(a, b, [](uint32_t x, uint32_t y) { return x ^ y; }); }
+        inline Float4 AndNot(Float4 a, Float4 b) { return Detail::MapBits(a, b, [](uint32_t x, uint32_t y) { return ~x & y; }); }
+        /** @brief ビット演算による初期値（0x5f375a86）にニュートン法 1 回（FastMath::Detail::RsqrtEstimate と同じ値） */
+        inline Float4 RsqrtEstimate(Float4 a)
+        {
+            return Detail::Map(a, a, [](float x, float) {
+                const float y = Detail::FromBits(0x5f375a86u - (Detail::Bits(x) >> 1));
+                return y * (1.5f - 0.5f * x * y * y);
+            });
+        }
+        inline Float4 Select(Float4 mask, Float4 a, Float4 b) { return (mask & a) | AndNot(mask, b); }
+        inline float ReduceMin(Float4 a) { return std::fmin(std::fmin(a.v[0], a.v[1]), std::fmin(a.v[2], a.v[3])); }
+        inline float ReduceMax(Float4 a) { return std::fmax(std::fmax(a.v[0], a.v[1]), std::fmax(a.v[2], a.v[3])); }
+
+        inline Int4 operator+(Int4 a, Int4 b) { return Detail::MapInt(a, b, [](uint32_t x, uint32_t y) { return x + y; }); }
+        inline Int4 operator-(Int4 a, Int4 b) { return Detail::MapInt(a, b, [](uint32_t x, uint32_t y) { return x - y; }); }
+        inline Int4 operator&(Int4 a, Int4 b) { return Detail::MapInt(a, b, [](uint32_t x, uint32_t y) { return x & y; }); }
+        inline Int4 operator|(Int4 a, Int4 b) { return Detail::MapInt(a, b, [](uint32_t x, uint32_t y) { return x | y; }); }
+        inline Int4 operator^(Int4 a, Int4 b) { return Detail::MapInt(a, b, [](uint32_t x, uint32_t y) { return x ^ y; }); }
+        inline Int4 AndNot(Int4 a, Int4 b) { return Detail::MapInt(a, b, [](uint32_t x, uint32_t y) { return ~x & y; }); }
+        inline Int4 Equal(Int4 a, Int4 b) { return Detail::MapInt(a, b, [](uint32_t x, uint32_t y) { return x == y ? 0xffffffffu : 0u; }); }
+        inline Int4 Greater(Int4 a, Int4 b)
+        {
+            Int4 r;
+            for (size_t i = 0; i < 4; ++i)
+                r.v[i] = (a.v[i] > b.v[i]) ? -1 : 0;
+            return r;
+        }
+        template <int N>
+        inline Int4 ShiftLeft(Int4 a) { return Detail::MapInt(a, a, [](uint32_t x, uint32_t) { return x << N; }); }
+        template <int N>
+        inline Int4 ShiftRight(Int4 a) { return Detail::MapInt(a, a, [](uint32_t x, uint32_t) { return x >> N; }); }
+        template <int N>
+        inline Int4 ShiftRightArith(Int4 a)
+        {
+            Int4 r;
+            for (size_t i = 0; i < 4; ++i)
+                r.v[i] = a.v[i] >> N;   // C++20 から負数の右シフトは算術シフト
+            return r;
+        }
+        inline Float4 ToFloat(Int4 a)
+        {
+            Float4 r;
+            for (size_t i = 0; i < 4; ++i)
+                r.v[i] = static_cast<float>(a.v[i]);
+            return r;
+        }
+        inline Int4 TruncateToInt(Float4 a)
+        {
+            Int4 r;
+            for (size_t i = 0; i < 4; ++i)
+                r.v[i] = static_cast<int32_t>(a.v[i]);
+            return r;
+        }
+        inline Float4 AsFloat(Int4 a)
+        {
+            Float4 r;
+            std::memcpy(r.v, a.v, sizeof(r.v));
+            return r;
+        }
+        inline Int4 AsInt(Float4 a)
+        {
+            Int4 r;
+            std::memcpy(r.v, a.v, sizeof(r.v));
+            return r;
+        }
+
+        template <int K>
+        inline Int4 Widen8(Int4 bytes)
+        {
+            uint8_t b[16];
+            std::memcpy(b, bytes.v, sizeof(b));
+            Int4 r;
+            for (size_t i = 0; i < 4; ++i)
+                r.v[i] = b[K * 4 + i];
+            return r;
+        }
+        template <int K>
+        inline Int4 Widen16(Int4 halves)
+        {
+            uint16_t h[8];
+            std::memcpy(h, halves.v, sizeof(h));
+            Int4 r;
+            for (size_t i = 0; i < 4; ++i)
+                r.v[i] = h[K * 4 + i];
+            return r;
+        }
+        inline Int4 Narrow16(Int4 a, Int4 b)
+        {
+            uint16_t h[8];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                h[i] = static_cast<uint16_t>(a.v[i]);
+                h[i + 4] = static_cast<uint16_t>(b.v[i]);
+            }
+            Int4 r;
+            std::memcpy(r.v, h, sizeof(h));
+            return r;
+        }
+        inline Int4 NarrowSaturate8(Int4 a, Int4 b, Int4 c, Int4 d)
+        {
+            const Int4 *src[4] = {&a, &b, &c, &d};
+            uint8_t bytes[16];
+            for (size_t k = 0; k < 4; ++k)
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    const int32_t x = src[k]->v[i];
+                    bytes[k * 4 + i] = static_cast<uint8_t>(x < 0 ? 0 : (x > 255 ? 255 : x));
+                }
+            Int4 r;
+            std::memcpy(r.v, bytes, sizeof(bytes));
+            return r;
+        }
+#endif
+
+        /**
+         * @brief 8 レーン。AVX が有効なら 256bit 1 本、そうでなければ Float4 を 2 本束ねる
+         */
+        struct Float8
+        {
+#if defined(NEONVECTOR_SIMD_AVX)
+            __m256 v;
+#else
+            Float4 lo, hi;
+#endif
+            static constexpr size_t kWidth = 8;
+
+            static Float8 Load(const float *p)
+            {
+#if defined(NEONVECTOR_SIMD_AVX)
+                return {_mm256_loadu_ps(p)};
+#else
+                return {Float4::Load(p), Float4::Load(p + 4)};
+#endif
+            }
+
+            static Float8 Set1(float s)
+            {
+#if defined(NEONVECTOR_SIMD_AVX)
+                return {_mm256_set1_ps(s)};
+#else
+                return {Float4::Set1(s), Float4::Set1(s)};
+#endif
+            }
+
+            void Store(float *p) const
+            {
+#if defined(NEONVECTOR_SIMD_AVX)
+                _mm256_storeu_ps(p, v);
+#else
+                lo.Store(p);
+                hi.Store(p + 4);
+#endif
+            }
+        };
+
+#if defined(NEONVECTOR_SIMD_AVX)
+        inline Float8 operator+(Float8 a, Float8 b) { return {_mm256_add_ps(a.v, b.v)}; }
+        inline Float8 operator-(Float8 a, Float8 b) { return {_mm256_sub_ps(a.v, b.v)}; }
+        inline Float8 operator*(Float8 a, Float8 b) { return {_mm256_mul_ps(a.v, b.v)}; }
+        inline Float8 operator/(Float8 a, Float8 b) { return {_mm256_div_ps(a.v, b.v)}; }
+        inline Float8 Sqrt(Float8 a) { return {_mm256_sqrt_ps(a.v)}; }
+        inline Float8 Min(Float8 a, Float8 b) { return {_mm256_min_ps(a.v, b.v)}; }
+        inline Float8 Max(Float8 a, Float8 b) { return {_mm256_max_ps(a.v, b.v)}; }
+        inline Float8 Greater(Float8 a, Float8 b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)}; }
+        inline Float8 Select(Float8 mask, Float8 a, Float8 b) { return {_mm256_blendv_ps(b.v, a.v, mask.v)}; }
+        inline float ReduceMin(Float8 a)
+        {
+            return ReduceMin(Min(Float4{_mm256_castps256_ps128(a.v)}, Float4{_mm256_extractf128_ps(a.v, 1)}));
+        }
+        inline float ReduceMax(Float8 a)
+        {
+            return ReduceMax(Max(Float4{_mm256_castps256_ps128(a.v)}, Float4{_mm256_extractf128_ps(a.v, 1)}));
+        }
+#else
+        inline Float8 operator+(Float8 a, Float8 b) { return {a.lo + b.lo, a.hi + b.hi}; }
+        inline Float8 operator-(Float8 a, Float8 b) { return {a.lo - b.lo, a.hi - b.hi}; }
+        inline Float8 operator*(Float8 a, Float8 b) { return {a.lo * b.lo, a.hi * b.hi}; }
+        inline Float8 operator/(Float8 a, Float8 b) { return {a.lo / b.lo, a.hi / b.hi}; }
+        inline Float8 Sqrt(Float8 a) { return {Sqrt(a.lo), Sqrt(a.hi)}; }
+        inline Float8 Min(Float8 a, Float8 b) { return {Min(a.lo, b.lo), Min(a.hi, b.hi)}; }
+        inline Float8 Max(Float8 a, Float8 b) { return {Max(a.lo, b.lo), Max(a.hi, b.hi)}; }
+        inline Float8 Greater(Float8 a, Float8 b) { return {Greater(a.lo, b.lo), Greater(a.hi, b.hi)}; }
+        inline Float8 Select(Float8 mask, Float8 a, Float8 b)
+        {
+            return {Select(mask.lo, a.lo, b.lo), Select(mask.hi, a.hi, b.hi)};
+        }
+        inline float ReduceMin(Float8 a) { return ReduceMin(Min(a.lo, a.hi)); }
+        inline float ReduceMax(Float8 a) { return ReduceMax(Max(a.lo, a.hi)); }
+#endif
+
+        /**
+         * @brief xy が交互に並んだ配列（Vector2 の配列）から x / y の列を取り出す
+         * @param p 2 * kWidth 個の float
+         */
+        inline void LoadInterleaved(const float *p, Float4 &x, Float4 &y)
+        {
+#if defined(NEONVECTOR_SIMD_SSE)
+            const __m128 a = _mm_loadu_ps(p);     // x0 y0 x1 y1
+            const __m128 b = _mm_loadu_ps(p + 4); // x2 y2 x3 y3
+            x.v = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            y.v = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+#elif defined(NEONVECTOR_SIMD_NEON)
+            const float32x4x2_t t = vld2q_f32(p);
+            x.v = t.val[0];
+            y.v = t.val[1];
+#else
+            for (size_t i = 0; i < 4; ++i)
+            {
+                x.v[i] = p[i * 2];
+                y.v[i] = p[i * 2 + 1];
+            }
+#endif
+        }
+
+        inline void StoreInterleaved(float *p, Float4 x, Float4 y)
+        {
+#if defined(NEONVECTOR_SIMD_SSE)
+            _mm_storeu_ps(p, _mm_unpacklo_ps(x.v, y.v));
+            _mm_storeu_ps(p + 4, _mm_unpackhi_ps(x.v, y.v));
+#elif defined(NEONVECTOR_SIMD_NEON)
+            float32x4x2_t t;
+            t.val[0] = x.v;
+            t.val[1] = y.v;
+            vst2q_f32(p, t);
+#else
+            for (size_t i = 0; i < 4; ++i)
+            {
+                p[i * 2] = x.v[i];
+                p[i * 2 + 1] = y.v[i];
+            }
+#endif
+        }
+
+        inline void LoadInterleaved(const float *p, Float8 &x, Float8 &y)
+        {
+#if defined(NEONVECTOR_SIMD_AVX)
+            Float4 xl, yl, xh, yh;
+            LoadInterleaved(p, xl, yl);
+            LoadInterleaved(p + 8, xh, yh);
+            x.v = _mm256_insertf128_ps(_mm256_castps128_ps256(xl.v), xh.v, 1);
+            y.v = _mm256_insertf128_ps(_mm256_castps128_ps256(yl.v), yh.v, 1);
+#else
+            LoadInterleaved(p, x.lo, y.lo);
+            LoadInterleaved(p + 8, x.hi, y.hi);
+#endif
+        }
+
+        inline void StoreInterleaved(float *p, Float8 x, Float8 y)
+        {
+#if defined(NEONVECTOR_SIMD_AVX)
+            StoreInterleaved(p, Float4{_mm256_castps256_ps128(x.v)}, Float4{_mm256_castps256_ps128(y.v)});
+            StoreInterleaved(p + 8, Float4{_mm256_extractf128_ps(x.v, 1)}, Float4{_mm256_extractf128_ps(y.v, 1)});
+#else
+            StoreInterleaved(p, x.lo, y.lo);
+            StoreInterleaved(p + 8, x.hi, y.hi);
+#endif
+        }
+
+    } // namespace Simd
+} // namespace NeonVector
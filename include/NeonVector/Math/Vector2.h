@@ -54,9 +54,40 @@ namespace NeonVector
             }
         }
 
+        float Dot(const Vector2 &other) const
+        {
+            return x * other.x + y * other.y;
+        }
+
+        /** @brief 2D の外積（z 成分）。正なら other は画面上で時計回り側 */
+        float Cross(const Vector2 &other) const
+        {
+            return x * other.y - y * other.x;
+        }
+
+        /** @brief 角度 radians だけ回転したベクトル */
+        Vector2 Rotate(float radians) const
+        {
+            return Rotate(std::cos(radians), std::sin(radians));
+        }
+
+        /** @brief cos / sin を求め済みのときの回転（同じ角度で多数回すとき用） */
+        Vector2 Rotate(float c, float s) const
+        {
+            return {x * c - y * s, x * s + y * c};
+        }
+
         // 静的メソッド
         static Vector2 Zero() { return {0, 0}; }
         static Vector2 One() { return {1, 1}; }
+
+        /** @brief 角度 radians 方向の単位ベクトル */
+        static Vector2 FromAngle(float radians) { return {std::cos(radians), std::sin(radians)}; }
+
+        static Vector2 Lerp(const Vector2 &a, const Vector2 &b, float t)
+        {
+            return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t};
+        }
     };
 
 } // namespace NeonVector
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <NeonVector/Math/Vector2.h>
+#include <NeonVector/Math/Simd.h>
+#include <cstddef>
+
+namespace NeonVector
+{
+    static_assert(sizeof(Vector2) == sizeof(float) * 2, "Vector2 は float 2 個の詰めた配置であること");
+
+    /**
+     * @struct Vector2Pack
+     * @brief kWidth 個の Vector2 を x 列 / y 列（SoA）で持つパック
+     *
+     * Load / Store で Vector2 の配列（AoS）と相互に変換できるので、既存のスカラー
+     * コードの配列をそのまま渡せる。演算は Vector2 のメンバ関数と同じ順序で行うため、
+     * 結果はスカラー版とビット単位で一致する。
+     */
+    template <class F>
+    struct Vector2Pack
+    {
+        F x, y;
+
+        static constexpr size_t kWidth = F::kWidth;
+
+        /** @brief Vector2 の配列から kWidth 個 */
+        static Vector2Pack Load(const Vector2 *p)
+        {
+            Vector2Pack r;
+            Simd::LoadInterleaved(&p->x, r.x, r.y);
+            return r;
+        }
+
+        static Vector2Pack Load(const float *xs, const float *ys) { return {F::Load(xs), F::Load(ys)}; }
+        static Vector2Pack Set1(const Vector2 &v) { return {F::Set1(v.x), F::Set1(v.y)}; }
+
+        void Store(Vector2 *p) const { Simd::StoreInterleaved(&p->x, x, y); }
+        void Store(float *xs, float *ys) const
+        {
+            x.Store(xs);
+            y.Store(ys);
+        }
+
+        Vector2Pack operator+(const Vector2Pack &o) const { return {x + o.x, y + o.y}; }
+        Vector2Pack operator-(const Vector2Pack &o) const { return {x - o.x, y - o.y}; }
+        Vector2Pack operator*(F s) const { return {x * s, y * s}; }
+        Vector2Pack operator*(float s) const { return *this * F::Set1(s); }
+
+        F Dot(const Vector2Pack &o) const { return x * o.x + y * o.y; }
+        F Cross(const Vector2Pack &o) const { return x * o.y - y * o.x; }
+        F LengthSquared() const { return x * x + y * y; }
+        F Length() const { return Simd::Sqrt(x * x + y * y); }
+
+        /** @brief 長さ 0 のレーンはそのまま（Vector2::Normalize と同じ） */
+        Vector2Pack Normalized() const
+        {
+            const F len = Length();
+            const F nonZero = Simd::Greater(len, F::Set1(0.0f));
+            return {Simd::Select(nonZero, x / len, x), Simd::Select(nonZero, y / len, y)};
+        }
+
+        /** @brief レーン毎の cos / sin で回転 */
+        Vector2Pack Rotate(F c, F s) const { return {x * c - y * s, x * s + y * c}; }
+
+        static Vector2Pack Lerp(const Vector2Pack &a, const Vector2Pack &b, F t)
+        {
+            return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t};
+        }
+
+        static Vector2Pack Min(const Vector2Pack &a, const Vector2Pack &b) { return {Simd::Min(a.x, b.x), Simd::Min(a.y, b.y)}; }
+        static Vector2Pack Max(const Vector2Pack &a, const Vector2Pack &b) { return {Simd::Max(a.x, b.x), Simd::Max(a.y, b.y)}; }
+    };
+
+    using Vector2x4 = Vector2Pack<Simd::Float4>;
+    using Vector2x8 = Vector2Pack<Simd::Float8>;
+
+    /**
+     * @namespace Vector2Batch
+     * @brief Vector2 配列に対する一括演算（内部はパック幅ずつ処理し、端数はスカラー）
+     *
+     * in と out は同じ配列でもよい。結果は同じ式のスカラー版とビット単位で一致する。
+     */
+    namespace Vector2Batch
+    {
+        /** @brief out[i] = translate + in[i].Rotate(radians) * scale（形状のローカル座標 → ワールド） */
+        void Transform(const Vector2 *in, Vector2 *out, size_t count,
+                       const Vector2 &translate, float radians, float scale = 1.0f);
+
+        /** @brief 全要素を同じ角度で回転 */
+        void Rotate(const Vector2 *in, Vector2 *out, size_t count, float radians);
+
+        /** @brief 要素毎の角度で回転（cos / sin は FastMath::SinCos） */
+        void Rotate(const Vector2 *in, const float *radians, Vector2 *out, size_t count);
+
+        /** @brief 長さ 0 の要素はそのまま */
+        void Normalize(const Vector2 *in, Vector2 *out, size_t count);
+
+        void Length(const Vector2 *in, float *out, size_t count);
+
+        /** @brief out[i] = |in[i] - p|^2 */
+        void DistanceSq(const Vector2 *in, const Vector2 &p, float *out, size_t count);
+
+        /** @brief 外接矩形。count = 0 なら lo = hi = (0, 0) */
+        void MinMax(const Vector2 *in, size_t count, Vector2 &lo, Vector2 &hi);
+    }
+
+} // namespace NeonVector
@@ -9,9 +9,15 @@
 // Core
 #include "Core/Application.h"
 #include "Core/Types.h"
+#include "Core/PackedColor.h"
+#include "Core/Ecs.h"
+#include "Core/Pool.h"
 
 // Math
 #include "Math/Vector2.h"
+#include "Math/Vector2Pack.h"
+#include "Math/Fixed.h"
+#include "Math/BasicVector2.h"
 
 // Graphics
 #include "Graphics/LineBatcher.h"
@@ -19,7 +25,17 @@
 
 // Effects
 #include "Effects/Trail.h"
+#include "Effects/TrailPool.h"
+#include "Effects/OverLife.h"
 #include "Effects/ParticleSystem.h"
+#include "Effects/AnalyticParticleSystem.h"
+#include "Effects/BasicParticleSim.h"
+
+// Physics
+#include "Physics/UniformGrid.h"
+#include "Physics/AabbTree.h"
+#include "Physics/Sweep.h"
+#include "Physics/Narrowphase.h"
 
 /**
  * @namespace NeonVector
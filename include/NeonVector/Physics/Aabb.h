@@ -0,0 +1,48 @@
+#pragma once
+
+#include <NeonVector/Math/Vector2.h>
+#include <algorithm>
+
+namespace NeonVector {
+    namespace Physics {
+
+        /** @brief 軸に平行な矩形（lower ≤ upper） */
+        struct Aabb {
+            Vector2 lower;
+            Vector2 upper;
+
+            static Aabb FromCircle(const Vector2& center, float radius)
+            {
+                return { { center.x - radius, center.y - radius }, { center.x + radius, center.y + radius } };
+            }
+            static Aabb FromSegment(const Vector2& a, const Vector2& b)
+            {
+                return { { std::min(a.x, b.x), std::min(a.y, b.y) }, { std::max(a.x, b.x), std::max(a.y, b.y) } };
+            }
+            static Aabb Union(const Aabb& a, const Aabb& b)
+            {
+                return { { std::min(a.lower.x, b.lower.x), std::min(a.lower.y, b.lower.y) },
+                         { std::max(a.upper.x, b.upper.x), std::max(a.upper.y, b.upper.y) } };
+            }
+
+            Vector2 Center() const { return (lower + upper) * 0.5f; }
+            Vector2 Extents() const { return (upper - lower) * 0.5f; }
+            /** @brief 周長（木の挿入先を選ぶコスト。2D では面積より細長い箱を正しく嫌う） */
+            float Perimeter() const { return 2.0f * ((upper.x - lower.x) + (upper.y - lower.y)); }
+
+            Aabb Expanded(float margin) const
+            {
+                return { { lower.x - margin, lower.y - margin }, { upper.x + margin, upper.y + margin } };
+            }
+            bool Contains(const Aabb& o) const
+            {
+                return lower.x <= o.lower.x && lower.y <= o.lower.y && o.upper.x <= upper.x && o.upper.y <= upper.y;
+            }
+            bool Overlaps(const Aabb& o) const
+            {
+                return lower.x <= o.upper.x && o.lower.x <= upper.x && lower.y <= o.upper.y && o.lower.y <= upper.y;
+            }
+        };
+
+    } // namespace Physics
+} // namespace NeonVector
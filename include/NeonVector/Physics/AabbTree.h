@@ -0,0 +1,197 @@
+#pragma once
+
+#include <NeonVector/Physics/Aabb.h>
+#include <NeonVector/Physics/Body.h>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+
+namespace NeonVector {
+    namespace Physics {
+
+        /** @brief AabbTree::RayCast の最も近い当たり */
+        struct RayHit {
+            uint32_t user = ~0u;
+            float t = 1.0f;        // from + t (to - from)
+            Vector2 point;
+            Vector2 normal;
+        };
+
+        /**
+         * @class AabbTree
+         * @brief 動的な AABB 木（大きさのばらつく物体のブロードフェーズ）
+         *
+         * 葉は物体の箱を margin だけ太らせて持ち、Move で箱がその中に収まっている間は何もしない。
+         * はみ出したら葉を抜いて挿り直す（周長の増分が最小の兄弟を選び、根まで箱と高さを直す）。
+         * 挿入・削除で辿った節は AVL と同じ回転で高さを揃えるので、物体が偏って動いても深さは
+         * O(log n) に保たれる。UniformGrid と違ってセルの大きさを決めなくてよく、弾のように
+         * 小さい物体と大きな小惑星が混ざっても問い合わせのコストが落ちない。
+         *
+         * 節は 1 本の配列に置き、親子は添字で結ぶ（ポインタを持たないので配列の伸長で壊れない）。
+         * 問い合わせは const で、複数スレッドから同時に呼んでよい（登録・移動は不可）。
+         */
+        class AabbTree {
+        public:
+            static constexpr uint32_t kNull = ~0u;
+
+            /** @param margin 葉の箱を太らせる量。大きいほど Move での挿し直しが減り、問い合わせの候補が増える */
+            explicit AabbTree(float margin = 8.0f) : m_margin(margin) {}
+
+            BodyHandle Insert(const Aabb& box, uint32_t user);
+            /**
+             * @brief 物体の箱を更新する
+             * @param displacement 次のフレームまでの移動量の見込み。その向きに太らせて挿し直しを減らす
+             * @return 葉を挿し直したら true
+             */
+            bool Move(BodyHandle h, const Aabb& box, const Vector2& displacement = Vector2{ 0.0f, 0.0f });
+            void Remove(BodyHandle h);
+            /** @brief 全て外す（発行済みのハンドルは全て無効になる） */
+            void Clear();
+
+            size_t Count() const { return m_leafCount; }
+            /** @brief 太らせた箱（無効なハンドルなら空の箱） */
+            Aabb GetFatAabb(BodyHandle h) const;
+            /** @brief 根からの最大の深さ（葉だけなら 0、空なら -1） */
+            int Height() const { return m_root == kNull ? -1 : m_nodes[m_root].height; }
+            /** @brief 全節の周長の和 / 根の周長（木の質の目安。小さいほど良い） */
+            float AreaRatio() const;
+
+            /** @brief box と太らせた箱が重なる物体の user を out に集める */
+            void QueryAabb(const Aabb& box, std::vector<uint32_t>& out) const;
+
+            /** @brief 太らせた箱が重なる全ての組（各組 1 回, a < b。形状同士の判定は呼び出し側） */
+            void FindPairs(std::vector<BodyPair>& out) const;
+
+            /**
+             * @brief 線分 from → to に最初に当たる物体（ビーム・レーザー向け）
+             *
+             * 箱が線分と交わる葉ごとに test(user, from, d, maxT, t, normal) を呼ぶ（d = to - from）。
+             * test は形状との交差を判定し、maxT 以下で当たれば t と法線を書いて true を返す。
+             * 当たるたびに線分を t で縮めるので、遠い物体の箱は調べずに済む。
+             * ColliderSweep の関数は user を取らないので、test で形状を引いて渡す:
+             * @code
+             * tree.RayCast(from, to, [&](uint32_t user, const Vector2& p, const Vector2& d, float maxT, float& t, Vector2& n) {
+             *     const Circle& c = circles[user];
+             *     return Effects::SweepCircle(p, d, c.center, c.radius, maxT, t, n) != Effects::SweepContact::None;
+             * }, hit);
+             * @endcode
+             * 線分なら SweepSegment(p, d, a, b, maxT, t, n) の戻り値をそのまま返せばよい。
+             */
+            template<class Test>
+            bool RayCast(const Vector2& from, const Vector2& to, Test&& test, RayHit& hit) const;
+
+        private:
+            struct Node {
+                Aabb box;                  // 葉は太らせた箱、内部節は子の和
+                uint32_t parent = kNull;   // 空きの節では次の空き
+                uint32_t child1 = kNull;   // 葉は kNull
+                uint32_t child2 = kNull;
+                int32_t height = -1;       // 葉 0、空き -1
+                uint32_t user = 0;
+                uint32_t generation = 0;
+                bool IsLeaf() const { return child1 == kNull; }
+            };
+
+            /** @brief 深さ優先で辿るためのスタック（浅い木ではヒープを使わない） */
+            class Stack {
+            public:
+                void Push(uint32_t v)
+                {
+                    if (m_size == m_capacity) grow();
+                    m_data[m_size++] = v;
+                }
+                uint32_t Pop() { return m_data[--m_size]; }
+                bool Empty() const { return m_size == 0; }
+            private:
+                void grow();
+                uint32_t m_fixed[128];
+                std::vector<uint32_t> m_heap;
+                uint32_t* m_data = m_fixed;
+                size_t m_size = 0;
+                size_t m_capacity = 128;
+            };
+
+            const Node* findLeaf(BodyHandle h) const;
+            uint32_t allocateNode();
+            void freeNode(uint32_t index);
+            void insertLeaf(uint32_t leaf);
+            void removeLeaf(uint32_t leaf);
+            void refit(uint32_t index);
+            uint32_t balance(uint32_t index);
+
+            template<class F>
+            void query(const Aabb& box, F&& f) const;
+
+        private:
+            float m_margin;
+            std::vector<Node> m_nodes;
+            uint32_t m_root = kNull;
+            uint32_t m_freeList = kNull;
+            size_t m_leafCount = 0;
+        };
+
+        template<class F>
+        void AabbTree::query(const Aabb& box, F&& f) const
+        {
+            if (m_root == kNull) return;
+            Stack stack;
+            stack.Push(m_root);
+            while (!stack.Empty()) {
+                const uint32_t i = stack.Pop();
+                const Node& n = m_nodes[i];
+                if (!n.box.Overlaps(box)) continue;
+                if (n.IsLeaf()) {
+                    f(i);
+                } else {
+                    stack.Push(n.child1);
+                    stack.Push(n.child2);
+                }
+            }
+        }
+
+        template<class Test>
+        bool AabbTree::RayCast(const Vector2& from, const Vector2& to, Test&& test, RayHit& hit) const
+        {
+            const Vector2 d = to - from;
+            const float len = d.Length();
+            if (m_root == kNull || len <= 0.0f) return false;
+
+            // 線分の法線方向への分離軸: |n·(c - from)| > n の方向の箱の半幅 なら交わらない
+            const Vector2 n{ -d.y / len, d.x / len };
+            const Vector2 absN{ std::fabs(n.x), std::fabs(n.y) };
+
+            float maxT = 1.0f;
+            Aabb segBox = Aabb::FromSegment(from, to);
+            bool found = false;
+
+            Stack stack;
+            stack.Push(m_root);
+            while (!stack.Empty()) {
+                const uint32_t i = stack.Pop();
+                const Node& node = m_nodes[i];
+                if (!node.box.Overlaps(segBox)) continue;
+                const Vector2 c = node.box.Center();
+                const Vector2 e = node.box.Extents();
+                if (std::fabs(n.Dot(from - c)) > absN.x * e.x + absN.y * e.y) continue;
+
+                if (!node.IsLeaf()) {
+                    stack.Push(node.child1);
+                    stack.Push(node.child2);
+                    continue;
+                }
+                float t;
+                Vector2 normal;
+                if (!test(node.user, from, d, maxT, t, normal) || t > maxT) continue;
+                maxT = t;
+                found = true;
+                hit.user = node.user;
+                hit.t = t;
+                hit.point = from + d * t;
+                hit.normal = normal;
+                segBox = Aabb::FromSegment(from, hit.point);   // これより遠い箱は見なくてよい
+            }
+            return found;
+        }
+
+    } // namespace Physics
+} // namespace NeonVector
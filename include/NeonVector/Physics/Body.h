@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace NeonVector {
+    namespace Physics {
+
+        /** @brief ブロードフェーズに登録した物体の識別子（削除後の再利用を generation で見分ける） */
+        struct BodyHandle {
+            uint32_t index = ~0u;
+            uint32_t generation = 0;
+            bool IsValid() const { return index != ~0u; }
+        };
+
+        /** @brief 重なっている 2 物体（登録時に渡した user 値, a < b） */
+        struct BodyPair {
+            uint32_t a;
+            uint32_t b;
+        };
+
+    } // namespace Physics
+} // namespace NeonVector
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <NeonVector/Physics/Polygon.h>
+
+namespace NeonVector {
+    namespace Physics {
+
+        /** @brief 重なりの詳細（ワールド座標） */
+        struct Contact {
+            Vector2 normal;      // A から B へ向く単位ベクトル。B をこの向きに depth 動かすと離れる
+            float depth = 0.0f;
+            Vector2 point;       // B の最も深く入り込んだ点
+        };
+
+        /** @brief 両方の片の頂点数がこれ以下なら SAT、そうでなければ GJK / EPA で判定する */
+        constexpr size_t kSatMaxVertices = 8;
+
+        /**
+         * @brief 凸片どうしの分離軸判定（SAT）
+         *
+         * 両方の辺の法線を軸に試すので、コストは頂点数の積。小さい片では GJK より速く、
+         * 押し出しの向き（最も浅い軸）もそのまま得られる。接しているだけ（重なり 0）は重ならない扱い。
+         */
+        bool SatOverlap(const ConvexPiece& a, const Transform& xa, const ConvexPiece& b, const Transform& xb,
+            Contact* contact = nullptr);
+
+        /**
+         * @brief 凸片どうしの GJK 判定（contact を求めるときは EPA で押し出しを求める）
+         *
+         * 差集合 A - B が原点を含むかを支持点の単体で調べる。頂点の多い片でも反復は数回で済む。
+         */
+        bool GjkOverlap(const ConvexPiece& a, const Transform& xa, const ConvexPiece& b, const Transform& xb,
+            Contact* contact = nullptr);
+
+        /**
+         * @brief 多角形どうし
+         *
+         * 全体の外接円 → 片ごとの外接円 → 片どうしの SAT / GJK の順に絞る。
+         * contact を渡すと最も深い片の組の押し出しを返す（渡さなければ最初の重なりで打ち切る）。
+         */
+        bool Overlap(const PolygonShape& a, const Transform& xa, const PolygonShape& b, const Transform& xb,
+            Contact* contact = nullptr);
+
+        /** @brief 多角形と円（radius = 0 なら点の内外判定）。contact.normal は多角形から円へ */
+        bool Overlap(const PolygonShape& a, const Transform& xa, const Vector2& center, float radius,
+            Contact* contact = nullptr);
+
+        /**
+         * @brief 線分 from → to が最初に多角形へ入る位置（弾の 1 ステップの移動など）
+         * @param t from + t (to - from) の t ∈ [0, 1]。from が既に内側なら 0
+         * @param normal 入った辺の外向き法線（from が内側なら -(to - from) の向き）
+         */
+        bool SegmentCast(const PolygonShape& a, const Transform& xa, const Vector2& from, const Vector2& to,
+            float& t, Vector2* normal = nullptr);
+
+    } // namespace Physics
+} // namespace NeonVector
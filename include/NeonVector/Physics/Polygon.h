@@ -0,0 +1,71 @@
+#pragma once
+
+#include <NeonVector/Math/Vector2.h>
+#include <vector>
+#include <cmath>
+
+namespace NeonVector {
+    namespace Physics {
+
+        /** @brief 平行移動 + 回転（Vector2Batch::Transform と同じ順: world = position + local.Rotate(angle)） */
+        struct Transform {
+            Vector2 position;
+            float c = 1.0f;   // cos(angle)
+            float s = 0.0f;   // sin(angle)
+
+            static Transform Make(const Vector2& position, float radians)
+            {
+                return { position, std::cos(radians), std::sin(radians) };
+            }
+
+            Vector2 Apply(const Vector2& local) const { return position + local.Rotate(c, s); }
+            Vector2 ApplyInverse(const Vector2& world) const { return (world - position).Rotate(c, -s); }
+            Vector2 Rotate(const Vector2& v) const { return v.Rotate(c, s); }
+            Vector2 RotateInverse(const Vector2& v) const { return v.Rotate(c, -s); }
+
+            /** @brief b を a のローカル座標で表した変換（a⁻¹ · b） */
+            static Transform Relative(const Transform& a, const Transform& b)
+            {
+                return { a.ApplyInverse(b.position), a.c * b.c + a.s * b.s, a.c * b.s - a.s * b.c };
+            }
+        };
+
+        /** @brief 凸多角形の 1 片（ローカル座標、反時計回り） */
+        struct ConvexPiece {
+            std::vector<Vector2> vertices;
+            std::vector<Vector2> normals;   // normals[i] は辺 i → i+1 の外向き単位法線
+            Vector2 center;                 // 頂点の平均（外接円の中心）
+            float radius = 0.0f;            // center からの最遠頂点までの距離
+        };
+
+        /**
+         * @class PolygonShape
+         * @brief 凹でもよい単純多角形を、凸片に分けてキャッシュした形状
+         *
+         * 作るときに一度だけ耳切りで三角形に分け、隣り合う片を凸のまま併合する（Hertel-Mehlhorn）。
+         * 凸な輪郭はそのまま 1 片になる。判定は Narrowphase.h の関数で行い、全体・片ごとの外接円で
+         * 先に弾くので、多角形の精度で判定しても遠い組のコストは円の判定と変わらない。
+         *
+         * 輪郭の向きはどちらでもよい。重複点・一直線上の点は取り除く。自己交差する輪郭は扱わない。
+         */
+        class PolygonShape {
+        public:
+            PolygonShape() = default;
+            explicit PolygonShape(const Vector2* outline, size_t count) { Set(outline, count); }
+            explicit PolygonShape(const std::vector<Vector2>& outline) { Set(outline.data(), outline.size()); }
+
+            void Set(const Vector2* outline, size_t count);
+
+            const std::vector<ConvexPiece>& Pieces() const { return m_pieces; }
+            bool IsConvex() const { return m_pieces.size() == 1; }
+            bool IsEmpty() const { return m_pieces.empty(); }
+            /** @brief ローカル原点からの最遠頂点までの距離（全体の外接円） */
+            float BoundingRadius() const { return m_radius; }
+
+        private:
+            std::vector<ConvexPiece> m_pieces;
+            float m_radius = 0.0f;
+        };
+
+    } // namespace Physics
+} // namespace NeonVector
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <NeonVector/Math/Vector2.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace NeonVector {
+    namespace Physics {
+
+        /** @brief TimeOfImpact が「このステップでは当たらない」ときに返す値（1 より大きい） */
+        constexpr float kNoImpact = 2.0f;
+
+        /** @brief 1 ステップの間に pos から pos + delta へ等速で動く円 */
+        struct MovingCircle {
+            Vector2 pos;
+            Vector2 delta;
+            float radius = 0.0f;
+        };
+
+        /** @brief 1 ステップの間に delta だけ平行移動する線分（壁・レーザーの柵など） */
+        struct MovingSegment {
+            Vector2 a;
+            Vector2 b;
+            Vector2 delta;
+        };
+
+        /** @brief 一括版の入力（movers[mover] と targets[target] の組） */
+        struct SweepPair {
+            uint32_t mover;
+            uint32_t target;
+        };
+
+        /** @brief 最初に触れる時刻 t ∈ [0, 1]（当たらなければ kNoImpact）と、target から mover へ向く単位法線 */
+        struct SweepHit {
+            float t;
+            Vector2 normal;
+        };
+
+        /**
+         * @brief d を巻き戻しの世界での最短の差にする
+         * @param wrap 世界の大きさ。0 の軸は巻き戻さない
+         */
+        inline Vector2 WrapDelta(Vector2 d, const Vector2& wrap)
+        {
+            if (wrap.x > 0.0f) d.x -= wrap.x * std::floor(d.x / wrap.x + 0.5f);
+            if (wrap.y > 0.0f) d.y -= wrap.y * std::floor(d.y / wrap.y + 0.5f);
+            return d;
+        }
+
+        /**
+         * @brief 動く円同士が最初に触れる時刻（連続衝突判定）
+         *
+         * 終点だけを調べる判定と違い、1 ステップで半径より長く進む弾も素通りしない。
+         * 相対運動に直して「点 vs 半径の和の円」の 2 次方程式を解く。始点で既に重なっていれば 0。
+         * wrap を与えると、始点で最も近い像どうしで解く（1 ステップの移動は世界の半分未満とする）。
+         */
+        float TimeOfImpact(const MovingCircle& mover, const MovingCircle& target,
+            const Vector2& wrap = Vector2{ 0.0f, 0.0f }, Vector2* normal = nullptr);
+
+        /** @brief 動く円が線分に最初に触れる時刻（線分を半径だけ太らせたカプセルとの交差） */
+        float TimeOfImpact(const MovingCircle& mover, const MovingSegment& target,
+            const Vector2& wrap = Vector2{ 0.0f, 0.0f }, Vector2* normal = nullptr);
+
+        /**
+         * @brief 多数の組をまとめて解く（ブロードフェーズの候補をそのまま渡す）
+         *
+         * 組を SIMD の幅ずつ SoA に集め、判定をレーン毎の選択で分岐なしに行う。
+         * 1 組版と同じカーネルを同じ順序で評価するので、結果はビット単位で一致する。
+         */
+        void TimeOfImpact(const MovingCircle* movers, const MovingCircle* targets,
+            const SweepPair* pairs, size_t count, const Vector2& wrap, SweepHit* out);
+        void TimeOfImpact(const MovingCircle* movers, const MovingSegment* targets,
+            const SweepPair* pairs, size_t count, const Vector2& wrap, SweepHit* out);
+
+    } // namespace Physics
+} // namespace NeonVector
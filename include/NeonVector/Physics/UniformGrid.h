@@ -0,0 +1,101 @@
+#pragma once
+
+#include <NeonVector/Math/Vector2.h>
+#include <NeonVector/Physics/Body.h>
+#include <vector>
+#include <cstdint>
+
+namespace NeonVector {
+    namespace Physics {
+
+        /** @brief 一括問い合わせの結果（query = 問い合わせの添字, user = 重なった物体） */
+        struct OverlapHit {
+            uint32_t query;
+            uint32_t user;
+        };
+
+        /**
+         * @class UniformGrid
+         * @brief 円で近似した物体の一様グリッド（ブロードフェーズ）
+         *
+         * 物体は外接矩形が重なるセル全てに登録される。問い合わせは近くのセルの物体とだけ
+         * 円同士の重なりを判定するので、コストは物体数の二乗ではなく局所的な密度に比例する。
+         *
+         * SetWrap で世界を [0, size) のトーラスにすると、端をまたぐ物体・問い合わせも
+         * 反対側のセルを見る（距離は最短の巻き戻し方向で測る）。このときセルは世界を
+         * 等分する大きさに丸められる。巻き戻しなしの場合、セル座標はハッシュで bucketCount 個に畳む。
+         *
+         * Update はセルの範囲が変わったときだけ付け替える（小さく動く物体は位置の書き換えだけ）。
+         * 問い合わせは const で、複数スレッドから同時に呼んでよい（登録・更新は不可）。
+         */
+        class UniformGrid {
+        public:
+            /** @param cellSize セルの一辺。典型的な物体の直径〜数倍にする */
+            explicit UniformGrid(float cellSize = 64.0f, size_t bucketCount = 4096);
+
+            /** @brief 世界を [0, size.x) × [0, size.y) のトーラスにする（登録済みの物体は付け替える） */
+            void SetWrap(const Vector2& size);
+            void DisableWrap();
+            bool IsWrapped() const { return m_wrap; }
+
+            BodyHandle Insert(const Vector2& center, float radius, uint32_t user);
+            void Update(BodyHandle h, const Vector2& center, float radius);
+            void Remove(BodyHandle h);
+            /** @brief 全て外す（発行済みのハンドルは全て無効になる） */
+            void Clear();
+
+            size_t Count() const { return m_bodies.size() - m_free.size(); }
+
+            /** @brief a から b への最短の差（巻き戻しありなら各軸 ±size/2 に収める） */
+            Vector2 Delta(const Vector2& a, const Vector2& b) const;
+
+            /** @brief 円（center, radius）と重なる物体の user を out に集める（重複なし） */
+            void QueryCircle(const Vector2& center, float radius, std::vector<uint32_t>& out) const;
+
+            /**
+             * @brief count 個の円をまとめて問い合わせる（弾 vs 敵のような多対多）
+             *
+             * radii が nullptr なら全て半径 radius。out は query の昇順（同じ query 内の順序は不定）。
+             */
+            void QueryCircles(const Vector2* centers, const float* radii, float radius, size_t count,
+                std::vector<OverlapHit>& out) const;
+
+            /** @brief 重なっている全ての組（各組 1 回, a < b） */
+            void FindPairs(std::vector<BodyPair>& out) const;
+
+        private:
+            struct Body {
+                Vector2 center;
+                float radius = 0.0f;
+                uint32_t user = 0;
+                int x0 = 0, y0 = 0, x1 = -1, y1 = -1;   // 登録中のセル範囲
+                uint32_t generation = 0;
+                bool alive = false;
+            };
+
+            Body* find(BodyHandle h);
+            void cellRange(const Vector2& center, float radius, int& x0, int& y0, int& x1, int& y1) const;
+            void insertCells(uint32_t index);
+            void removeCells(uint32_t index);
+            void rebuild();
+            size_t cellOf(int cx, int cy) const;
+            bool overlaps(const Body& b, const Vector2& center, float radius) const;
+
+            /** @brief セル範囲の各セル（m_cells の添字）に f を呼ぶ。同じセルは 1 回だけ */
+            template<class F>
+            void forEachCell(int x0, int y0, int x1, int y1, F&& f) const;
+
+        private:
+            float m_cellSize;
+            float m_invCellX, m_invCellY;
+            size_t m_bucketCount;
+            bool m_wrap = false;
+            Vector2 m_size;
+            int m_cellsX = 0, m_cellsY = 0;              // 巻き戻しありのときのセル数
+            std::vector<std::vector<uint32_t>> m_cells;  // セル（巻き戻しなしはハッシュのバケット）→ 物体
+            std::vector<Body> m_bodies;
+            std::vector<uint32_t> m_free;
+        };
+
+    } // namespace Physics
+} // namespace NeonVector
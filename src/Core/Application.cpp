@@ -1,4 +1,5 @@
 ﻿#include "NeonVector/Core/Application.h"
+#include "NeonVector/Core/JobSystem.h"
 #include "../DX12Context.h"
 #include <chrono>
 #include <iostream>
@@ -7,7 +8,7 @@
 namespace NeonVector
 {
     Application::Application(const ApplicationConfig &config)
-        : m_config(config), m_hwnd(nullptr), m_isRunning(false), m_context(nullptr)
+        : m_config(config), m_hwnd(nullptr), m_isRunning(false), m_context(nullptr), m_jobs(std::make_unique<JobSystem>(JobSystem::DefaultWorkerCount(), config.jobSlotsPerThread))
     {
     }
 
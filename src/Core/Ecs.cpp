@@ -0,0 +1,355 @@
+#include <NeonVector/Core/Ecs.h>
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+
+namespace NeonVector
+{
+    namespace Ecs
+    {
+
+        namespace Detail
+        {
+            namespace
+            {
+                struct Registry
+                {
+                    std::mutex mutex;
+                    ComponentInfo infos[kMaxComponents];
+                    ComponentId count = 0;
+                };
+
+                Registry &registry()
+                {
+                    static Registry r;
+                    return r;
+                }
+            }
+
+            ComponentId RegisterComponent(const ComponentInfo &info)
+            {
+                Registry &r = registry();
+                std::lock_guard<std::mutex> lock(r.mutex);
+                if (r.count >= kMaxComponents)
+                    throw std::length_error("Ecs: too many component types");
+                r.infos[r.count] = info;
+                return r.count++;
+            }
+
+            const ComponentInfo &GetComponentInfo(ComponentId id)
+            {
+                // 登録済みの要素は書き換えないので、読むだけならロック不要
+                return registry().infos[id];
+            }
+        }
+
+        namespace
+        {
+            size_t alignUp(size_t v, size_t a) { return (v + a - 1) / a * a; }
+
+            /** @brief capacity 行分の列を並べたときの大きさ（offsets に各列の位置を書く） */
+            size_t layout(const std::vector<ComponentId> &ids, size_t capacity, uint32_t *offsets)
+            {
+                size_t offset = sizeof(Entity) * capacity;
+                for (ComponentId id : ids)
+                {
+                    const ComponentInfo &info = Detail::GetComponentInfo(id);
+                    offset = alignUp(offset, info.align);
+                    offsets[id] = static_cast<uint32_t>(offset);
+                    offset += info.size * capacity;
+                }
+                return offset;
+            }
+
+            constexpr std::align_val_t kChunkAlign{64}; // キャッシュラインに揃える
+        }
+
+        // ---- Archetype ----
+
+        Archetype::Archetype(ComponentMask mask)
+            : m_mask(mask)
+        {
+            size_t rowBytes = sizeof(Entity);
+            for (ComponentId id = 0; id < kMaxComponents; ++id)
+            {
+                if ((mask >> id) & 1)
+                {
+                    m_ids.push_back(id);
+                    rowBytes += Detail::GetComponentInfo(id).size;
+                }
+            }
+            // 列ごとの揃え分の隙間を含めて収まる行数まで減らす（大きすぎる型でも 1 行は置く）
+            size_t capacity = std::max<size_t>(1, kChunkBytes / rowBytes);
+            while (capacity > 1 && layout(m_ids, capacity, m_offsets) > kChunkBytes)
+                --capacity;
+            m_capacity = static_cast<uint32_t>(capacity);
+            m_chunkBytes = std::max(kChunkBytes, layout(m_ids, capacity, m_offsets));
+        }
+
+        Archetype::~Archetype()
+        {
+            clear();
+            if (m_spare)
+                ::operator delete(m_spare, kChunkAlign);
+        }
+
+        void Archetype::allocateRow(Entity e, uint32_t &chunk, uint32_t &row)
+        {
+            if (m_chunks.empty() || m_chunks.back().count == m_capacity)
+            {
+                Chunk c;
+                c.data = m_spare ? m_spare : static_cast<std::byte *>(::operator new(m_chunkBytes, kChunkAlign));
+                m_spare = nullptr;
+                m_chunks.push_back(c);
+            }
+            Chunk &c = m_chunks.back();
+            chunk = static_cast<uint32_t>(m_chunks.size() - 1);
+            row = c.count++;
+            Entities(c)[row] = e;
+            ++m_count;
+        }
+
+        Entity Archetype::fillHole(uint32_t chunk, uint32_t row)
+        {
+            Chunk &last = m_chunks.back();
+            const uint32_t lastChunk = static_cast<uint32_t>(m_chunks.size() - 1);
+            const uint32_t lastRow = last.count - 1;
+            Entity moved;
+            if (chunk != lastChunk || row != lastRow)
+            {
+                Chunk &c = m_chunks[chunk];
+                for (ComponentId id : m_ids)
+                {
+                    const size_t size = Detail::GetComponentInfo(id).size;
+                    Detail::GetComponentInfo(id).relocate(static_cast<std::byte *>(Column(c, id)) + size * row,
+                                                          static_cast<std::byte *>(Column(last, id)) + size * lastRow);
+                }
+                moved = Entities(last)[lastRow];
+                Entities(c)[row] = moved;
+            }
+            --last.count;
+            --m_count;
+            // 空になった末尾のチャンクは外して予備に回す（境目で出入りを繰り返しても確保し直さない）
+            if (last.count == 0 && m_chunks.size() > 1)
+            {
+                if (m_spare)
+                    ::operator delete(m_spare, kChunkAlign);
+                m_spare = last.data;
+                m_chunks.pop_back();
+            }
+            return moved;
+        }
+
+        void Archetype::destroyRow(uint32_t chunk, uint32_t row)
+        {
+            Chunk &c = m_chunks[chunk];
+            for (ComponentId id : m_ids)
+            {
+                const ComponentInfo &info = Detail::GetComponentInfo(id);
+                info.destroy(static_cast<std::byte *>(Column(c, id)) + info.size * row);
+            }
+        }
+
+        void Archetype::clear()
+        {
+            for (uint32_t ci = 0; ci < m_chunks.size(); ++ci)
+            {
+                for (uint32_t row = 0; row < m_chunks[ci].count; ++row)
+                    destroyRow(ci, row);
+            }
+            // 予備を 1 つだけ残して返す（Clear と生成を繰り返してもチャンクが溜まらない）
+            for (Chunk &c : m_chunks)
+            {
+                if (!m_spare)
+                    m_spare = c.data;
+                else
+                    ::operator delete(c.data, kChunkAlign);
+            }
+            m_chunks.clear();
+            m_count = 0;
+        }
+
+        // ---- CommandBuffer ----
+
+        void CommandBuffer::Destroy(Entity e)
+        {
+            emplace<Entity>([](World &w, void *q) { w.Destroy(*static_cast<Entity *>(q)); }, e);
+        }
+
+        void CommandBuffer::Clear()
+        {
+            for (const Command &c : m_commands)
+                c.discard(c.payload);
+            m_commands.clear();
+            // 最後のブロックだけ使い回す
+            if (m_blocks.size() > 1)
+            {
+                std::unique_ptr<std::byte[]> keep = std::move(m_blocks.back());
+                m_blocks.clear();
+                m_blocks.push_back(std::move(keep));
+            }
+            m_blockUsed = m_blocks.empty() ? kBlockBytes : 0;
+        }
+
+        void *CommandBuffer::allocate(size_t size, size_t align)
+        {
+            // new[] の既定の揃え（__STDCPP_DEFAULT_NEW_ALIGNMENT__）を超える型は置けない
+            size_t offset = alignUp(m_blockUsed, align);
+            if (offset + size > m_blockSize)
+            {
+                m_blockSize = std::max(kBlockBytes, size);
+                m_blocks.push_back(std::make_unique<std::byte[]>(m_blockSize));
+                offset = 0;
+            }
+            m_blockUsed = offset + size;
+            return m_blocks.back().get() + offset;
+        }
+
+        // ---- World ----
+
+        void World::Destroy(Entity e)
+        {
+            if (!find(e))
+                return;
+            Record &r = m_records[e.index];
+            r.archetype->destroyRow(r.chunk, r.row);
+            fixMoved(r.archetype->fillHole(r.chunk, r.row), r.chunk, r.row);
+            r.archetype = nullptr;
+            ++r.generation;
+            m_free.push_back(e.index);
+            --m_count;
+        }
+
+        bool World::IsAlive(Entity e) const
+        {
+            return find(e) != nullptr;
+        }
+
+        void World::Clear()
+        {
+            for (auto &a : m_archetypes)
+                a->clear();
+            for (Record &r : m_records)
+            {
+                if (r.archetype)
+                {
+                    r.archetype = nullptr;
+                    ++r.generation;
+                }
+            }
+            m_free.clear();
+            for (uint32_t i = static_cast<uint32_t>(m_records.size()); i-- > 0;)
+                m_free.push_back(i);
+            m_count = 0;
+        }
+
+        void World::Playback(CommandBuffer &commands)
+        {
+            // 適用中に積まれた分（Playback の入れ子）は扱わない: 先に取り出してから適用する
+            std::vector<CommandBuffer::Command> list;
+            list.swap(commands.m_commands);
+            for (const CommandBuffer::Command &c : list)
+            {
+                c.apply(*this, c.payload);
+                c.discard(c.payload);
+            }
+            commands.Clear();
+        }
+
+        Entity World::allocateEntity()
+        {
+            uint32_t index;
+            if (!m_free.empty())
+            {
+                index = m_free.back();
+                m_free.pop_back();
+            }
+            else
+            {
+                index = static_cast<uint32_t>(m_records.size());
+                m_records.emplace_back();
+            }
+            return {index, m_records[index].generation};
+        }
+
+        const World::Record *World::find(Entity e) const
+        {
+            if (e.index >= m_records.size())
+                return nullptr;
+            const Record &r = m_records[e.index];
+            return (r.archetype && r.generation == e.generation) ? &r : nullptr;
+        }
+
+        Archetype *World::getArchetype(ComponentMask mask)
+        {
+            auto it = m_byMask.find(mask);
+            if (it != m_byMask.end())
+                return it->second;
+            m_archetypes.push_back(std::make_unique<Archetype>(mask));
+            Archetype *a = m_archetypes.back().get();
+            m_byMask.emplace(mask, a);
+            return a;
+        }
+
+        Archetype *World::withComponent(Archetype *from, ComponentId id)
+        {
+            if (!from->m_addEdges[id])
+                from->m_addEdges[id] = getArchetype(from->GetMask() | (ComponentMask(1) << id));
+            return from->m_addEdges[id];
+        }
+
+        Archetype *World::withoutComponent(Archetype *from, ComponentId id)
+        {
+            if (!from->m_removeEdges[id])
+                from->m_removeEdges[id] = getArchetype(from->GetMask() & ~(ComponentMask(1) << id));
+            return from->m_removeEdges[id];
+        }
+
+        void World::moveEntity(Entity e, Record &r, Archetype *to)
+        {
+            Archetype *from = r.archetype;
+            uint32_t chunk, row;
+            to->allocateRow(e, chunk, row);
+
+            const Archetype::Chunk &src = from->m_chunks[r.chunk];
+            const Archetype::Chunk &dst = to->m_chunks[chunk];
+            for (ComponentId id : from->m_ids)
+            {
+                const ComponentInfo &info = Detail::GetComponentInfo(id);
+                std::byte *s = static_cast<std::byte *>(from->Column(src, id)) + info.size * r.row;
+                if (to->Has(id))
+                    info.relocate(static_cast<std::byte *>(to->Column(dst, id)) + info.size * row, s);
+                else
+                    info.destroy(s);
+            }
+            fixMoved(from->fillHole(r.chunk, r.row), r.chunk, r.row);
+
+            r.archetype = to;
+            r.chunk = chunk;
+            r.row = row;
+        }
+
+        void World::fixMoved(Entity moved, uint32_t chunk, uint32_t row)
+        {
+            if (!moved.IsValid())
+                return;
+            Record &m = m_records[moved.index];
+            m.chunk = chunk;
+            m.row = row;
+        }
+
+        const std::vector<Archetype *> &World::matching(ComponentMask mask)
+        {
+            // アーキタイプは増える一方なので、前回から増えた分だけ調べて足す
+            QueryCache &q = m_queries[mask];
+            for (; q.scanned < m_archetypes.size(); ++q.scanned)
+            {
+                Archetype *a = m_archetypes[q.scanned].get();
+                if ((a->GetMask() & mask) == mask)
+                    q.archetypes.push_back(a);
+            }
+            return q.archetypes;
+        }
+
+    } // namespace Ecs
+} // namespace NeonVector
@@ -0,0 +1,292 @@
+#include "NeonVector/Core/JobSystem.h"
+#include <algorithm>
+
+namespace NeonVector
+{
+    namespace
+    {
+        // 呼び出しスレッドがどの JobSystem の何番か（属さなければ nullptr）
+        thread_local const JobSystem *t_system = nullptr;
+        thread_local unsigned t_index = ~0u;
+
+        constexpr int kSpinBeforeSleep = 64; // 眠る前に盗みを試す回数
+
+        struct Range
+        {
+            JobSystem *system;
+            void (*fn)(void *ctx, size_t begin, size_t end);
+            void *ctx;
+            size_t count;
+            size_t grain;
+            JobCounter *counter;
+        };
+
+        /** @brief チャンク [c0, c1) を担当するジョブ。右半分を積みながら左へ縮め、最後の 1 チャンクを自分で処理する */
+        struct RangeJob
+        {
+            const Range *range;
+            size_t c0, c1;
+
+            void operator()() const
+            {
+                const Range &r = *range;
+                size_t end = c1;
+                while (end - c0 > 1)
+                {
+                    const size_t mid = c0 + (end - c0) / 2;
+                    r.system->Spawn(*r.counter, RangeJob{range, mid, end});
+                    end = mid;
+                }
+                const size_t begin = c0 * r.grain;
+                r.fn(r.ctx, begin, std::min(r.count, begin + r.grain));
+            }
+        };
+    }
+
+    // ---- Deque ----
+    // Lê, Pop, Cohen, Nardelli "Correct and Efficient Work-Stealing for Weak Memory Models" の固定長版
+
+    JobSystem::Deque::Deque(size_t capacity)
+        : m_buffer(new std::atomic<Job *>[capacity]), m_mask(static_cast<int64_t>(capacity) - 1)
+    {
+    }
+
+    bool JobSystem::Deque::Push(Job *job)
+    {
+        const int64_t b = m_bottom.load(std::memory_order_relaxed);
+        const int64_t t = m_top.load(std::memory_order_acquire);
+        if (b - t > m_mask)
+            return false;
+        m_buffer[b & m_mask].store(job, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    JobSystem::Job *JobSystem::Deque::Pop()
+    {
+        const int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = m_top.load(std::memory_order_relaxed);
+        if (t > b)
+        {
+            // 空だった
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Job *job = m_buffer[b & m_mask].load(std::memory_order_relaxed);
+        if (t == b)
+        {
+            // 最後の 1 つは盗む側と取り合う
+            if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                job = nullptr;
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    JobSystem::Job *JobSystem::Deque::Steal()
+    {
+        int64_t t = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = m_bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return nullptr;
+        Job *job = m_buffer[t & m_mask].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+        return job;
+    }
+
+    // ---- JobSystem ----
+
+    JobSystem::JobSystem(unsigned workerCount, size_t jobSlots)
+    {
+        size_t slots = 2;
+        while (slots < jobSlots)
+            slots *= 2;
+        m_slots.reserve(workerCount + 1);
+        for (unsigned i = 0; i <= workerCount; ++i)
+        {
+            m_slots.push_back(std::make_unique<Worker>(slots));
+            m_slots.back()->rng = 0x9E3779B9u * (i + 1);
+        }
+        // 作ったスレッドが既に別の JobSystem に属していれば、破棄のときに戻す
+        m_prevSystem = t_system;
+        m_prevIndex = t_index;
+        t_system = this;
+        t_index = 0;
+
+        m_workers.reserve(workerCount);
+        for (unsigned i = 1; i <= workerCount; ++i)
+            m_workers.emplace_back([this, i]
+                                   { workerLoop(i); });
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop.store(true);
+        }
+        m_wake.notify_all();
+        for (auto &t : m_workers)
+            t.join();
+        if (t_system == this)
+        {
+            t_system = m_prevSystem;
+            t_index = m_prevIndex;
+        }
+    }
+
+    unsigned JobSystem::DefaultWorkerCount()
+    {
+        unsigned hw = std::thread::hardware_concurrency();
+        return (hw > 1) ? hw - 1 : 0;
+    }
+
+    unsigned JobSystem::GetWorkerIndex() const
+    {
+        return t_system == this ? t_index : ~0u;
+    }
+
+    void JobSystem::Wait(JobCounter &counter)
+    {
+        const unsigned self = GetWorkerIndex();
+        while (!counter.IsDone())
+        {
+            if (Job *job = findJob(self))
+                execute(job);
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    JobSystem::Job *JobSystem::allocateJob()
+    {
+        const unsigned self = GetWorkerIndex();
+        if (self == ~0u)
+            return nullptr;
+        Worker &w = *m_slots[self];
+        Job &job = w.jobs[w.nextJob & w.jobMask];
+        // 一周して戻ってきた枠がまだ使われていれば、積まずにその場で実行させる
+        if (job.busy.load(std::memory_order_acquire))
+            return nullptr;
+        job.busy.store(true, std::memory_order_relaxed);
+        ++w.nextJob;
+        return &job;
+    }
+
+    void JobSystem::push(Job *job)
+    {
+        // 先に数を増やしておけば、盗んだ側の減算が追い越しても負にならない
+        m_queued.fetch_add(1, std::memory_order_seq_cst);
+        if (!m_slots[GetWorkerIndex()]->deque.Push(job))
+        {
+            m_queued.fetch_sub(1, std::memory_order_relaxed);
+            execute(job);
+            return;
+        }
+        if (m_sleeping.load(std::memory_order_seq_cst) > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_wake.notify_one();
+        }
+    }
+
+    JobSystem::Job *JobSystem::findJob(unsigned self)
+    {
+        Job *job = nullptr;
+        if (self != ~0u)
+            job = m_slots[self]->deque.Pop();
+        if (!job)
+        {
+            // 盗む相手は乱数で決めた位置から一巡する（同じ相手に集中しない）
+            const size_t n = m_slots.size();
+            size_t start = 0;
+            if (self != ~0u)
+            {
+                uint32_t &x = m_slots[self]->rng;
+                x ^= x << 13;
+                x ^= x >> 17;
+                x ^= x << 5;
+                start = x % n;
+            }
+            for (size_t k = 0; k < n && !job; ++k)
+            {
+                const size_t victim = (start + k) % n;
+                if (victim != self)
+                    job = m_slots[victim]->deque.Steal();
+            }
+        }
+        if (job)
+            m_queued.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    void JobSystem::execute(Job *job)
+    {
+        JobCounter &counter = *job->counter;
+        job->run(job->payload);
+        job->busy.store(false, std::memory_order_release);
+        finish(counter);
+    }
+
+    void JobSystem::finish(JobCounter &counter)
+    {
+        counter.m_pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void JobSystem::workerLoop(unsigned index)
+    {
+        t_system = this;
+        t_index = index;
+        for (;;)
+        {
+            Job *job = findJob(index);
+            for (int spin = 0; !job && spin < kSpinBeforeSleep; ++spin)
+            {
+                std::this_thread::yield();
+                job = findJob(index);
+            }
+            if (job)
+            {
+                execute(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+            m_wake.wait(lock, [this]
+                        { return m_stop.load() || m_queued.load(std::memory_order_seq_cst) > 0; });
+            m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+            if (m_stop.load())
+                return;
+        }
+    }
+
+    void JobSystem::parallelFor(size_t count, size_t grain, RangeFn fn, void *ctx)
+    {
+        if (count == 0)
+            return;
+        if (grain == 0)
+            grain = 1;
+
+        const size_t chunks = (count + grain - 1) / grain;
+        if (chunks == 1 || m_workers.empty() || GetWorkerIndex() == ~0u)
+        {
+            // 並列にしないときも、チャンクの区切りは並列のときと同じにする
+            for (size_t begin = 0; begin < count; begin += grain)
+                fn(ctx, begin, std::min(count, begin + grain));
+            return;
+        }
+
+        JobCounter counter;
+        const Range range{this, fn, ctx, count, grain, &counter};
+        // 呼び出しスレッドが最初のジョブを直接こなし、その間に積んだ右半分が盗まれていく
+        RangeJob{&range, 0, chunks}();
+        Wait(counter);
+    }
+
+} // namespace NeonVector
@@ -0,0 +1,293 @@
+#include "NeonVector/Core/PackedColor.h"
+#include "NeonVector/Math/Simd.h"
+#include <algorithm>
+#include <cmath>
+
+namespace NeonVector
+{
+    namespace
+    {
+        constexpr size_t kHueSteps = 1536;      // 6 区間 × 256 段（区間の境目が必ず段に乗る）
+        constexpr size_t kSrgbSteps = 4096;     // 線形 → sRGB の段数
+        constexpr size_t kBlock = 64;           // half ↔ RGBA8 の中継に使う色数
+
+        struct Tables
+        {
+            float srgbToLinear[256];
+            uint8_t linearToSrgb[kSrgbSteps];
+            uint8_t hue[kHueSteps][3];          // s = v = 1 の RGB
+
+            Tables()
+            {
+                for (size_t i = 0; i < 256; ++i)
+                    srgbToLinear[i] = ColorSpace::SrgbToLinear(static_cast<float>(i) / 255.0f);
+                for (size_t i = 0; i < kSrgbSteps; ++i)
+                {
+                    const float l = static_cast<float>(i) / static_cast<float>(kSrgbSteps - 1);
+                    linearToSrgb[i] = ColorRGBA8::ToUnorm8(ColorSpace::LinearToSrgb(l));
+                }
+                for (size_t i = 0; i < kHueSteps; ++i)
+                {
+                    const Color c = ColorSpace::HsvToRgb(static_cast<float>(i) / kHueSteps, 1.0f, 1.0f);
+                    hue[i][0] = ColorRGBA8::ToUnorm8(c.r);
+                    hue[i][1] = ColorRGBA8::ToUnorm8(c.g);
+                    hue[i][2] = ColorRGBA8::ToUnorm8(c.b);
+                }
+            }
+        };
+
+        const Tables &tables()
+        {
+            static const Tables t;
+            return t;
+        }
+
+        // h mod 1（SSE2 の floor は libm 呼び出しになるので整数変換で。|h| < 2^31 を仮定）
+        float wrapHue(float h)
+        {
+            h -= static_cast<float>(static_cast<int>(h));
+            if (h < 0.0f)
+                h += 1.0f;
+            return (h < 1.0f) ? h : 0.0f;   // -1e-9 などで 1.0 に丸まる場合
+        }
+
+        using Simd::Float4;
+        using Simd::Int4;
+
+        // float × 4 → half × 4（各 32bit レーンの下位 16bit。ColorHalf4::FloatToHalf と同じ手順）
+        Int4 floatToHalf4(Float4 f)
+        {
+            const Float4 justSign = f & Float4::Set1(-0.0f);
+            const Float4 absf = f ^ justSign;
+            const Int4 bits = Simd::AsInt(absf);
+            const Int4 magic = Int4::Set1(0x3F000000);
+
+            const Float4 isNan = Simd::IsNan(absf);
+            const Int4 isRegular = Simd::Greater(Int4::Set1(0x47800000), bits);
+            const Int4 special = (Simd::AsInt(isNan) & Int4::Set1(0x200)) | Int4::Set1(0x7C00);
+            const Int4 isSub = Simd::Greater(Int4::Set1(0x38800000), bits);
+
+            const Int4 sub = Simd::AsInt(absf + Simd::AsFloat(magic)) - magic;
+            const Int4 odd = Simd::ShiftRight<31>(Simd::ShiftLeft<18>(bits));
+            const Int4 normal = Simd::ShiftRight<13>((bits + Int4::Set1(static_cast<int32_t>(0xC8000FFFu))) + odd);
+
+            const Int4 finite = (isSub & sub) | Simd::AndNot(isSub, normal);
+            const Int4 joined = (isRegular & finite) | Simd::AndNot(isRegular, special);
+            return joined | Simd::ShiftRight<16>(Simd::AsInt(justSign));
+        }
+
+        // half × 4（32bit レーンの下位 16bit）→ float × 4（ColorHalf4::HalfToFloat と同じ手順。
+        // 2^112 倍する方法は half の非正規化数で浮動小数点の非正規化数を経由して遅いので使わない）
+        Float4 halfToFloat4(Int4 h)
+        {
+            const Int4 shiftedExp = Int4::Set1(0x7C00 << 13);
+            const Int4 expMant = h & Int4::Set1(0x7FFF);
+            const Int4 sign = Simd::ShiftLeft<16>(h ^ expMant);
+            Int4 u = Simd::ShiftLeft<13>(expMant);
+            const Int4 exp = u & shiftedExp;
+            const Int4 isInfNan = Simd::Equal(exp, shiftedExp);
+            const Int4 isSub = Simd::Equal(exp, Int4::Set1(0));
+            u = u + Int4::Set1((127 - 15) << 23);
+            u = u + (isInfNan & Int4::Set1((128 - 16) << 23));
+            u = u + (isSub & Int4::Set1(1 << 23));
+            const Float4 f = Simd::AsFloat(u) - (Simd::AsFloat(isSub) & Float4::Set1(6.103515625e-05f));
+            return f | Simd::AsFloat(sign);
+        }
+    }
+
+    namespace ColorBatch
+    {
+        void Pack(const Color *in, ColorRGBA8 *out, size_t count)
+        {
+            const Float4 zero = Float4::Set1(0.0f);
+            const Float4 one = Float4::Set1(1.0f);
+            const Float4 scale = Float4::Set1(255.0f);
+            const Float4 half = Float4::Set1(0.5f);
+            auto quantize = [&](const Color &c)
+            {
+                const Float4 v = Simd::Min(Simd::Max(Float4::Load(&c.r), zero), one);
+                return Simd::TruncateToInt(v * scale + half);
+            };
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+                Simd::NarrowSaturate8(quantize(in[i]), quantize(in[i + 1]), quantize(in[i + 2]), quantize(in[i + 3]))
+                    .Store(out + i);
+            for (; i < count; ++i)
+                out[i] = ColorRGBA8::FromColor(in[i]);
+        }
+
+        void Unpack(const ColorRGBA8 *in, Color *out, size_t count)
+        {
+            const Float4 k = Float4::Set1(1.0f / 255.0f);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                const Int4 bytes = Int4::Load(in + i);
+                (Simd::ToFloat(Simd::Widen8<0>(bytes)) * k).Store(&out[i].r);
+                (Simd::ToFloat(Simd::Widen8<1>(bytes)) * k).Store(&out[i + 1].r);
+                (Simd::ToFloat(Simd::Widen8<2>(bytes)) * k).Store(&out[i + 2].r);
+                (Simd::ToFloat(Simd::Widen8<3>(bytes)) * k).Store(&out[i + 3].r);
+            }
+            for (; i < count; ++i)
+                out[i] = in[i].ToColor();
+        }
+
+        void ToHalf(const Color *in, ColorHalf4 *out, size_t count)
+        {
+            size_t i = 0;
+            for (; i + 2 <= count; i += 2)
+            {
+                const Int4 a = floatToHalf4(Float4::Load(&in[i].r));
+                const Int4 b = floatToHalf4(Float4::Load(&in[i + 1].r));
+                Simd::Narrow16(a, b).Store(out + i);
+            }
+            for (; i < count; ++i)
+                out[i] = ColorHalf4::FromColor(in[i]);
+        }
+
+        void FromHalf(const ColorHalf4 *in, Color *out, size_t count)
+        {
+            size_t i = 0;
+            for (; i + 2 <= count; i += 2)
+            {
+                const Int4 h = Int4::Load(in + i);
+                halfToFloat4(Simd::Widen16<0>(h)).Store(&out[i].r);
+                halfToFloat4(Simd::Widen16<1>(h)).Store(&out[i + 1].r);
+            }
+            for (; i < count; ++i)
+                out[i] = in[i].ToColor();
+        }
+
+        void HalfToRGBA8(const ColorHalf4 *in, ColorRGBA8 *out, size_t count)
+        {
+            Color work[kBlock];
+            for (size_t i = 0; i < count; i += kBlock)
+            {
+                const size_t n = std::min(kBlock, count - i);
+                FromHalf(in + i, work, n);
+                Pack(work, out + i, n);
+            }
+        }
+
+        void RGBA8ToHalf(const ColorRGBA8 *in, ColorHalf4 *out, size_t count)
+        {
+            Color work[kBlock];
+            for (size_t i = 0; i < count; i += kBlock)
+            {
+                const size_t n = std::min(kBlock, count - i);
+                Unpack(in + i, work, n);
+                ToHalf(work, out + i, n);
+            }
+        }
+
+        void LinearToSrgb(const Color *in, ColorRGBA8 *out, size_t count)
+        {
+            const Tables &t = tables();
+            // 表の添字（rgb）と α の 8bit 値を 1 色分まとめて求め、表引きだけ 1 成分ずつ行う
+            // （ColorSpace::LinearToSrgb8 / ColorRGBA8::ToUnorm8 と同じ丸め）
+            const Float4 zero = Float4::Set1(0.0f);
+            const Float4 one = Float4::Set1(1.0f);
+            constexpr float kSteps = static_cast<float>(kSrgbSteps - 1);
+            const float scales[4] = {kSteps, kSteps, kSteps, 255.0f};
+            const Float4 scale = Float4::Load(scales);
+            const Float4 half = Float4::Set1(0.5f);
+            int32_t idx[4];
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Float4 v = Simd::Min(Simd::Max(Float4::Load(&in[i].r), zero), one);
+                Simd::TruncateToInt(v * scale + half).Store(idx);
+                out[i] = ColorRGBA8::FromBytes(t.linearToSrgb[idx[0]], t.linearToSrgb[idx[1]],
+                                               t.linearToSrgb[idx[2]], static_cast<uint8_t>(idx[3]));
+            }
+        }
+
+        void SrgbToLinear(const ColorRGBA8 *in, Color *out, size_t count)
+        {
+            const Tables &t = tables();
+            constexpr float k = 1.0f / 255.0f;
+            for (size_t i = 0; i < count; ++i)
+            {
+                out[i] = {t.srgbToLinear[in[i].r], t.srgbToLinear[in[i].g],
+                          t.srgbToLinear[in[i].b], in[i].a * k};
+            }
+        }
+    }
+
+    namespace ColorSpace
+    {
+        Color HsvToRgb(float h, float s, float v, float a)
+        {
+            // 各成分 = v - v s clamp(min(k, 4 - k), 0, 1), k = (n + 6h) mod 6（n = 5, 3, 1）
+            const float h6 = wrapHue(h) * 6.0f;
+            auto channel = [&](float n)
+            {
+                float k = n + h6;
+                if (k >= 6.0f)
+                    k -= 6.0f;
+                const float w = std::min(std::max(std::min(k, 4.0f - k), 0.0f), 1.0f);
+                return v - v * s * w;
+            };
+            return {channel(5.0f), channel(3.0f), channel(1.0f), a};
+        }
+
+        void RgbToHsv(const Color &c, float &h, float &s, float &v)
+        {
+            const float mx = std::max({c.r, c.g, c.b});
+            const float mn = std::min({c.r, c.g, c.b});
+            const float d = mx - mn;
+            v = mx;
+            s = (mx > 0.0f) ? d / mx : 0.0f;
+            if (d <= 0.0f)
+            {
+                h = 0.0f;
+                return;
+            }
+            float hh;
+            if (mx == c.r)
+                hh = (c.g - c.b) / d;
+            else if (mx == c.g)
+                hh = 2.0f + (c.b - c.r) / d;
+            else
+                hh = 4.0f + (c.r - c.g) / d;
+            h = wrapHue(hh / 6.0f);
+        }
+
+        ColorRGBA8 HsvToRGBA8(float h, float s, float v, float a)
+        {
+            size_t i = static_cast<size_t>(wrapHue(h) * kHueSteps + 0.5f);
+            i = (i < kHueSteps) ? i : 0;
+            const uint8_t *rgb = tables().hue[i];
+            if (s == 1.0f && v == 1.0f)
+                return ColorRGBA8::FromBytes(rgb[0], rgb[1], rgb[2], ColorRGBA8::ToUnorm8(a));
+            // 彩度 1 の色を白（v）との間で補間: v (1 - s (1 - hue)) = base + slope · hue
+            const float base = v * (1.0f - s);
+            const float slope = v * s * (1.0f / 255.0f);
+            auto channel = [&](uint8_t c)
+            { return ColorRGBA8::ToUnorm8(base + slope * c); };
+            return ColorRGBA8::FromBytes(channel(rgb[0]), channel(rgb[1]), channel(rgb[2]), ColorRGBA8::ToUnorm8(a));
+        }
+
+        float SrgbToLinear(float c)
+        {
+            return (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float LinearToSrgb(float c)
+        {
+            return (c <= 0.0031308f) ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+        }
+
+        float SrgbToLinear(uint8_t c)
+        {
+            return tables().srgbToLinear[c];
+        }
+
+        uint8_t LinearToSrgb8(float c)
+        {
+            c = (c > 0.0f) ? c : 0.0f;
+            c = (c < 1.0f) ? c : 1.0f;
+            return tables().linearToSrgb[static_cast<size_t>(c * static_cast<float>(kSrgbSteps - 1) + 0.5f)];
+        }
+    }
+
+} // namespace NeonVector
@@ -0,0 +1,175 @@
+#include "NeonVector/Core/SystemScheduler.h"
+#include "NeonVector/Core/JobSystem.h"
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+namespace NeonVector
+{
+    namespace Detail
+    {
+        uint32_t RegisterAccessType()
+        {
+            static std::atomic<uint32_t> count{0};
+            const uint32_t id = count.fetch_add(1, std::memory_order_relaxed);
+            if (id >= kMaxAccessTypes)
+                throw std::length_error("SystemAccess: too many data types");
+            return id;
+        }
+    }
+
+    SystemScheduler::SystemScheduler(JobSystem *jobs)
+        : m_jobs(jobs)
+    {
+    }
+
+    uint32_t SystemScheduler::Add(std::string name, const SystemAccess &access, SystemFn fn)
+    {
+        System s;
+        s.name = std::move(name);
+        s.access = access;
+        s.fn = std::move(fn);
+        m_systems.push_back(std::move(s));
+        return static_cast<uint32_t>(m_systems.size() - 1);
+    }
+
+    void SystemScheduler::SetEnabled(uint32_t system, bool enabled)
+    {
+        if (system < m_systems.size())
+            m_systems[system].enabled = enabled;
+    }
+
+    void SystemScheduler::Run(float dt)
+    {
+        buildGraph();
+        m_trace.assign(m_order.size(), SystemTraceEvent{});
+        m_start = std::chrono::steady_clock::now();
+
+        if (!m_jobs)
+        {
+            // 登録順は依存の向きと一致するので、そのまま直列に呼べばよい
+            for (uint32_t node = 0; node < m_order.size(); ++node)
+                runNode(node, dt, nullptr);
+        }
+        else
+        {
+            // 根を先に全て拾う（積んだ根が終わって 0 になった後続を、ここで重ねて積まない）
+            m_roots.clear();
+            for (uint32_t node = 0; node < m_order.size(); ++node)
+                if (m_waiting[node].load(std::memory_order_relaxed) == 0)
+                    m_roots.push_back(node);
+            JobCounter done;
+            for (uint32_t node : m_roots)
+                spawn(node, dt, done);
+            m_jobs->Wait(done);
+        }
+
+        std::sort(m_trace.begin(), m_trace.end(), [](const SystemTraceEvent &a, const SystemTraceEvent &b)
+                  { return a.beginUs < b.beginUs; });
+    }
+
+    void SystemScheduler::buildGraph()
+    {
+        m_order.clear();
+        for (uint32_t i = 0; i < m_systems.size(); ++i)
+            if (m_systems[i].enabled)
+                m_order.push_back(i);
+
+        const size_t n = m_order.size();
+        m_successors.resize(n);
+        m_predecessors.resize(n);
+        if (m_waiting.size() != n)
+            m_waiting = std::vector<std::atomic<uint32_t>>(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            m_successors[i].clear();
+            m_predecessors[i].clear();
+            m_waiting[i].store(0, std::memory_order_relaxed);
+        }
+        // 衝突する組は登録順に辺を張る（辺は常に前から後ろなので閉路はできない）
+        for (uint32_t j = 0; j < n; ++j)
+        {
+            const SystemAccess &aj = m_systems[m_order[j]].access;
+            for (uint32_t i = 0; i < j; ++i)
+            {
+                if (!m_systems[m_order[i]].access.ConflictsWith(aj))
+                    continue;
+                m_successors[i].push_back(j);
+                m_predecessors[j].push_back(i);
+                m_waiting[j].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void SystemScheduler::spawn(uint32_t node, float dt, JobCounter &done)
+    {
+        JobCounter *counter = &done;
+        m_jobs->Spawn(done, [this, node, dt, counter]
+                      { runNode(node, dt, counter); });
+    }
+
+    void SystemScheduler::runNode(uint32_t node, float dt, JobCounter *done)
+    {
+        using Clock = std::chrono::steady_clock;
+        System &s = m_systems[m_order[node]];
+        const Clock::time_point begin = Clock::now();
+        s.fn(dt);
+        const Clock::time_point end = Clock::now();
+
+        SystemTraceEvent &ev = m_trace[node];
+        ev.system = m_order[node];
+        ev.worker = m_jobs ? m_jobs->GetWorkerIndex() : 0;
+        ev.beginUs = std::chrono::duration<double, std::micro>(begin - m_start).count();
+        ev.endUs = std::chrono::duration<double, std::micro>(end - m_start).count();
+        ev.after.clear();
+        for (uint32_t p : m_predecessors[node])
+            ev.after.push_back(m_order[p]);
+
+        // 最後に終わった先行システムが後続を積む（done は自分が終わる前に増えるので途中で 0 にならない）
+        if (!done)
+            return;
+        for (uint32_t next : m_successors[node])
+            if (m_waiting[next].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                spawn(next, dt, *done);
+    }
+
+    std::string SystemScheduler::FormatTraceJson() const
+    {
+        auto quote = [](std::string &out, const std::string &text)
+        {
+            out += '"';
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                    out += '\\';
+                if (static_cast<unsigned char>(c) >= 0x20)
+                    out += c;
+            }
+            out += '"';
+        };
+
+        std::string out = "{\"traceEvents\":[";
+        char buf[128];
+        for (size_t i = 0; i < m_trace.size(); ++i)
+        {
+            const SystemTraceEvent &ev = m_trace[i];
+            if (i)
+                out += ',';
+            out += "{\"name\":";
+            quote(out, m_systems[ev.system].name);
+            std::snprintf(buf, sizeof(buf), ",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"after\":[",
+                          ev.worker, ev.beginUs, ev.endUs - ev.beginUs);
+            out += buf;
+            for (size_t k = 0; k < ev.after.size(); ++k)
+            {
+                if (k)
+                    out += ',';
+                quote(out, m_systems[ev.after[k]].name);
+            }
+            out += "]}}";
+        }
+        out += "]}";
+        return out;
+    }
+
+} // namespace NeonVector
@@ -0,0 +1,137 @@
+#include <NeonVector/Effects/AnalyticParticleSystem.h>
+#include <NeonVector/Effects/ParticleStep.h>
+#include <NeonVector/Graphics/LineBatcher.h>
+#include <NeonVector/Math/FastMath.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace NeonVector {
+    namespace Effects {
+
+        AnalyticParticleSystem::AnalyticParticleSystem()
+            : m_rng((static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}())
+        {
+        }
+
+        void AnalyticParticleSystem::Emit(const Vector2& pos, int count,
+            float minSpeed, float maxSpeed,
+            const Color& color, float life, float size)
+        {
+            if (count <= 0) return;
+
+            // 巻き戻し中の放出: 今より後の記録を捨てて履歴を分岐させる
+            while (m_spawns.size() > m_head && m_spawns.back().spawnTime > m_time)
+                m_spawns.pop_back();
+
+            const size_t n = static_cast<size_t>(count);
+            const uint32_t firstId = static_cast<uint32_t>(m_rng.GetCounter());   // 1 回で 3n 進むので重ならない
+            m_emitScratch.resize(n * 5);
+            float* angle = m_emitScratch.data();
+            float* speedU = angle + n;
+            float* lifeU = speedU + n;
+            float* sn = lifeU + n;
+            float* cs = sn + n;
+            m_rng.FillUniform(angle, n, 0.0f, 1.0f);
+            m_rng.FillUniform(speedU, n, 0.0f, 1.0f);
+            m_rng.FillUniform(lifeU, n, 0.0f, 1.0f);
+            for (size_t i = 0; i < n; ++i)
+                angle[i] = EmitSampler<float>::Angle(angle[i]);
+            FastMath::SinCos(angle, sn, cs, n);
+
+            const EmitSampler<float> sample(minSpeed, maxSpeed, life);
+            const ColorRGBA8 packed = ColorRGBA8::FromColor(color);
+            for (size_t i = 0; i < n; ++i) {
+                ParticleSpawn s;
+                s.origin = pos;
+                s.velocity = EmitSampler<float>::Velocity<Vector2>(sn[i], cs[i], sample.Speed(speedU[i]));
+                s.spawnTime = m_time;
+                s.lifetime = sample.Life(lifeU[i]);
+                s.id = firstId + static_cast<uint32_t>(i);
+                s.color = packed;
+                s.size = size;
+                m_spawns.push_back(s);
+            }
+        }
+
+        void AnalyticParticleSystem::Update(float dt)
+        {
+            m_time += dt;
+
+            // 先頭（最古）から、期限切れ後に巻き戻し窓も過ぎた記録を捨てる。
+            // 寿命に個体差があるので途中の期限切れは Draw で飛ばす。
+            while (m_head < m_spawns.size() &&
+                m_time - m_spawns[m_head].spawnTime >= m_spawns[m_head].lifetime + m_rewindWindow)
+                ++m_head;
+
+            // 捨てた分が半分を超えたら前へ詰める（償却 O(1)）
+            if (m_head > 0 && m_head * 2 >= m_spawns.size()) {
+                m_spawns.erase(m_spawns.begin(), m_spawns.begin() + m_head);
+                m_head = 0;
+            }
+        }
+
+        void AnalyticParticleSystem::Draw(Graphics::LineBatcher* batcher, float glow) const
+        {
+            if (!batcher) return;
+
+            // 時刻 t の位置・速度を閉じた式で評価（drag == 1 のときは等加速度運動）
+            const float drag = std::max(m_drag, 1e-6f);
+            const float k = std::log(drag);
+            const FastMath::ConstPow dragPow(drag);   // exp(k t) = drag^t
+            const bool noDrag = std::fabs(k) < 1e-6f;
+            const float invK = noDrag ? 0.0f : 1.0f / k;
+            const float gOverK = m_gravity * invK;
+
+            const ParticleSpawn* src = m_spawns.data() + m_head;
+            const size_t n = m_spawns.size() - m_head;
+            size_t done = 0;
+            while (done < n) {
+                if (batcher->GetFreeLineCount() == 0) {
+                    batcher->Flush();
+                    if (batcher->GetFreeLineCount() == 0)
+                        return;
+                }
+                const size_t k0 = std::min(n - done, batcher->GetFreeLineCount());
+                Graphics::LineVertex* out = batcher->AllocateLines(k0);
+                size_t w = 0;
+                for (size_t i = done; i < done + k0; ++i) {
+                    const ParticleSpawn& s = src[i];
+                    const float t = m_time - s.spawnTime;
+                    if (t < 0.0f || t >= s.lifetime) continue;   // 未来 or 期限切れ
+
+                    Vector2 p, v;
+                    if (noDrag) {
+                        v = { s.velocity.x, s.velocity.y + m_gravity * t };
+                        p = { s.origin.x + s.velocity.x * t,
+                              s.origin.y + s.velocity.y * t + 0.5f * m_gravity * t * t };
+                    } else {
+                        const float e = dragPow.Eval(t);
+                        const float em1 = e - 1.0f;
+                        v = { s.velocity.x * e, s.velocity.y * e + gOverK * em1 };
+                        p = { s.origin.x + s.velocity.x * em1 * invK,
+                              s.origin.y + s.velocity.y * em1 * invK + gOverK * (em1 * invK - t) };
+                    }
+
+                    const ColorRGBA8 c = s.color.WithAlphaScaled(1.0f - t / s.lifetime);   // 1→0 で消える
+
+                    const float speed = v.Length();
+                    const Vector2 half = (speed > 1e-3f) ? v * (s.size * 0.5f / speed)
+                                                         : Vector2{ s.size * 0.5f, 0.0f };
+                    out[w * 2] = Graphics::LineVertex(p - half, c, s.size * 0.6f, glow);
+                    out[w * 2 + 1] = Graphics::LineVertex(p + half, c, s.size * 0.6f, glow);
+                    ++w;
+                }
+                batcher->ReleaseLines(k0 - w);
+                done += k0;
+            }
+        }
+
+        void AnalyticParticleSystem::Clear()
+        {
+            m_spawns.clear();
+            m_head = 0;
+        }
+
+    } // namespace Effects
+} // namespace NeonVector
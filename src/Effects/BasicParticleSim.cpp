@@ -0,0 +1,185 @@
+#include <NeonVector/Effects/BasicParticleSim.h>
+#include <NeonVector/Effects/ColliderSweep.h>
+#include <NeonVector/Effects/ParticleStep.h>
+#include <NeonVector/Graphics/LineBatcher.h>
+#include <algorithm>
+#include <cstring>
+
+namespace NeonVector {
+    namespace Effects {
+
+        namespace {
+            template<class T>
+            void hashScalar(uint64_t& h, T v)
+            {
+                uint32_t bits;
+                static_assert(sizeof(T) == sizeof(bits), "スカラーは 32bit");
+                std::memcpy(&bits, &v, sizeof(bits));
+                for (int i = 0; i < 4; ++i) {
+                    h ^= (bits >> (i * 8)) & 0xFF;
+                    h *= 1099511628211ull;   // FNV-1a
+                }
+            }
+        }
+
+        template<class T>
+        void BasicParticleSim<T>::Emit(const Vec& pos, int count, T minSpeed, T maxSpeed,
+            ColorRGBA8 color, T life, float size)
+        {
+            if (count <= 0) return;
+
+            // 乱数は 32bit 整数のまま T に直す（float を経由しないので固定小数点でも決定的）
+            const EmitSampler<T> sample(minSpeed, maxSpeed, life);
+            m_particles.reserve(m_particles.size() + static_cast<size_t>(count));
+            for (int i = 0; i < count; ++i) {
+                const T angle = EmitSampler<T>::Angle(Traits::FromUnitBits(m_rng.NextU32()));
+                const T speed = sample.Speed(Traits::FromUnitBits(m_rng.NextU32()));
+                const T lf = sample.Life(Traits::FromUnitBits(m_rng.NextU32()));
+                T s, c;
+                Traits::SinCos(angle, s, c);
+                Particle p;
+                p.pos = pos;
+                p.vel = EmitSampler<T>::template Velocity<Vec>(s, c, speed);
+                p.life = lf;
+                p.maxLife = lf;
+                p.color = color;
+                p.size = size;
+                m_particles.push_back(p);
+            }
+        }
+
+        template<class T>
+        void BasicParticleSim<T>::AddSegment(const Vec& a, const Vec& b,
+            CollisionResponse response, T restitution, T friction)
+        {
+            Collider c;
+            c.shape = Collider::Shape::Segment;
+            c.response = response;
+            c.a = a;
+            c.b = b;
+            c.restitution = restitution;
+            c.friction = friction;
+            m_colliders.push_back(c);
+        }
+
+        template<class T>
+        void BasicParticleSim<T>::AddCircle(const Vec& center, T radius,
+            CollisionResponse response, T restitution, T friction)
+        {
+            Collider c;
+            c.shape = Collider::Shape::Circle;
+            c.response = response;
+            c.a = center;
+            c.radius = radius;
+            c.restitution = restitution;
+            c.friction = friction;
+            m_colliders.push_back(c);
+        }
+
+        template<class T>
+        void BasicParticleSim<T>::Update(T dt)
+        {
+            const T zero = Traits::Zero();
+            const T keep = DragScale(m_drag, dt);
+
+            // 総当たりで最初に当たる形状を探す（ParticleColliders::Sweep と同じ規則）
+            auto collide = [&](const Vec& from, const Vec& next, ParticleContact<Vec>& contact) {
+                const Vec d = next - from;
+                T hitT = Traits::One();
+                Vec hitN;
+                const Collider* hitC = nullptr;
+                for (const Collider& c : m_colliders) {
+                    T t;
+                    Vec n;
+                    bool inside = false;
+                    if (c.shape == Collider::Shape::Segment) {
+                        if (!SweepSegment(from, d, c.a, c.b, hitT, t, n)) continue;
+                    } else {
+                        const SweepContact sc = SweepCircle(from, d, c.a, c.radius, hitT, t, n);
+                        if (sc == SweepContact::None) continue;
+                        inside = (sc == SweepContact::Inside);
+                    }
+                    hitT = t;
+                    hitN = n;
+                    hitC = &c;
+                    if (inside) break;
+                }
+                if (!hitC) return false;
+                contact.normal = hitN;
+                contact.t = hitT;
+                contact.response = hitC->response;
+                contact.restitution = hitC->restitution;
+                contact.friction = hitC->friction;
+                return true;
+            };
+
+            // 動く 3 項目はローカルで回し、生きていれば詰めた先へ書き戻す（ParticleSystem と同じ形）
+            size_t w = 0;
+            for (size_t i = 0; i < m_particles.size(); ++i) {
+                const Particle& p = m_particles[i];
+                Vec pos = p.pos, vel = p.vel;
+                T life = p.life;
+                StepParticle(pos, vel, life, dt, keep, m_gravity, collide);
+                if (life > zero) {
+                    if (w != i)
+                        m_particles[w] = p;
+                    Particle& out = m_particles[w++];
+                    out.pos = pos;
+                    out.vel = vel;
+                    out.life = life;
+                }
+            }
+            m_particles.resize(w);
+        }
+
+        template<class T>
+        void BasicParticleSim<T>::Draw(Graphics::LineBatcher* batcher, float glow, float worldScale) const
+        {
+            if (!batcher) return;
+
+            const size_t n = m_particles.size();
+            size_t done = 0;
+            while (done < n) {
+                if (batcher->GetFreeLineCount() == 0) {
+                    batcher->Flush();
+                    if (batcher->GetFreeLineCount() == 0)
+                        return;
+                }
+                const size_t k0 = std::min(n - done, batcher->GetFreeLineCount());
+                Graphics::LineVertex* out = batcher->AllocateLines(k0);
+                for (size_t i = 0; i < k0; ++i) {
+                    const Particle& s = m_particles[done + i];
+                    const Vector2 p = s.pos.ToVector2() * worldScale;
+                    const Vector2 v = s.vel.ToVector2();
+                    const float t = Traits::ToFloat(s.life) / Traits::ToFloat(s.maxLife);   // 1→0 で消える
+                    const ColorRGBA8 c = s.color.WithAlphaScaled(t);
+
+                    const float speed = v.Length();
+                    const Vector2 half = (speed > 1e-6f) ? v * (s.size * 0.5f / speed)
+                                                         : Vector2{ s.size * 0.5f, 0.0f };
+                    out[i * 2] = Graphics::LineVertex(p - half, c, s.size * 0.6f, glow);
+                    out[i * 2 + 1] = Graphics::LineVertex(p + half, c, s.size * 0.6f, glow);
+                }
+                done += k0;
+            }
+        }
+
+        template<class T>
+        uint64_t BasicParticleSim<T>::Checksum() const
+        {
+            uint64_t h = 1469598103934665603ull;
+            for (const Particle& p : m_particles) {
+                hashScalar(h, p.pos.x);
+                hashScalar(h, p.pos.y);
+                hashScalar(h, p.vel.x);
+                hashScalar(h, p.vel.y);
+                hashScalar(h, p.life);
+            }
+            return h;
+        }
+
+        template class BasicParticleSim<float>;
+        template class BasicParticleSim<Fixed>;
+
+    } // namespace Effects
+} // namespace NeonVector
@@ -0,0 +1,69 @@
+#include <NeonVector/Effects/OverLife.h>
+#include <algorithm>
+
+namespace NeonVector {
+    namespace Effects {
+
+        Curve& Curve::AddKey(float t, float value)
+        {
+            auto it = std::upper_bound(m_keys.begin(), m_keys.end(), t,
+                [](float v, const Key& k) { return v < k.t; });
+            m_keys.insert(it, Key{ t, value });
+            return *this;
+        }
+
+        float Curve::Evaluate(float t) const
+        {
+            if (m_keys.empty()) return m_default;
+            if (t <= m_keys.front().t) return m_keys.front().value;
+            if (t >= m_keys.back().t) return m_keys.back().value;
+            auto hi = std::upper_bound(m_keys.begin(), m_keys.end(), t,
+                [](float v, const Key& k) { return v < k.t; });
+            auto lo = hi - 1;
+            const float span = hi->t - lo->t;
+            const float u = (span > 0.0f) ? (t - lo->t) / span : 1.0f;
+            return lo->value + (hi->value - lo->value) * u;
+        }
+
+        Gradient& Gradient::AddKey(float t, const Color& color)
+        {
+            auto it = std::upper_bound(m_keys.begin(), m_keys.end(), t,
+                [](float v, const Key& k) { return v < k.t; });
+            m_keys.insert(it, Key{ t, color });
+            return *this;
+        }
+
+        Color Gradient::Evaluate(float t) const
+        {
+            if (m_keys.empty()) return m_default;
+            if (t <= m_keys.front().t) return m_keys.front().color;
+            if (t >= m_keys.back().t) return m_keys.back().color;
+            auto hi = std::upper_bound(m_keys.begin(), m_keys.end(), t,
+                [](float v, const Key& k) { return v < k.t; });
+            auto lo = hi - 1;
+            const float span = hi->t - lo->t;
+            const float u = (span > 0.0f) ? (t - lo->t) / span : 1.0f;
+            const Color& a = lo->color;
+            const Color& b = hi->color;
+            return { a.r + (b.r - a.r) * u, a.g + (b.g - a.g) * u,
+                     a.b + (b.b - a.b) * u, a.a + (b.a - a.a) * u };
+        }
+
+        OverLifeTable::OverLifeTable()
+        {
+            Bake(Gradient{}, Curve::Linear(1.0f, 0.0f), Curve{ 1.0f });
+        }
+
+        void OverLifeTable::Bake(const Gradient& color, const Curve& alpha, const Curve& size)
+        {
+            for (size_t i = 0; i < kSize; ++i) {
+                const float t = static_cast<float>(i) / static_cast<float>(kSize - 1);
+                const Color c = color.Evaluate(t);
+                const float a = c.a * alpha.Evaluate(t);
+                m_color[i] = ColorRGBA8::FromFloats(c.r, c.g, c.b, a);
+                m_size[i] = std::max(size.Evaluate(t), 0.0f);
+            }
+        }
+
+    } // namespace Effects
+} // namespace NeonVector
@@ -0,0 +1,224 @@
+#include <NeonVector/Effects/ParticleColliders.h>
+#include <NeonVector/Effects/ColliderSweep.h>
+#include <algorithm>
+#include <cmath>
+
+namespace NeonVector {
+    namespace Effects {
+
+        ParticleColliders::ParticleColliders(float cellSize, size_t bucketCount)
+            : m_cellSize(cellSize > 1.0f ? cellSize : 1.0f)
+        {
+            m_invCellSize = 1.0f / m_cellSize;
+            size_t n = 1;
+            while (n < bucketCount) n <<= 1;   // ハッシュをマスクで取るので 2 の冪
+            m_buckets.resize(n);
+        }
+
+        ColliderId ParticleColliders::AddSegment(const Vector2& a, const Vector2& b,
+            CollisionResponse response, float restitution, float friction)
+        {
+            Collider c;
+            c.shape = Collider::Shape::Segment;
+            c.response = response;
+            c.a = a;
+            c.b = b;
+            c.restitution = restitution;
+            c.friction = friction;
+            return add(c);
+        }
+
+        ColliderId ParticleColliders::AddCircle(const Vector2& center, float radius,
+            CollisionResponse response, float restitution, float friction)
+        {
+            Collider c;
+            c.shape = Collider::Shape::Circle;
+            c.response = response;
+            c.a = center;
+            c.radius = radius;
+            c.restitution = restitution;
+            c.friction = friction;
+            return add(c);
+        }
+
+        void ParticleColliders::MoveSegment(ColliderId id, const Vector2& a, const Vector2& b)
+        {
+            Slot* s = find(id);
+            if (!s) return;
+            removeCells(id.index);
+            s->collider.a = a;
+            s->collider.b = b;
+            insertCells(id.index);
+        }
+
+        void ParticleColliders::MoveCircle(ColliderId id, const Vector2& center, float radius)
+        {
+            Slot* s = find(id);
+            if (!s) return;
+            removeCells(id.index);
+            s->collider.a = center;
+            s->collider.radius = radius;
+            insertCells(id.index);
+        }
+
+        void ParticleColliders::Remove(ColliderId id)
+        {
+            Slot* s = find(id);
+            if (!s) return;
+            removeCells(id.index);
+            s->alive = false;
+            ++s->generation;
+            m_free.push_back(id.index);
+        }
+
+        void ParticleColliders::Clear()
+        {
+            for (auto& b : m_buckets) b.clear();
+            m_colliders.clear();
+            m_free.clear();
+        }
+
+        void ParticleColliders::Query(const Vector2& lo, const Vector2& hi,
+            std::vector<uint32_t>& out) const
+        {
+            out.clear();
+            const int x0 = static_cast<int>(std::floor(lo.x * m_invCellSize));
+            const int y0 = static_cast<int>(std::floor(lo.y * m_invCellSize));
+            const int x1 = static_cast<int>(std::floor(hi.x * m_invCellSize));
+            const int y1 = static_cast<int>(std::floor(hi.y * m_invCellSize));
+
+            const size_t cells = static_cast<size_t>(x1 - x0 + 1) * static_cast<size_t>(y1 - y0 + 1);
+            if (cells >= m_buckets.size()) {
+                // 範囲がハッシュ表より広い: 全部を候補にする方が速い
+                for (uint32_t i = 0; i < m_colliders.size(); ++i)
+                    if (m_colliders[i].alive) out.push_back(i);
+                return;
+            }
+
+            for (int y = y0; y <= y1; ++y)
+                for (int x = x0; x <= x1; ++x) {
+                    const auto& bucket = m_buckets[bucketOf(x, y)];
+                    out.insert(out.end(), bucket.begin(), bucket.end());
+                }
+            std::sort(out.begin(), out.end());
+            out.erase(std::unique(out.begin(), out.end()), out.end());
+        }
+
+        size_t ParticleColliders::CellSpan(const Vector2& lo, const Vector2& hi) const
+        {
+            const float w = std::floor(hi.x * m_invCellSize) - std::floor(lo.x * m_invCellSize) + 1.0f;
+            const float h = std::floor(hi.y * m_invCellSize) - std::floor(lo.y * m_invCellSize) + 1.0f;
+            const float cells = w * h;
+            return (cells < 1e9f) ? static_cast<size_t>(cells) : static_cast<size_t>(1e9f);
+        }
+
+        const std::vector<uint32_t>& ParticleColliders::CellAt(const Vector2& p) const
+        {
+            return m_buckets[bucketOf(static_cast<int>(std::floor(p.x * m_invCellSize)),
+                static_cast<int>(std::floor(p.y * m_invCellSize)))];
+        }
+
+        bool ParticleColliders::Sweep(const uint32_t* candidates, size_t count,
+            const Vector2& from, const Vector2& to, ColliderHit& hit) const
+        {
+            const Vector2 d = to - from;
+            bool found = false;
+            hit.t = 1.0f;
+
+            for (size_t k = 0; k < count; ++k) {
+                const Collider& c = m_colliders[candidates[k]].collider;
+                float t;
+                Vector2 n;
+                bool inside = false;
+
+                if (c.shape == Collider::Shape::Segment) {
+                    if (!SweepSegment(from, d, c.a, c.b, hit.t, t, n)) continue;
+                } else {
+                    const SweepContact contact = SweepCircle(from, d, c.a, c.radius, hit.t, t, n);
+                    if (contact == SweepContact::None) continue;
+                    inside = (contact == SweepContact::Inside);
+                }
+                hit.t = t;
+                hit.normal = n;
+                hit.collider = candidates[k];
+                found = true;
+                if (inside) break;   // 押し出しを最優先（残りは見ない）
+            }
+            return found;
+        }
+
+        ColliderId ParticleColliders::add(const Collider& c)
+        {
+            uint32_t index;
+            if (!m_free.empty()) {
+                index = m_free.back();
+                m_free.pop_back();
+            } else {
+                index = static_cast<uint32_t>(m_colliders.size());
+                m_colliders.emplace_back();
+            }
+            Slot& s = m_colliders[index];
+            s.collider = c;
+            s.alive = true;
+            insertCells(index);
+            return { index, s.generation };
+        }
+
+        ParticleColliders::Slot* ParticleColliders::find(ColliderId id)
+        {
+            if (id.index >= m_colliders.size()) return nullptr;
+            Slot& s = m_colliders[id.index];
+            return (s.alive && s.generation == id.generation) ? &s : nullptr;
+        }
+
+        void ParticleColliders::cellRange(const Collider& c, int& x0, int& y0, int& x1, int& y1) const
+        {
+            Vector2 lo, hi;
+            if (c.shape == Collider::Shape::Segment) {
+                lo = { std::min(c.a.x, c.b.x), std::min(c.a.y, c.b.y) };
+                hi = { std::max(c.a.x, c.b.x), std::max(c.a.y, c.b.y) };
+            } else {
+                lo = { c.a.x - c.radius, c.a.y - c.radius };
+                hi = { c.a.x + c.radius, c.a.y + c.radius };
+            }
+            x0 = static_cast<int>(std::floor(lo.x * m_invCellSize));
+            y0 = static_cast<int>(std::floor(lo.y * m_invCellSize));
+            x1 = static_cast<int>(std::floor(hi.x * m_invCellSize));
+            y1 = static_cast<int>(std::floor(hi.y * m_invCellSize));
+        }
+
+        void ParticleColliders::insertCells(uint32_t index)
+        {
+            Slot& s = m_colliders[index];
+            cellRange(s.collider, s.x0, s.y0, s.x1, s.y1);
+            for (int y = s.y0; y <= s.y1; ++y)
+                for (int x = s.x0; x <= s.x1; ++x) {
+                    auto& bucket = m_buckets[bucketOf(x, y)];
+                    // ハッシュ衝突で同じバケットに複数回入らないようにする
+                    if (std::find(bucket.begin(), bucket.end(), index) == bucket.end())
+                        bucket.push_back(index);
+                }
+        }
+
+        void ParticleColliders::removeCells(uint32_t index)
+        {
+            const Slot& s = m_colliders[index];
+            for (int y = s.y0; y <= s.y1; ++y)
+                for (int x = s.x0; x <= s.x1; ++x) {
+                    auto& bucket = m_buckets[bucketOf(x, y)];
+                    auto it = std::find(bucket.begin(), bucket.end(), index);
+                    if (it != bucket.end()) {
+                        *it = bucket.back();
+                        bucket.pop_back();
+                    }
+                }
+        }
+
+        size_t ParticleColliders::bucketOf(int cx, int cy) const
+        {
+            const uint32_t h = static_cast<uint32_t>(cx) * 73856093u ^ static_cast<uint32_t>(cy) * 19349663u;
+            return h & (m_buckets.size() - 1);
+        }
+
+    } // namespace Effects
+} // namespace NeonVector
@@ -1,14 +1,78 @@
 #include <NeonVector/Effects/ParticleSystem.h>
 #include <NeonVector/Graphics/LineBatcher.h>
+#include <NeonVector/Core/JobSystem.h>
+#include <NeonVector/Math/FastMath.h>
+#include <NeonVector/Math/Simd.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <numeric>
+#include <random>
 
 namespace NeonVector {
     namespace Effects {
 
-        namespace { constexpr float kTwoPi = 6.28318530718f; }
+        namespace {
+            constexpr float kTwoPi = 6.28318530718f;
+            constexpr size_t kChunkSize = 4096;       // 並列 Update の固定チャンク（決定論モード）
+            constexpr size_t kDrawGrain = 2048;       // 並列 Draw の 1 タスクあたり本数
+            constexpr size_t kAffectorBlock = 256;    // 力場・衝突の範囲判定をまとめる粒子数
+            constexpr size_t kMaxBatchedCells = 16;   // これより広いブロックは粒子毎に衝突候補を引く
+
+            // 1 粒子 = 速度方向のストリーク 1 本（頂点 2 個）を out に詰めて書き、書いた本数を返す。
+            // 完全に消えた粒子・サイズ 0 の粒子は分岐せずに飛ばす（書いてから書き込み位置を進めない）。
+            // UseTable: 色・α・サイズを OverLifeTable から引く（false = α の線形フェードのみ）。
+            template<bool UseTable>
+            size_t writeLines(const Particle* src, size_t count,
+                Graphics::LineVertex* out, float glow, const OverLifeTable* table)
+            {
+                constexpr float k255 = 1.0f / 255.0f;
+                size_t w = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    const Particle& p = src[i];
+                    const float t = (p.maxLife > 0.0f) ? (p.life / p.maxLife) : 0.0f;  // 1→0 で消える
+                    float r = p.color.r * k255, g = p.color.g * k255, b = p.color.b * k255;
+                    float alpha = p.color.a * k255, size = p.size;
+                    if constexpr (UseTable) {
+                        const size_t k = OverLifeTable::Index(1.0f - t);
+                        const ColorRGBA8 c = table->ColorAt(k);
+                        r *= static_cast<float>(c.r) * k255;
+                        g *= static_cast<float>(c.g) * k255;
+                        b *= static_cast<float>(c.b) * k255;
+                        alpha *= static_cast<float>(c.a) * k255;
+                        size *= table->SizeAt(k);
+                    } else {
+                        alpha *= t;
+                    }
+                    const float hs = size * 0.5f;
+
+                    // 速度方向に長さ size（停止中は横向き）。sqrt + 除算の代わりに rsqrt 近似
+                    const float s2 = p.vel.x * p.vel.x + p.vel.y * p.vel.y;
+                    const bool moving = s2 > 1e-6f;
+                    const float inv = FastMath::Rsqrt(moving ? s2 : 1.0f) * hs;
+                    const float hx = moving ? p.vel.x * inv : hs;
+                    const float hy = moving ? p.vel.y * inv : 0.0f;
+
+                    const ColorRGBA8 color = ColorRGBA8::FromFloats(r, g, b, alpha);
+                    const float thickness = size * 0.6f;
+                    Graphics::LineVertex* v = out + w * 2;
+                    v[0].position = DirectX::XMFLOAT2(p.pos.x - hx, p.pos.y - hy);
+                    v[0].color = color;
+                    v[0].thickness = thickness;
+                    v[0].glow = glow;
+                    v[1].position = DirectX::XMFLOAT2(p.pos.x + hx, p.pos.y + hy);
+                    v[1].color = color;
+                    v[1].thickness = thickness;
+                    v[1].glow = glow;
+
+                    w += static_cast<size_t>((alpha > 1.0f / 512.0f) & (size > 0.0f));
+                }
+                return w;
+            }
+        }
 
         ParticleSystem::ParticleSystem()
-            : m_rng(std::random_device{}())
+            : m_rng((static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}())
         {
         }
 
@@ -16,58 +80,350 @@ namespace NeonVector {
             float minSpeed, float maxSpeed,
             const Color& color, float life, float size)
         {
-            std::uniform_real_distribution<float> angleDist(0.0f, kTwoPi);
-            std::uniform_real_distribution<float> speedDist(minSpeed, maxSpeed);
-            std::uniform_real_distribution<float> lifeDist(0.7f, 1.0f);
+            if (count <= 0) return;
+
+            const size_t n = makeRoom(static_cast<size_t>(count));
+            if (n == 0) return;
 
-            m_particles.reserve(m_particles.size() + count);
-            for (int i = 0; i < count; ++i) {
-                float a = angleDist(m_rng);
-                float s = speedDist(m_rng);
-                float lf = life * lifeDist(m_rng);
+            // 単位乱数と sin/cos を列ごとにまとめて生成し、EmitSampler で速さ・寿命に直す
+            m_emitScratch.resize(n * 5);
+            float* angle = m_emitScratch.data();
+            float* speedU = angle + n;
+            float* lifeU = speedU + n;
+            float* sn = lifeU + n;
+            float* cs = sn + n;
+            m_rng.FillUniform(angle, n, 0.0f, 1.0f);
+            m_rng.FillUniform(speedU, n, 0.0f, 1.0f);
+            m_rng.FillUniform(lifeU, n, 0.0f, 1.0f);
+            for (size_t i = 0; i < n; ++i)
+                angle[i] = EmitSampler<float>::Angle(angle[i]);
+            FastMath::SinCos(angle, sn, cs, n);
+
+            const EmitSampler<float> sample(minSpeed, maxSpeed, life);
+            const ColorRGBA8 packed = ColorRGBA8::FromColor(color);
+            for (size_t i = 0; i < n; ++i) {
+                const float lf = sample.Life(lifeU[i]);
                 Particle p;
                 p.pos = pos;
-                p.vel = { std::cos(a) * s, std::sin(a) * s };
+                p.vel = EmitSampler<float>::Velocity<Vector2>(sn[i], cs[i], sample.Speed(speedU[i]));
                 p.life = lf;
                 p.maxLife = lf;
                 p.size = size;
-                p.color = color;
+                p.color = packed;
+                p.depth = 0;
                 m_particles.push_back(p);
             }
         }
 
         void ParticleSystem::Update(float dt)
         {
-            const float velScale = std::pow(m_drag, dt);
-            for (auto& p : m_particles) {
-                p.pos = p.pos + p.vel * dt;
-                p.vel = p.vel * velScale;
-                p.vel.y += m_gravity * dt;
-                p.life -= dt;
+            m_time += dt;
+            integrate(dt);
+            runSubEmitters();
+            runEmitters(dt);
+        }
+
+        void ParticleSystem::integrate(float dt)
+        {
+            const float velScale = DragScale(m_drag, dt);
+            const size_t n = m_particles.size();
+            const size_t chunk = chunkSize(n);
+            const size_t chunks = (n + chunk - 1) / chunk;
+
+            // イベントバッファはチャンク数ぶん保持して使い回す（中身だけ毎フレーム捨てる）
+            if (m_chunkEvents.size() < std::max<size_t>(chunks, 1))
+                m_chunkEvents.resize(std::max<size_t>(chunks, 1));
+            for (std::vector<ParticleEvent>& events : m_chunkEvents)
+                events.clear();
+
+            if (!m_jobs || chunks <= 1) {
+                m_particles.resize(updateRange(0, n, dt, velScale, m_chunkEvents[0]));
+                return;
+            }
+
+            // 各チャンクが自分の範囲内で移動＋詰めを行い、生存数だけ返す
+            m_chunkAlive.resize(chunks);
+            m_jobs->ParallelFor(chunks, 1, [&](size_t c, size_t) {
+                const size_t begin = c * chunk;
+                m_chunkAlive[c] = updateRange(begin, std::min(n, begin + chunk), dt, velScale,
+                    m_chunkEvents[c]) - begin;
+            });
+
+            // チャンク順に前へ寄せる（放出順を保つのでスレッド数に依らず同じ並びになる）
+            size_t w = m_chunkAlive[0];
+            for (size_t c = 1; c < chunks; ++c) {
+                const size_t src = c * chunk;
+                const size_t alive = m_chunkAlive[c];
+                if (w != src)
+                    std::move(m_particles.begin() + src, m_particles.begin() + src + alive,
+                        m_particles.begin() + w);
+                w += alive;
             }
-            // 寿命切れを除去
-            size_t w = 0;
-            for (size_t r = 0; r < m_particles.size(); ++r)
-                if (m_particles[r].life > 0.0f)
-                    m_particles[w++] = m_particles[r];
             m_particles.resize(w);
         }
 
+        // [begin, end) を dt 進め、寿命切れを範囲内で詰める。詰めた後の終端を返す。
+        // サブエミッタの発火元になる死亡・衝突は events に追記する。
+        size_t ParticleSystem::updateRange(size_t begin, size_t end, float dt, float velScale,
+            std::vector<ParticleEvent>& events)
+        {
+            const bool affect = AffectorCount() > 0;
+            const bool onDeath = (m_eventMask & (1u << static_cast<int>(SubEmitterTrigger::Death))) != 0;
+            const bool onCollision = (m_eventMask & (1u << static_cast<int>(SubEmitterTrigger::Collision))) != 0;
+            const bool collide = m_colliders && m_colliders->Count() > 0;
+            const Vector2 gravity{ 0.0f, m_gravity };
+            // 衝突候補はブロック毎に集め直す（スレッド毎に使い回して確保を避ける）
+            static thread_local std::vector<uint32_t> candidates;
+
+            size_t w = begin;
+            for (size_t b = begin; b < end; b += kAffectorBlock) {
+                const size_t be = std::min(end, b + kAffectorBlock);
+                if (affect)
+                    applyAffectors(b, be, dt);
+
+                // 衝突候補: ブロックの移動範囲が狭ければ 1 回の Query で全粒子分を引く。
+                // 放射状に広がったバースト等で範囲が広いときは粒子毎に自分のセルだけを見る。
+                bool batched = false;
+                if (collide) {
+                    Vector2 lo = m_particles[b].pos, hi = lo;
+                    for (size_t i = b; i < be; ++i) {
+                        const Vector2& p = m_particles[i].pos;
+                        const Vector2 q = p + m_particles[i].vel * dt;
+                        lo.x = std::min(lo.x, std::min(p.x, q.x)); lo.y = std::min(lo.y, std::min(p.y, q.y));
+                        hi.x = std::max(hi.x, std::max(p.x, q.x)); hi.y = std::max(hi.y, std::max(p.y, q.y));
+                    }
+                    if (m_colliders->CellSpan(lo, hi) <= kMaxBatchedCells) {
+                        m_colliders->Query(lo, hi, candidates);
+                        batched = true;
+                    }
+                }
+
+                auto collideOne = [&](const Vector2& from, const Vector2& next, ParticleContact<Vector2>& contact) {
+                    if (batched)
+                        return !candidates.empty() &&
+                            collide1(from, next, candidates.data(), candidates.size(), contact);
+                    if (!collide)
+                        return false;
+                    const Vector2 lo{ std::min(from.x, next.x), std::min(from.y, next.y) };
+                    const Vector2 hi{ std::max(from.x, next.x), std::max(from.y, next.y) };
+                    if (m_colliders->CellSpan(lo, hi) == 1) {
+                        const std::vector<uint32_t>& cell = m_colliders->CellAt(from);
+                        return !cell.empty() && collide1(from, next, cell.data(), cell.size(), contact);
+                    }
+                    m_colliders->Query(lo, hi, candidates);
+                    return !candidates.empty() &&
+                        collide1(from, next, candidates.data(), candidates.size(), contact);
+                };
+
+                // 動く 3 項目はローカルで回し、生きていれば詰めた先へ書き戻す
+                for (size_t r = b; r < be; ++r) {
+                    const Particle& p = m_particles[r];
+                    Vector2 pos = p.pos, vel = p.vel;
+                    float life = p.life;
+                    const bool hit = StepParticle(pos, vel, life, dt, velScale, gravity, collideOne);
+                    if (p.depth < m_eventDepth) {
+                        if (hit && onCollision)
+                            events.push_back({ pos, vel, p.color, p.depth, SubEmitterTrigger::Collision });
+                        if (life <= 0.0f && onDeath)
+                            events.push_back({ pos, vel, p.color, p.depth, SubEmitterTrigger::Death });
+                    }
+                    if (life > 0.0f) {
+                        if (w != r)
+                            m_particles[w] = p;
+                        Particle& out = m_particles[w++];
+                        out.pos = pos;
+                        out.vel = vel;
+                        out.life = life;
+                    }
+                }
+            }
+            return w;
+        }
+
+        // from → next の移動を候補と掃引判定し、当たった面と形状の応答を contact に書く。
+        // 位置は値で受ける（呼び出し側の粒子をメモリに追い出さない）
+        bool ParticleSystem::collide1(Vector2 from, Vector2 next,
+            const uint32_t* candidates, size_t count, ParticleContact<Vector2>& contact) const
+        {
+            ColliderHit hit;
+            if (!m_colliders->Sweep(candidates, count, from, next, hit))
+                return false;
+
+            const ParticleColliders::Collider& c = m_colliders->Get(hit.collider);
+            contact.normal = hit.normal;
+            contact.t = hit.t;
+            contact.response = c.response;
+            contact.restitution = c.restitution;
+            contact.friction = c.friction;
+            return true;
+        }
+
+        // 1 ブロック分の粒子速度に力場を加える。位置・速度を列（SoA）に取り出し、
+        // 力場ごとにブロック全体を Float8 で回してから速度だけ書き戻す。
+        // 演算の順序はスカラーで 1 粒子ずつ足す場合と同じなので結果も一致する。
+        void ParticleSystem::applyAffectors(size_t begin, size_t end, float dt)
+        {
+            using F = Simd::Float8;
+            constexpr size_t W = F::kWidth;
+            static_assert(kAffectorBlock % W == 0, "ブロックはレーン数の倍数");
+
+            Particle* ps = m_particles.data();
+            const size_t n = end - begin;
+            const size_t padded = (n + W - 1) / W * W;
+
+            // 列へ取り出しつつ外接矩形を求める。端数レーンは先頭の粒子で埋める（書き戻さない）
+            alignas(32) float px[kAffectorBlock], py[kAffectorBlock];
+            alignas(32) float vx[kAffectorBlock], vy[kAffectorBlock];
+            Vector2 lo = ps[begin].pos, hi = ps[begin].pos;
+            for (size_t i = 0; i < padded; ++i) {
+                const Particle& p = ps[begin + (i < n ? i : 0)];
+                px[i] = p.pos.x; py[i] = p.pos.y;
+                vx[i] = p.vel.x; vy[i] = p.vel.y;
+                lo.x = std::min(lo.x, p.pos.x); lo.y = std::min(lo.y, p.pos.y);
+                hi.x = std::max(hi.x, p.pos.x); hi.y = std::max(hi.y, p.pos.y);
+            }
+
+            const F zero = F::Set1(0.0f), one = F::Set1(1.0f);
+            auto falloff = [&](AffectorFalloff f, F dist, F invRadius) {
+                const F t = Simd::Max(zero, one - dist * invRadius);   // 円外は 0
+                switch (f) {
+                case AffectorFalloff::Linear: return t;
+                case AffectorFalloff::Smooth: return t * t;
+                default:                      return Simd::Select(Simd::Greater(t, zero), one, zero);
+                }
+            };
+
+            bool touched = false;
+            alignas(32) float argA[kAffectorBlock], argB[kAffectorBlock];
+            alignas(32) float sinA[kAffectorBlock], cosA[kAffectorBlock];
+            alignas(32) float sinB[kAffectorBlock], cosB[kAffectorBlock];
+            for (const AffectorSlot& slot : m_affectors) {
+                if (!slot.alive || !slot.affector.enabled) continue;
+                const Affector& a = slot.affector;
+
+                const bool bounded = a.radius > 0.0f;
+                if (bounded) {
+                    const float cx = std::min(std::max(a.position.x, lo.x), hi.x);
+                    const float cy = std::min(std::max(a.position.y, lo.y), hi.y);
+                    const float dx = a.position.x - cx, dy = a.position.y - cy;
+                    if (dx * dx + dy * dy > a.radius * a.radius) continue;   // ブロックと重ならない
+                }
+                touched = true;
+                const F invRadius = F::Set1(bounded ? 1.0f / a.radius : 0.0f);
+                const F k = F::Set1(a.strength * dt);
+                const F ax = F::Set1(a.position.x), ay = F::Set1(a.position.y);
+
+                switch (a.type) {
+                case AffectorType::Attractor:
+                case AffectorType::Vortex: {
+                    const bool vortex = a.type == AffectorType::Vortex;
+                    for (size_t i = 0; i < padded; i += W) {
+                        const F dx = ax - F::Load(px + i);
+                        const F dy = ay - F::Load(py + i);
+                        const F d = Simd::Sqrt(dx * dx + dy * dy + one);   // +1: 中心での発散を抑える
+                        const F w = k * falloff(a.falloff, d, invRadius) / d;
+                        (F::Load(vx + i) + (vortex ? zero - dy * w : dx * w)).Store(vx + i);
+                        (F::Load(vy + i) + (vortex ? dx * w : dy * w)).Store(vy + i);
+                    }
+                    break;
+                }
+                case AffectorType::Wind: {
+                    const F dirX = F::Set1(a.direction.x), dirY = F::Set1(a.direction.y);
+                    for (size_t i = 0; i < padded; i += W) {
+                        F w = k;
+                        if (bounded) {
+                            const F dx = F::Load(px + i) - ax;
+                            const F dy = F::Load(py + i) - ay;
+                            w = w * falloff(a.falloff, Simd::Sqrt(dx * dx + dy * dy), invRadius);
+                        }
+                        (F::Load(vx + i) + dirX * w).Store(vx + i);
+                        (F::Load(vy + i) + dirY * w).Store(vy + i);
+                    }
+                    break;
+                }
+                case AffectorType::Turbulence: {
+                    // (sin(f*y + φ), cos(f*x + ψ)) は発散ゼロなので渦を巻くように乱れる
+                    const float phaseY = m_time * 1.3f, phaseX = m_time * 1.7f;
+                    for (size_t i = 0; i < padded; ++i) {
+                        argA[i] = py[i] * a.frequency + phaseY;
+                        argB[i] = px[i] * a.frequency - phaseX;
+                    }
+                    FastMath::SinCos(argA, sinA, cosA, padded);
+                    FastMath::SinCos(argB, sinB, cosB, padded);
+                    for (size_t i = 0; i < padded; i += W) {
+                        F w = k;
+                        if (bounded) {
+                            const F dx = F::Load(px + i) - ax;
+                            const F dy = F::Load(py + i) - ay;
+                            w = w * falloff(a.falloff, Simd::Sqrt(dx * dx + dy * dy), invRadius);
+                        }
+                        (F::Load(vx + i) + F::Load(sinA + i) * w).Store(vx + i);
+                        (F::Load(vy + i) + F::Load(cosB + i) * w).Store(vy + i);
+                    }
+                    break;
+                }
+                }
+            }
+
+            if (!touched) return;
+            for (size_t i = 0; i < n; ++i) {
+                ps[begin + i].vel.x = vx[i];
+                ps[begin + i].vel.y = vy[i];
+            }
+        }
+
+        size_t ParticleSystem::chunkSize(size_t count) const
+        {
+            if (m_deterministic || !m_jobs)
+                return kChunkSize;
+            // スレッドあたり数チャンクになる程度まで大きくする（結果の並びは同じだが分割は可変）
+            const size_t perThread = count / (static_cast<size_t>(m_jobs->GetThreadCount()) * 4);
+            return std::max(kChunkSize, perThread);
+        }
+
         void ParticleSystem::Draw(Graphics::LineBatcher* batcher, float glow) const
         {
             if (!batcher) return;
-            for (const auto& p : m_particles) {
-                float t = (p.maxLife > 0.0f) ? (p.life / p.maxLife) : 0.0f;  // 1→0 で消える
-                Color c = p.color;
-                c.a = p.color.a * t;
 
-                float speed = p.vel.Length();
-                Vector2 half;
-                if (speed > 1e-3f)
-                    half = p.vel * (p.size * 0.5f / speed);   // 速度方向に長さ size
-                else
-                    half = { p.size * 0.5f, 0.0f };
-                batcher->AddLine(p.pos - half, p.pos + half, c, p.size * 0.6f, glow);
+            // 曲線の有無は粒子ループの外で 1 回だけ分ける
+            const OverLifeTable* table = m_overLife;
+            auto write = [table, glow](const Particle* src, size_t count, Graphics::LineVertex* out) {
+                return table ? writeLines<true>(src, count, out, glow, table)
+                             : writeLines<false>(src, count, out, glow, nullptr);
+            };
+
+            // バッチャの空きに収まる分ずつ確保して直接書き込む（満杯なら Flush して続行）
+            const size_t n = m_particles.size();
+            size_t done = 0;
+            while (done < n) {
+                if (batcher->GetFreeLineCount() == 0) {
+                    batcher->Flush();
+                    if (batcher->GetFreeLineCount() == 0)
+                        return;   // Flush できない（未初期化）
+                }
+                const size_t k = std::min(n - done, batcher->GetFreeLineCount());
+                Graphics::LineVertex* out = batcher->AllocateLines(k);
+                const Particle* src = m_particles.data() + done;
+
+                size_t written;
+                if (m_jobs && k > kDrawGrain) {
+                    // タスク毎の区間に書き、飛ばした分の隙間を後から詰める
+                    size_t counts[Graphics::LineBatcher::GetMaxLineCount() / kDrawGrain + 1];
+                    m_jobs->ParallelFor(k, kDrawGrain, [&](size_t b, size_t e) {
+                        counts[b / kDrawGrain] = write(src + b, e - b, out + b * 2);
+                    });
+                    written = counts[0];
+                    for (size_t t = 1; t * kDrawGrain < k; ++t) {
+                        Graphics::LineVertex* from = out + t * kDrawGrain * 2;
+                        if (from != out + written * 2)
+                            std::memmove(out + written * 2, from, counts[t] * 2 * sizeof(Graphics::LineVertex));
+                        written += counts[t];
+                    }
+                } else {
+                    written = write(src, k, out);
+                }
+                batcher->ReleaseLines(k - written);
+                done += k;
             }
         }
 
@@ -76,5 +432,350 @@ namespace NeonVector {
             m_particles.clear();
         }
 
+        EmitterId ParticleSystem::AddEmitter(const EmitterDesc& desc, const Vector2& position)
+        {
+            uint32_t index;
+            if (!m_freeEmitters.empty()) {
+                index = m_freeEmitters.back();
+                m_freeEmitters.pop_back();
+            } else {
+                index = static_cast<uint32_t>(m_emitters.size());
+                m_emitters.emplace_back();
+            }
+            Emitter& e = m_emitters[index];
+            const uint32_t generation = e.m_generation;
+            e = Emitter{};
+            e.desc = desc;
+            e.m_generation = generation;
+            e.m_alive = true;
+            e.m_burstFired.assign(desc.bursts.size(), 0);
+            e.Teleport(position);
+            return { index, generation };
+        }
+
+        Emitter* ParticleSystem::GetEmitter(EmitterId id)
+        {
+            if (id.index >= m_emitters.size()) return nullptr;
+            Emitter& e = m_emitters[id.index];
+            return (e.m_alive && e.m_generation == id.generation) ? &e : nullptr;
+        }
+
+        void ParticleSystem::RemoveEmitter(EmitterId id)
+        {
+            Emitter* e = GetEmitter(id);
+            if (!e) return;
+            e->m_alive = false;
+            ++e->m_generation;   // 古い id を無効化
+            m_freeEmitters.push_back(id.index);
+        }
+
+        AffectorId ParticleSystem::AddAffector(const Affector& affector)
+        {
+            uint32_t index;
+            if (!m_freeAffectors.empty()) {
+                index = m_freeAffectors.back();
+                m_freeAffectors.pop_back();
+            } else {
+                index = static_cast<uint32_t>(m_affectors.size());
+                m_affectors.emplace_back();
+            }
+            AffectorSlot& slot = m_affectors[index];
+            slot.affector = affector;
+            slot.alive = true;
+            return { index, slot.generation };
+        }
+
+        Affector* ParticleSystem::GetAffector(AffectorId id)
+        {
+            if (id.index >= m_affectors.size()) return nullptr;
+            AffectorSlot& slot = m_affectors[id.index];
+            return (slot.alive && slot.generation == id.generation) ? &slot.affector : nullptr;
+        }
+
+        void ParticleSystem::RemoveAffector(AffectorId id)
+        {
+            if (!GetAffector(id)) return;
+            AffectorSlot& slot = m_affectors[id.index];
+            slot.alive = false;
+            ++slot.generation;
+            m_freeAffectors.push_back(id.index);
+        }
+
+        void ParticleSystem::AddSubEmitter(const SubEmitterDesc& desc)
+        {
+            m_subEmitters.push_back(desc);
+            const int depth = std::min(std::max(desc.maxDepth, 0), 255);
+            m_eventMask |= static_cast<uint8_t>(1u << static_cast<int>(desc.trigger));
+            m_eventDepth = std::max(m_eventDepth, static_cast<uint8_t>(depth));
+        }
+
+        void ParticleSystem::ClearSubEmitters()
+        {
+            m_subEmitters.clear();
+            m_eventMask = 0;
+            m_eventDepth = 0;
+        }
+
+        // integrate が集めたイベントをサブエミッタごとに 1 回の一括放出へまとめる。
+        // 予算を超えた分は捨てる（チャンク順 = 放出順に先着なので決定論的）。
+        void ParticleSystem::runSubEmitters()
+        {
+            if (m_subEmitters.empty())
+                return;
+
+            size_t budget = (m_subBudget == 0) ? ~size_t(0) : m_subBudget;
+            for (const SubEmitterDesc& d : m_subEmitters) {
+                if (budget == 0)
+                    break;
+                if (d.count <= 0)
+                    continue;   // 何も出さない定義は飛ばす（後ろの定義は評価する）
+                const size_t perEvent = static_cast<size_t>(d.count);
+
+                // 発火するイベントを選ぶ（予算に達したらそれ以降は見ない）
+                m_subFired.clear();
+                const size_t maxEvents = budget / perEvent + (budget % perEvent != 0);
+                for (const std::vector<ParticleEvent>& events : m_chunkEvents) {
+                    for (const ParticleEvent& ev : events) {
+                        if (m_subFired.size() >= maxEvents) break;
+                        if (ev.trigger != d.trigger || ev.depth >= d.maxDepth) continue;
+                        if (d.probability < 1.0f && m_rng.NextFloat() >= d.probability) continue;
+                        m_subFired.push_back(&ev);
+                    }
+                }
+                if (m_subFired.empty())
+                    continue;
+
+                const size_t wanted = std::min(m_subFired.size() * perEvent, budget);
+                budget -= wanted;
+                const size_t n = makeRoom(wanted);
+                if (n == 0)
+                    continue;
+
+                m_emitScratch.resize(n * 5);
+                float* angle = m_emitScratch.data();
+                float* speedU = angle + n;
+                float* lifeU = speedU + n;
+                float* sn = lifeU + n;
+                float* cs = sn + n;
+                m_rng.FillUniform(angle, n, -0.5f * d.spread, 0.5f * d.spread);
+                m_rng.FillUniform(speedU, n, 0.0f, 1.0f);
+                m_rng.FillUniform(lifeU, n, 0.0f, 1.0f);
+                if (d.spread < kTwoPi) {
+                    // 親の進行方向を基準にする（全方向なら回す必要がない）
+                    for (size_t i = 0; i < n; i += perEvent) {
+                        const ParticleEvent& ev = *m_subFired[i / perEvent];
+                        const float heading = FastMath::Atan2<FastMath::Precision::Fast>(ev.vel.y, ev.vel.x);
+                        for (size_t k = i; k < std::min(n, i + perEvent); ++k)
+                            angle[k] += heading;
+                    }
+                }
+                FastMath::SinCos(angle, sn, cs, n);
+
+                const EmitSampler<float> sample(d.minSpeed, d.maxSpeed, d.life);
+                const ColorRGBA8 ownColor = ColorRGBA8::FromColor(d.color);
+                for (size_t i = 0; i < n; ++i) {
+                    const ParticleEvent& ev = *m_subFired[i / perEvent];
+                    const float lf = sample.Life(lifeU[i]);
+                    Particle p;
+                    p.pos = ev.pos;
+                    p.vel = EmitSampler<float>::Velocity<Vector2>(sn[i], cs[i], sample.Speed(speedU[i]))
+                        + ev.vel * d.inheritVelocity;
+                    p.life = lf;
+                    p.maxLife = lf;
+                    p.size = d.size;
+                    p.color = d.inheritColor ? ev.color : ownColor;
+                    p.depth = static_cast<uint8_t>(ev.depth + 1);
+                    m_particles.push_back(p);
+                }
+            }
+        }
+
+        // 全エミッタを 1 パスで評価する。粒子は放出時刻どおりに補間位置へ置き、
+        // フレーム末までの経過分（age）だけ積分（抵抗・重力込み）して寿命も減らしておく。
+        void ParticleSystem::runEmitters(float dt)
+        {
+            for (Emitter& e : m_emitters) {
+                if (!e.m_alive) continue;
+                if (!e.m_active || dt <= 0.0f) {
+                    e.m_prevPos = e.m_pos;
+                    continue;
+                }
+                const EmitterDesc& d = e.desc;
+                const float t0 = e.m_time;
+                const float t1 = t0 + dt;
+
+                // 連続放出: 端数 accum から数えて k 個目は (k - accum) / rate 秒後に出る
+                if (d.rate > 0.0f) {
+                    const float acc = e.m_accum + d.rate * dt;
+                    const size_t n = static_cast<size_t>(acc);
+                    if (n > 0) {
+                        const float firstAge = dt - (1.0f - e.m_accum) / d.rate;
+                        spawnFromEmitter(e, n, dt, firstAge, -1.0f / d.rate);
+                    }
+                    e.m_accum = acc - static_cast<float>(n);
+                }
+
+                // バースト: [t0, t1) に入った発火時刻ぶん
+                e.m_burstFired.resize(d.bursts.size(), 0);
+                for (size_t b = 0; b < d.bursts.size(); ++b) {
+                    const EmitterBurst& burst = d.bursts[b];
+                    int& fired = e.m_burstFired[b];
+                    while (burst.cycles == 0 || fired < burst.cycles) {
+                        if (fired > 0 && burst.interval <= 0.0f) break;
+                        const float at = burst.time + burst.interval * static_cast<float>(fired);
+                        if (at >= t1) break;
+                        if (burst.count > 0)
+                            spawnFromEmitter(e, static_cast<size_t>(burst.count), dt, t1 - at, 0.0f);
+                        ++fired;
+                    }
+                }
+
+                e.m_time = t1;
+                e.m_prevPos = e.m_pos;
+            }
+        }
+
+        void ParticleSystem::spawnFromEmitter(const Emitter& e, size_t count, float dt,
+            float firstAge, float ageStep)
+        {
+            const size_t n = makeRoom(count);
+            if (n == 0) return;
+            const EmitterDesc& d = e.desc;
+
+            // 形状ごとの角度範囲（Point は全周）
+            float angleLo = 0.0f, angleHi = kTwoPi;
+            if (d.shape != EmitterShape::Point) {
+                angleLo = d.direction - d.spread * 0.5f;
+                angleHi = d.direction + d.spread * 0.5f;
+            }
+
+            m_emitScratch.resize(n * 6);
+            float* angle = m_emitScratch.data();
+            float* speedU = angle + n;
+            float* lifeU = speedU + n;
+            float* along = lifeU + n;
+            float* sn = along + n;
+            float* cs = sn + n;
+            m_rng.FillUniform(angle, n, angleLo, angleHi);
+            m_rng.FillUniform(speedU, n, 0.0f, 1.0f);
+            m_rng.FillUniform(lifeU, n, 0.0f, 1.0f);
+            if (d.shape == EmitterShape::Line)
+                m_rng.FillUniform(along, n, -0.5f * d.length, 0.5f * d.length);
+            FastMath::SinCos(angle, sn, cs, n);
+
+            const float invDt = 1.0f / dt;
+            const Vector2 moved = e.m_pos - e.m_prevPos;
+            const Vector2 inherited = moved * (invDt * d.inheritVelocity);
+            float perpS, perpC;
+            FastMath::SinCos(d.direction, perpS, perpC);
+            const Vector2 perp{ -perpS, perpC };
+
+            const EmitSampler<float> sample(d.minSpeed, d.maxSpeed, d.life);
+            const Vector2 gravity{ 0.0f, m_gravity };
+            const ColorRGBA8 color = ColorRGBA8::FromColor(d.color);
+            for (size_t i = 0; i < n; ++i) {
+                float age = firstAge + ageStep * static_cast<float>(i);
+                age = std::min(std::max(age, 0.0f), dt);
+                const float lf = sample.Life(lifeU[i]);
+                if (lf <= age) continue;
+
+                Vector2 origin = e.m_prevPos + moved * (1.0f - age * invDt);
+                if (d.shape == EmitterShape::Line)
+                    origin = origin + perp * along[i];
+                else if (d.shape == EmitterShape::Arc)
+                    origin = origin + Vector2{ cs[i], sn[i] } * d.radius;
+
+                // 放出からフレーム末までの age 秒を、updateRange と同じ 1 ステップで進める（衝突は見ない）
+                Particle p;
+                p.pos = origin;
+                p.vel = EmitSampler<float>::Velocity<Vector2>(sn[i], cs[i], sample.Speed(speedU[i])) + inherited;
+                p.life = lf;
+                StepParticle(p.pos, p.vel, p.life, age, DragScale(m_drag, age), gravity,
+                    [](const Vector2&, const Vector2&, ParticleContact<Vector2>&) { return false; });
+                p.maxLife = lf;
+                p.size = d.size;
+                p.color = color;
+                p.depth = 0;
+                m_particles.push_back(p);
+            }
+        }
+
+        void ParticleSystem::SetCapacity(size_t capacity, OverflowPolicy policy)
+        {
+            m_capacity = capacity;
+            m_policy = policy;
+            if (m_capacity == 0)
+                return;
+            if (m_particles.size() > m_capacity)
+                m_particles.erase(m_particles.begin(),
+                    m_particles.begin() + (m_particles.size() - m_capacity));
+            m_particles.reserve(m_capacity);
+            m_emitScratch.reserve(m_capacity * 6);
+            if (m_policy == OverflowPolicy::ReplaceDimmest)
+                m_scratch.reserve(m_capacity);
+        }
+
+        void ParticleSystem::ShrinkToFit()
+        {
+            m_particles.shrink_to_fit();
+            m_scratch.clear();
+            m_scratch.shrink_to_fit();
+            m_emitScratch.clear();
+            m_emitScratch.shrink_to_fit();
+        }
+
+        // count 個ぶんの空きを作り、実際に放出してよい個数を返す。
+        // プールモードではここ以外で確保しない（初回とShrinkToFit 後のみ reserve）。
+        size_t ParticleSystem::makeRoom(size_t count)
+        {
+            if (m_capacity == 0)
+                return count;   // 上限なし: vector の倍々伸長に任せる（毎回 reserve すると再確保が連発する）
+
+            if (m_particles.capacity() < m_capacity)
+                m_particles.reserve(m_capacity);
+
+            const size_t free = m_capacity - m_particles.size();
+            if (count <= free)
+                return count;
+            if (m_policy == OverflowPolicy::DropNew)
+                return free;
+
+            count = std::min(count, m_capacity);
+            const size_t victims = count - free;   // <= m_particles.size()
+
+            if (m_policy == OverflowPolicy::ReplaceOldest) {
+                // 放出順に並んでいるので先頭 victims 個が最古。放出順を保つ（Update / Draw / 次の
+                // ReplaceOldest が頼る）ため、その場で上書きせず詰める: O(容量) の移動が放出 1 回につき 1 回
+                m_particles.erase(m_particles.begin(), m_particles.begin() + victims);
+                return count;
+            }
+
+            // ReplaceDimmest: 明るさ下位 victims 個を寿命切れにして詰める（順序は保たれる）
+            if (m_scratch.capacity() < m_capacity)
+                m_scratch.reserve(m_capacity);
+            m_scratch.resize(m_particles.size());
+            std::iota(m_scratch.begin(), m_scratch.end(), 0u);
+            auto brightness = [this](uint32_t i) {
+                const Particle& p = m_particles[i];
+                return (p.maxLife > 0.0f) ? static_cast<float>(p.color.a) * (p.life / p.maxLife) : 0.0f;
+            };
+            std::nth_element(m_scratch.begin(), m_scratch.begin() + victims, m_scratch.end(),
+                [&](uint32_t a, uint32_t b) { return brightness(a) < brightness(b); });
+            for (size_t i = 0; i < victims; ++i)
+                m_particles[m_scratch[i]].life = 0.0f;
+            compact();
+            return count;
+        }
+
+        // 寿命切れを除去（安定: 放出順を崩さない）
+        void ParticleSystem::compact()
+        {
+            size_t w = 0;
+            for (size_t r = 0; r < m_particles.size(); ++r)
+                if (m_particles[r].life > 0.0f)
+                    m_particles[w++] = m_particles[r];
+            m_particles.resize(w);
+        }
+
     } // namespace Effects
 } // namespace NeonVector
@@ -1,9 +1,48 @@
 #include <NeonVector/Effects/Trail.h>
+#include <NeonVector/Effects/OverLife.h>
 #include <NeonVector/Graphics/LineBatcher.h>
+#include <NeonVector/Math/FastMath.h>
+#include <NeonVector/Math/Polyline.h>
+#include <algorithm>
+#include <cmath>
 
 namespace NeonVector {
     namespace Effects {
 
+        namespace {
+            constexpr int kMaxSubdivisions = 16;
+
+            // centripetal Catmull-Rom（α = 0.5）の p1 → p2 区間を Hermite 形式に直す。
+            // 節点間隔 |Δp|^0.5 を使うので、点の間隔が不揃いでもループや尖りが出にくい。
+            struct HermiteSegment {
+                Vector2 p1, p2, m1, m2;
+
+                Vector2 At(float u) const
+                {
+                    const float u2 = u * u, u3 = u2 * u;
+                    return p1 * (2.0f * u3 - 3.0f * u2 + 1.0f) + m1 * (u3 - 2.0f * u2 + u)
+                         + p2 * (-2.0f * u3 + 3.0f * u2) + m2 * (u3 - u2);
+                }
+            };
+
+            HermiteSegment centripetal(const Vector2& p0, const Vector2& p1,
+                const Vector2& p2, const Vector2& p3)
+            {
+                // |Δp|^0.5 = (|Δp|^2)^0.25 を rsqrt 2 回で（節点間隔は曲線の形にしか効かないので Fast で足りる）
+                auto knot = [](const Vector2& a, const Vector2& b) {
+                    using FastMath::Precision;
+                    const float len2 = (b - a).LengthSquared();
+                    return std::max(FastMath::Rsqrt<Precision::Fast>(FastMath::Rsqrt<Precision::Fast>(len2)), 1e-4f);
+                };
+                const float d01 = knot(p0, p1), d12 = knot(p1, p2), d23 = knot(p2, p3);
+                const Vector2 m1 = ((p1 - p0) * (1.0f / d01) - (p2 - p0) * (1.0f / (d01 + d12))
+                                  + (p2 - p1) * (1.0f / d12)) * d12;
+                const Vector2 m2 = ((p2 - p1) * (1.0f / d12) - (p3 - p1) * (1.0f / (d12 + d23))
+                                  + (p3 - p2) * (1.0f / d23)) * d12;
+                return { p1, p2, m1, m2 };
+            }
+        }
+
         Trail::Trail(int maxPoints)
             : m_max(maxPoints < 2 ? 2 : maxPoints)
         {
@@ -11,37 +50,179 @@ namespace NeonVector {
 
         void Trail::Push(const Vector2& p)
         {
-            m_points.push_back(p);
-            while (static_cast<int>(m_points.size()) > m_max)
+            m_hasHead = false;
+            m_last = p;
+            m_travel = 0.0f;
+            pushPoint(p);
+        }
+
+        void Trail::Push(const Vector2& p, float dt)
+        {
+            if (m_minSpacing <= 0.0f || m_points.empty()) {
+                Push(p);
+                return;
+            }
+
+            // 前回位置 → p の移動を道のりで測り、minSpacing ごとの位置に点を置く
+            // （1 フレームの移動量に関係なく同じ間隔になる。瞬間移動でも最大 m_max 個まで）
+            m_elapsed += dt;
+            Vector2 from = m_last;
+            Vector2 delta = p - from;
+            float remaining = delta.Length();
+            const Vector2 dir = (remaining > 0.0f) ? delta * (1.0f / remaining) : Vector2{};
+            for (int placed = 0; m_travel + remaining >= m_minSpacing && placed < m_max; ++placed) {
+                const float step = m_minSpacing - m_travel;
+                from = from + dir * step;
+                remaining -= step;
+                m_travel = 0.0f;
+                pushPoint(from);
+            }
+            m_travel = std::min(m_travel + remaining, m_minSpacing);
+            m_last = p;
+
+            // ほぼ止まっていても maxInterval ごとに現在位置を残す
+            if (m_maxInterval > 0.0f && m_elapsed >= m_maxInterval && m_travel > 0.0f) {
+                pushPoint(p);
+                m_travel = 0.0f;
+            }
+            m_head = p;
+            m_hasHead = true;
+        }
+
+        void Trail::pushPoint(const Vector2& p)
+        {
+            const Sample s{ p.x, p.y, m_seq++ };
+            m_elapsed = 0.0f;
+            if (m_simplify <= 0.0f || m_points.empty()) {
+                m_points.push_back(s);
+                if (m_simplify > 0.0f) {
+                    m_tail.assign(1, s);
+                    m_tailStored = 0;
+                }
+                trim();
+                return;
+            }
+
+            // 未確定区間（固定端 + 元の点）だけを簡略化し直し、m_points の末尾を差し替える
+            if (m_tail.empty())
+                m_tail.push_back(m_points.back());
+            m_tail.push_back(s);
+            m_points.erase(m_points.end() - static_cast<std::ptrdiff_t>(std::min(m_tailStored, m_points.size())),
+                m_points.end());
+            m_tailWork.assign(m_tail.begin(), m_tail.end());
+            const auto kept = Polyline::SimplifyRDP(m_tailWork.begin(), m_tailWork.end(), m_simplify);
+            m_points.insert(m_points.end(), m_tailWork.begin() + 1, kept);
+            m_tailStored = static_cast<size_t>(kept - m_tailWork.begin()) - 1;
+
+            // 区間が長くなったら確定させる（以後は最後に残った点を固定端にして続ける）
+            if (m_tail.size() >= kSimplifyWindow) {
+                m_tail.assign(1, *(kept - 1));
+                m_tailStored = 0;
+            }
+            trim();
+        }
+
+        // 間引く前の点数で m_max を超えた分を古い方から捨てる
+        void Trail::trim()
+        {
+            const uint32_t limit = static_cast<uint32_t>(m_max);
+            while (m_points.size() > 1 && m_points.back().seq - m_points.front().seq >= limit)
                 m_points.pop_front();
+            m_tailStored = std::min(m_tailStored, m_points.size());
+        }
+
+        void Trail::SetSimplify(float tolerance)
+        {
+            m_simplify = std::max(tolerance, 0.0f);
+            m_tail.clear();
+            m_tailStored = 0;
         }
 
         void Trail::Clear()
         {
             m_points.clear();
+            m_tail.clear();
+            m_tailStored = 0;
+            m_hasHead = false;
+            m_elapsed = 0.0f;
+            m_travel = 0.0f;
+        }
+
+        void Trail::SetSampling(float minSpacing, float maxInterval)
+        {
+            m_minSpacing = std::max(minSpacing, 0.0f);
+            m_maxInterval = std::max(maxInterval, 0.0f);
         }
 
         void Trail::SetMaxPoints(int n)
         {
             m_max = (n < 2) ? 2 : n;
-            while (static_cast<int>(m_points.size()) > m_max)
-                m_points.pop_front();
+            trim();
         }
 
         void Trail::Draw(Graphics::LineBatcher* batcher, const Color& color,
             float thickness, float glow) const
         {
-            if (!batcher || m_points.size() < 2)
+            // 描く点列 = 残した点 + まだ残していない先端
+            const size_t stored = m_points.size();
+            const bool head = m_hasHead && stored > 0 && (m_head - m_points.back().Pos()).LengthSquared() > 0.0f;
+            const size_t n = stored + (head ? 1 : 0);
+            if (!batcher || n < 2)
                 return;
+            auto point = [&](size_t i) -> Vector2 { return (i < stored) ? m_points[i].Pos() : m_head; };
+            // 濃淡は間引く前の通し番号で測る（間引いていなければ添字と同じ）
+            const uint32_t seq0 = m_points.front().seq;
+            auto order = [&](size_t i) -> float {
+                return static_cast<float>(((i < stored) ? m_points[i].seq : m_seq) - seq0);
+            };
 
-            const size_t n = m_points.size();
+            // t: 0 = 最も古い端, 1 = 最新端。新しいほど濃く太く（テーブルがあれば先端 = 0 として引く）
+            constexpr float k255 = 1.0f / 255.0f;
+            auto line = [&](const Vector2& a, const Vector2& b, float t) {
+                if (m_overLife) {
+                    const size_t k = OverLifeTable::Index(1.0f - t);
+                    const ColorRGBA8 packed = m_overLife->ColorAt(k);
+                    const float alpha = static_cast<float>(packed.a) * k255;
+                    const Color c(color.r * static_cast<float>(packed.r) * k255,
+                        color.g * static_cast<float>(packed.g) * k255,
+                        color.b * static_cast<float>(packed.b) * k255,
+                        color.a * alpha);
+                    batcher->AddLine(a, b, c, thickness * m_overLife->SizeAt(k), glow * alpha);
+                } else {
+                    Color c = color;
+                    c.a = color.a * t;
+                    batcher->AddLine(a, b, c, thickness * (0.25f + 0.75f * t), glow * t);
+                }
+            };
+
+            const float span = order(n - 1);
+            if (m_tolerance <= 0.0f || n < 3) {
+                for (size_t i = 0; i + 1 < n; ++i)
+                    line(point(i), point(i + 1), order(i + 1) / span);
+                return;
+            }
+
+            // 区間ごとに曲線の中点と弦の中点のずれ d を見て分割数を決める
+            // （3 次曲線を k 本の折れ線にしたときの誤差は約 d / k^2）
             for (size_t i = 0; i + 1 < n; ++i) {
-                // t: 0 = 最も古い端, 1 = 最新端。新しいほど濃く太く。
-                float t = static_cast<float>(i + 1) / static_cast<float>(n - 1);
-                Color c = color;
-                c.a = color.a * t;
-                float th = thickness * (0.25f + 0.75f * t);
-                batcher->AddLine(m_points[i], m_points[i + 1], c, th, glow * t);
+                const Vector2 p1 = point(i), p2 = point(i + 1);
+                const Vector2 p0 = (i > 0) ? point(i - 1) : p1 * 2.0f - p2;       // 端は鏡映で延長
+                const Vector2 p3 = (i + 2 < n) ? point(i + 2) : p2 * 2.0f - p1;
+                const HermiteSegment seg = centripetal(p0, p1, p2, p3);
+
+                const float dev = (seg.At(0.5f) - (p1 + p2) * 0.5f).Length();
+                const int k = std::clamp(static_cast<int>(std::ceil(std::sqrt(dev / m_tolerance))),
+                    1, kMaxSubdivisions);
+                const float invK = 1.0f / static_cast<float>(k);
+                const float o1 = order(i), o2 = order(i + 1);
+
+                Vector2 a = p1;
+                for (int j = 1; j <= k; ++j) {
+                    const float u = static_cast<float>(j) * invK;
+                    const Vector2 b = (j == k) ? p2 : seg.At(u);
+                    line(a, b, (j == k) ? o2 / span : (o1 + (o2 - o1) * u) / span);
+                    a = b;
+                }
             }
         }
 
@@ -0,0 +1,198 @@
+#include <NeonVector/Effects/TrailPool.h>
+#include <NeonVector/Effects/OverLife.h>
+#include <NeonVector/Graphics/LineBatcher.h>
+#include <algorithm>
+
+namespace NeonVector {
+    namespace Effects {
+
+        namespace {
+            // リング上の点 a から k 本の線分（線分 i は点 i → i+1）を out に書く。
+            // UseTable: 色・α・太さを OverLifeTable から引く（false = 既定の傾斜）。
+            // 分岐をテンプレート引数にして、点ごとのループの外で 1 回だけ選ぶ。
+            template<bool UseTable>
+            void writeSegments(const Vector2* ring, uint32_t cap, uint32_t a, uint32_t i, uint32_t k,
+                float span, const Color& color, float thickness, float glow,
+                const OverLifeTable* table, Graphics::LineVertex* out)
+            {
+                constexpr float k255 = 1.0f / 255.0f;
+                for (uint32_t j = 0; j < k; ++j, ++i) {
+                    uint32_t b = a + 1;
+                    if (b == cap) b = 0;
+
+                    // t: 0 = 最も古い端, 1 = 最新端
+                    const float t = static_cast<float>(i + 1) / span;
+                    Color c = color;
+                    float th, gl;
+                    if constexpr (UseTable) {
+                        const size_t e = OverLifeTable::Index(1.0f - t);
+                        const ColorRGBA8 packed = table->ColorAt(e);
+                        const float alpha = static_cast<float>(packed.a) * k255;
+                        c.r *= static_cast<float>(packed.r) * k255;
+                        c.g *= static_cast<float>(packed.g) * k255;
+                        c.b *= static_cast<float>(packed.b) * k255;
+                        c.a *= alpha;
+                        th = thickness * table->SizeAt(e);
+                        gl = glow * alpha;
+                    } else {
+                        (void)table;
+                        c.a *= t;
+                        th = thickness * (0.25f + 0.75f * t);
+                        gl = glow * t;
+                    }
+                    out[j * 2] = Graphics::LineVertex(ring[a], c, th, gl);
+                    out[j * 2 + 1] = Graphics::LineVertex(ring[b], c, th, gl);
+                    a = b;
+                }
+            }
+        }
+
+        TrailPool::TrailPool(size_t maxTrails, size_t pointsPerTrail)
+            : m_stride(std::max<size_t>(pointsPerTrail, 2))
+            , m_points(maxTrails * m_stride)
+            , m_head(maxTrails, 0)
+            , m_count(maxTrails, 0)
+            , m_generation(maxTrails, 0)
+            , m_alive(maxTrails, 0)
+            , m_color(maxTrails)
+            , m_thickness(maxTrails, 0.0f)
+            , m_glow(maxTrails, 0.0f)
+        {
+            Clear();
+        }
+
+        TrailHandle TrailPool::Create(const Color& color, float thickness, float glow)
+        {
+            if (m_free.empty())
+                return {};
+            const uint32_t s = m_free.back();
+            m_free.pop_back();
+            m_alive[s] = 1;
+            m_head[s] = 0;
+            m_count[s] = 0;
+            m_color[s] = ColorRGBA8::FromColor(color);
+            m_thickness[s] = thickness;
+            m_glow[s] = glow;
+            return { s, m_generation[s] };
+        }
+
+        void TrailPool::Destroy(TrailHandle h)
+        {
+            if (!valid(h)) return;
+            m_alive[h.index] = 0;
+            ++m_generation[h.index];   // 古い handle を無効化
+            m_free.push_back(h.index);
+        }
+
+        bool TrailPool::IsAlive(TrailHandle h) const
+        {
+            return valid(h);
+        }
+
+        void TrailPool::Push(TrailHandle h, const Vector2& p)
+        {
+            if (valid(h))
+                push(h.index, p);
+        }
+
+        void TrailPool::Reset(TrailHandle h)
+        {
+            if (!valid(h)) return;
+            m_head[h.index] = 0;
+            m_count[h.index] = 0;
+        }
+
+        void TrailPool::SetColor(TrailHandle h, const Color& color)
+        {
+            if (valid(h))
+                m_color[h.index] = ColorRGBA8::FromColor(color);
+        }
+
+        void TrailPool::PushAll(std::span<const TrailHandle> handles, std::span<const Vector2> positions)
+        {
+            const size_t n = std::min(handles.size(), positions.size());
+            for (size_t i = 0; i < n; ++i)
+                if (valid(handles[i]))
+                    push(handles[i].index, positions[i]);
+        }
+
+        void TrailPool::PushAll(std::span<const Vector2> positions)
+        {
+            const size_t n = std::min(positions.size(), m_alive.size());
+            for (size_t s = 0; s < n; ++s)
+                if (m_alive[s])
+                    push(static_cast<uint32_t>(s), positions[s]);
+        }
+
+        void TrailPool::Clear()
+        {
+            const size_t slots = m_alive.size();
+            m_free.clear();
+            m_free.reserve(slots);
+            for (size_t s = 0; s < slots; ++s) {
+                if (m_alive[s])
+                    ++m_generation[s];
+                m_alive[s] = 0;
+                m_free.push_back(static_cast<uint32_t>(slots - 1 - s));   // 若い番号から使う
+            }
+        }
+
+        // リングの末尾へ追加。満杯なら最古を上書きして先頭を進める（pop_front の代わり）
+        void TrailPool::push(uint32_t slot, const Vector2& p)
+        {
+            const uint32_t cap = static_cast<uint32_t>(m_stride);
+            uint32_t& head = m_head[slot];
+            uint32_t& count = m_count[slot];
+            uint32_t tail = head + count;
+            if (tail >= cap) tail -= cap;
+            m_points[slot * m_stride + tail] = p;
+            if (count < cap) {
+                ++count;
+            } else if (++head == cap) {
+                head = 0;
+            }
+        }
+
+        void TrailPool::Draw(Graphics::LineBatcher* batcher) const
+        {
+            if (!batcher) return;
+
+            const OverLifeTable* table = m_overLife;
+            const uint32_t cap = static_cast<uint32_t>(m_stride);
+            const size_t slots = m_alive.size();
+            for (size_t s = 0; s < slots; ++s) {
+                const uint32_t n = m_count[s];
+                if (!m_alive[s] || n < 2) continue;
+
+                const Vector2* ring = m_points.data() + s * m_stride;
+                const uint32_t head = m_head[s];
+                const Color color = m_color[s].ToColor();
+                const float thickness = m_thickness[s];
+                const float glow = m_glow[s];
+                const float span = static_cast<float>(n - 1);
+
+                // 線分 i は点 i → i+1。バッチャの空きに収まる分ずつ確保して直接書く
+                uint32_t i = 0;
+                while (i + 1 < n) {
+                    if (batcher->GetFreeLineCount() == 0) {
+                        batcher->Flush();
+                        if (batcher->GetFreeLineCount() == 0)
+                            return;   // Flush できない（未初期化）
+                    }
+                    const uint32_t k = static_cast<uint32_t>(
+                        std::min<size_t>(n - 1 - i, batcher->GetFreeLineCount()));
+                    Graphics::LineVertex* out = batcher->AllocateLines(k);
+
+                    uint32_t a = head + i;
+                    if (a >= cap) a -= cap;
+                    if (table)
+                        writeSegments<true>(ring, cap, a, i, k, span, color, thickness, glow, table, out);
+                    else
+                        writeSegments<false>(ring, cap, a, i, k, span, color, thickness, glow, nullptr, out);
+                    i += k;
+                }
+            }
+        }
+
+    } // namespace Effects
+} // namespace NeonVector
@@ -15,9 +15,10 @@ namespace NeonVector
 
         // コンストラクタ
         LineBatcher::LineBatcher()
-            : m_device(nullptr), m_commandList(nullptr), m_vertexCount(0), m_screenWidth(0), m_screenHeight(0), m_isInitialized(false)
+            : m_device(nullptr), m_commandList(nullptr), m_vertexCount(0), m_palette(nullptr), m_screenWidth(0), m_screenHeight(0), m_isInitialized(false)
         {
-            m_vertices.reserve(kMaxVertices);
+            // 容量分を先に確保しておき、m_vertexCount までを有効データとして扱う
+            m_vertices.resize(kMaxVertices);
         }
 
         // デストラクタ
@@ -75,7 +76,7 @@ namespace NeonVector
         // 終了処理
         void LineBatcher::Shutdown()
         {
-            m_vertices.clear();
+            m_vertexCount = 0;
             m_isInitialized = false;
         }
 
@@ -85,22 +86,63 @@ namespace NeonVector
                                   const Color &color,
                                   float thickness,
                                   float glow)
+        {
+            AddLine(start, end, ColorRGBA8::FromColor(color), thickness, glow);
+        }
+
+        void LineBatcher::AddLine(const Vector2 &start,
+                                  const Vector2 &end,
+                                  PaletteIndex color,
+                                  float thickness,
+                                  float glow)
+        {
+            AddLine(start, end, m_palette ? m_palette->Get(color) : ColorRGBA8(), thickness, glow);
+        }
+
+        void LineBatcher::AddLine(const Vector2 &start,
+                                  const Vector2 &end,
+                                  ColorRGBA8 color,
+                                  float thickness,
+                                  float glow)
         {
             if (IsFull())
             {
                 OutputDebugStringA("LineBatcher: Buffer full, flushing...\n");
                 Flush();
+                if (IsFull())
+                {
+                    return;   // 未初期化で Flush できない（固定長バッファなので捨てる）
+                }
             }
 
-            m_vertices.emplace_back(start, color, thickness, glow);
-            m_vertices.emplace_back(end, color, thickness, glow);
-            m_vertexCount += 2;
+            m_vertices[m_vertexCount++] = LineVertex(start, color, thickness, glow);
+            m_vertices[m_vertexCount++] = LineVertex(end, color, thickness, glow);
+        }
+
+        // 線をまとめて確保（呼び出し側が頂点を直接書く）
+        LineVertex* LineBatcher::AllocateLines(size_t count)
+        {
+            if (count > GetFreeLineCount())
+            {
+                OutputDebugStringA("LineBatcher: AllocateLines exceeds free space\n");
+                return nullptr;
+            }
+
+            LineVertex* out = m_vertices.data() + m_vertexCount;
+            m_vertexCount += count * 2;
+            return out;
+        }
+
+        // 直前に確保した線の末尾 count 本を返却
+        void LineBatcher::ReleaseLines(size_t count)
+        {
+            const size_t vertices = count * 2;
+            m_vertexCount = (vertices < m_vertexCount) ? m_vertexCount - vertices : 0;
         }
 
         // クリア
         void LineBatcher::Clear()
         {
-            m_vertices.clear();
             m_vertexCount = 0;
         }
 
@@ -329,7 +371,7 @@ namespace NeonVector
             D3D12_INPUT_ELEMENT_DESC inputLayout[] = {
                 {"POSITION", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 0,
                  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-                {"COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT,
+                {"COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, D3D12_APPEND_ALIGNED_ELEMENT,
                  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
                 {"THICKNESS", 0, DXGI_FORMAT_R32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT,
                  D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
@@ -374,7 +416,7 @@ namespace NeonVector
         // 頂点データアップロード
         void LineBatcher::uploadVertexData()
         {
-            if (m_vertices.empty())
+            if (m_vertexCount == 0)
             {
                 return;
             }
@@ -390,7 +432,7 @@ namespace NeonVector
                 return;
             }
 
-            memcpy(pData, m_vertices.data(), m_vertices.size() * sizeof(LineVertex));
+            memcpy(pData, m_vertices.data(), m_vertexCount * sizeof(LineVertex));
             m_vertexBufferUpload->Unmap(0, nullptr);
 
             // リソースバリア: COPY_DEST に遷移
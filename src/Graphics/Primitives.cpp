@@ -1,11 +1,23 @@
 #include <NeonVector/Graphics/Primitives.h>
 #include <NeonVector/Graphics/LineBatcher.h>
+#include <NeonVector/Math/FastMath.h>
+#include <NeonVector/Math/Polyline.h>
 #include <cmath>
 
 namespace NeonVector {
     namespace Graphics {
 
-        namespace { constexpr float kTwoPi = 6.28318530718f; }
+        namespace {
+            constexpr float kTwoPi = 6.28318530718f;
+
+            // 円周上の点（画面上の頂点なので FastMath の Fast 段で足りる。半径 1000px でも誤差 0.02px 程度）
+            Vector2 onCircle(const Vector2& center, float radius, float angle)
+            {
+                float s, c;
+                FastMath::SinCos<FastMath::Precision::Fast>(angle, s, c);
+                return { center.x + c * radius, center.y + s * radius };
+            }
+        }
 
         void DrawLine(LineBatcher* batcher,
             const Vector2& a, const Vector2& b,
@@ -23,13 +35,9 @@ namespace NeonVector {
             if (!batcher || segments < 1 || radius <= 0.0f) return;
 
             const float step = (endAngle - startAngle) / segments;
-            Vector2 prev{
-                center.x + std::cos(startAngle) * radius,
-                center.y + std::sin(startAngle) * radius };
+            Vector2 prev = onCircle(center, radius, startAngle);
             for (int i = 1; i <= segments; ++i) {
-                float a = startAngle + step * i;
-                Vector2 cur{ center.x + std::cos(a) * radius,
-                             center.y + std::sin(a) * radius };
+                Vector2 cur = onCircle(center, radius, startAngle + step * i);
                 batcher->AddLine(prev, cur, color, thickness, glow);
                 prev = cur;
             }
@@ -68,18 +76,32 @@ namespace NeonVector {
                 batcher->AddLine(points.back(), points.front(), color, thickness, glow);
         }
 
+        void DrawPolygonSimplified(LineBatcher* batcher,
+            const std::vector<Vector2>& points, float tolerance, const Color& color,
+            bool closed, float thickness, float glow)
+        {
+            if (!batcher || points.size() < 2) return;
+
+            // 閉じた形は始点を末尾にも置いて 1 本の折れ線として間引く（始点は必ず残る）
+            static thread_local std::vector<Vector2> work;
+            work.assign(points.begin(), points.end());
+            if (closed && points.size() > 2)
+                work.push_back(points.front());
+            work.erase(Polyline::SimplifyRDP(work.begin(), work.end(), tolerance), work.end());
+
+            for (size_t i = 0; i + 1 < work.size(); ++i)
+                batcher->AddLine(work[i], work[i + 1], color, thickness, glow);
+        }
+
         void DrawRegularPolygon(LineBatcher* batcher,
             const Vector2& center, float radius, int sides, const Color& color,
             float rotation, float thickness, float glow)
         {
             if (!batcher || sides < 3 || radius <= 0.0f) return;
             const float step = kTwoPi / sides;
-            Vector2 prev{ center.x + std::cos(rotation) * radius,
-                          center.y + std::sin(rotation) * radius };
+            Vector2 prev = onCircle(center, radius, rotation);
             for (int i = 1; i <= sides; ++i) {
-                float a = rotation + step * i;
-                Vector2 cur{ center.x + std::cos(a) * radius,
-                             center.y + std::sin(a) * radius };
+                Vector2 cur = onCircle(center, radius, rotation + step * i);
                 batcher->AddLine(prev, cur, color, thickness, glow);
                 prev = cur;
             }
@@ -96,8 +118,7 @@ namespace NeonVector {
             Vector2 first{}, prev{};
             for (int i = 0; i < verts; ++i) {
                 float r = (i % 2 == 0) ? outerRadius : innerRadius;
-                float a = rotation + step * i;
-                Vector2 cur{ center.x + std::cos(a) * r, center.y + std::sin(a) * r };
+                Vector2 cur = onCircle(center, r, rotation + step * i);
                 if (i == 0) first = cur;
                 else        batcher->AddLine(prev, cur, color, thickness, glow);
                 prev = cur;
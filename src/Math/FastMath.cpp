@@ -0,0 +1,214 @@
+#include <NeonVector/Math/FastMath.h>
+#include <NeonVector/Math/Simd.h>
+
+namespace NeonVector {
+    namespace FastMath {
+
+        // 一括版は Simd::Float4 で 4 要素ずつ、スカラー版と同じ式・同じ順序で計算する（端数はスカラー版）
+        namespace {
+            using Simd::Float4;
+            using Simd::Int4;
+
+            // スカラー版 RoundToInt と同じ丸め（0.5 を足して切り捨て）
+            inline Int4 roundToInt(Float4 x)
+            {
+                const Float4 h = Float4::Set1(0.5f) | (x & Float4::Set1(-0.0f));
+                return Simd::TruncateToInt(x + h);
+            }
+
+            template <Precision P>
+            inline Float4 rsqrt4(Float4 x)
+            {
+                const Float4 y = Simd::RsqrtEstimate(x);
+                if constexpr (P == Precision::Accurate) {
+                    const Float4 xyy = Float4::Set1(0.5f) * x * y * y;
+                    return y * (Float4::Set1(1.5f) - xyy);
+                } else {
+                    return y;
+                }
+            }
+
+            template <Precision P>
+            inline Float4 exp2x4(Float4 x)
+            {
+                using namespace Detail;
+                const Float4 xc = Simd::Min(Simd::Max(x, Float4::Set1(kExp2Min)), Float4::Set1(kExp2Max));
+                const Int4 j = roundToInt(xc);
+                const Float4 f = xc - Simd::ToFloat(j);
+                Float4 p;
+                if constexpr (P == Precision::Accurate) {
+                    p = Float4::Set1(kExp2_5) + f * Float4::Set1(kExp2_6);
+                    p = Float4::Set1(kExp2_4) + f * p;
+                    p = Float4::Set1(kExp2_3) + f * p;
+                    p = Float4::Set1(kExp2_2) + f * p;
+                    p = Float4::Set1(kExp2_1) + f * p;
+                } else {
+                    p = Float4::Set1(kExp2Fast2) + f * Float4::Set1(kExp2Fast3);
+                    p = Float4::Set1(kExp2Fast1) + f * p;
+                }
+                p = Float4::Set1(1.0f) + f * p;
+                return p * Simd::AsFloat(Simd::ShiftLeft<23>(j + Int4::Set1(127)));
+            }
+        }
+
+        template <Precision P>
+        void SinCos(const float* angles, float* s, float* c, size_t count)
+        {
+            using namespace Detail;
+            const Float4 twoOverPi = Float4::Set1(kTwoOverPi);
+            const Float4 half = Float4::Set1(0.5f);
+            const Float4 a = Float4::Set1(kPiOver2A);
+            const Float4 b = Float4::Set1(kPiOver2B);
+            const Float4 cc = Float4::Set1(kPiOver2C);
+            const Float4 one = Float4::Set1(1.0f);
+            const Int4 i1 = Int4::Set1(1);
+            const Int4 i2 = Int4::Set1(2);
+
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const Float4 x = Float4::Load(angles + i);
+
+                const Int4 j = roundToInt(x * twoOverPi);
+                const Float4 fj = Simd::ToFloat(j);
+
+                const Float4 r = ((x - fj * a) - fj * b) - fj * cc;
+                const Float4 r2 = r * r;
+
+                Float4 ps, pc;
+                if constexpr (P == Precision::Accurate) {
+                    ps = r + r * r2 * (Float4::Set1(kSin1) + r2 * (Float4::Set1(kSin2) + r2 * Float4::Set1(kSin3)));
+                    pc = (one - half * r2) + r2 * r2 * (Float4::Set1(kCos1) + r2 * (Float4::Set1(kCos2) + r2 * Float4::Set1(kCos3)));
+                } else {
+                    ps = r + r * r2 * (Float4::Set1(kSinFast1) + r2 * Float4::Set1(kSinFast2));
+                    pc = one + r2 * (Float4::Set1(kCosFast1) + r2 * Float4::Set1(kCosFast2));
+                }
+
+                // 奇数象限は sin/cos を入れ替え、象限に応じて符号を反転
+                const Float4 swap = Simd::AsFloat(Simd::Equal(j & i1, i1));
+                const Float4 sv = Simd::Select(swap, pc, ps);
+                const Float4 cv = Simd::Select(swap, ps, pc);
+                const Float4 sNeg = Simd::AsFloat(Simd::ShiftLeft<30>(j & i2));
+                const Float4 cNeg = Simd::AsFloat(Simd::ShiftLeft<30>((j + i1) & i2));
+
+                (sv ^ sNeg).Store(s + i);
+                (cv ^ cNeg).Store(c + i);
+            }
+
+            for (; i < count; ++i)
+                SinCos<P>(angles[i], s[i], c[i]);
+        }
+
+        template <Precision P>
+        void Atan2(const float* y, const float* x, float* out, size_t count)
+        {
+            using namespace Detail;
+            const Float4 signMask = Float4::Set1(-0.0f);
+            const Float4 zero = Float4::Set1(0.0f);
+            const Float4 one = Float4::Set1(1.0f);
+
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const Float4 vy = Float4::Load(y + i);
+                const Float4 vx = Float4::Load(x + i);
+                const Float4 ax = Simd::AndNot(signMask, vx);
+                const Float4 ay = Simd::AndNot(signMask, vy);
+                const Float4 hi = Simd::Max(ax, ay);
+                const Float4 lo = Simd::Min(ax, ay);
+                Float4 t = Simd::Greater(hi, zero) & (lo / hi);
+
+                Float4 a;
+                if constexpr (P == Precision::Accurate) {
+                    // tan(π/8) を超える分は (t - 1) / (t + 1) に移して π/4 を足す
+                    const Float4 far = Simd::Greater(t, Float4::Set1(kTanPiOver8));
+                    const Float4 base = far & Float4::Set1(kPiOver4);
+                    t = Simd::Select(far, (t - one) / (t + one), t);
+                    const Float4 z = t * t;
+                    const Float4 p = (((Float4::Set1(kAtan4) * z + Float4::Set1(kAtan3)) * z + Float4::Set1(kAtan2)) * z
+                                      + Float4::Set1(kAtan1)) * z * t + t;
+                    a = base + p;
+                } else {
+                    const Float4 z = t * t;
+                    a = t * (Float4::Set1(kAtanFast0) + z * (Float4::Set1(kAtanFast1)
+                                                             + z * (Float4::Set1(kAtanFast2) + z * Float4::Set1(kAtanFast3))));
+                }
+
+                a = Simd::Select(Simd::Greater(ay, ax), Float4::Set1(kPiOver2) - a, a);
+                const Float4 xNeg = Simd::AsFloat(Simd::ShiftRightArith<31>(Simd::AsInt(vx)));
+                a = Simd::Select(xNeg, Float4::Set1(kPi) - a, a);
+                (a | (vy & signMask)).Store(out + i);
+            }
+
+            for (; i < count; ++i)
+                out[i] = Atan2<P>(y[i], x[i]);
+        }
+
+        namespace {
+            // Exp2 と ConstPow の共通部分（scale = 1 なら Exp2 そのもの）
+            template <Precision P>
+            void exp2Scaled(const float* x, float scale, float* out, size_t count)
+            {
+                const Float4 vs = Float4::Set1(scale);
+                size_t i = 0;
+                for (; i + 4 <= count; i += 4)
+                    exp2x4<P>(Float4::Load(x + i) * vs).Store(out + i);
+                for (; i < count; ++i)
+                    out[i] = Exp2<P>(x[i] * scale);
+            }
+        }
+
+        template <Precision P>
+        void Exp2(const float* x, float* out, size_t count)
+        {
+            exp2Scaled<P>(x, 1.0f, out, count);
+        }
+
+        template <Precision P>
+        void ConstPow::Eval(const float* y, float* out, size_t count) const
+        {
+            exp2Scaled<P>(y, log2Base, out, count);
+        }
+
+        template <Precision P>
+        void Rsqrt(const float* x, float* out, size_t count)
+        {
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+                rsqrt4<P>(Float4::Load(x + i)).Store(out + i);
+            for (; i < count; ++i)
+                out[i] = Rsqrt<P>(x[i]);
+        }
+
+        template <Precision P>
+        void Normalize(const Vector2* in, Vector2* out, size_t count)
+        {
+            const Float4 minLen2 = Float4::Set1(1.17549435e-38f);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                Float4 x, y;
+                Simd::LoadInterleaved(&in[i].x, x, y);
+                const Float4 len2 = x * x + y * y;
+                const Float4 ok = Simd::GreaterEqual(len2, minLen2);
+                const Float4 inv = rsqrt4<P>(len2);
+                x = Simd::Select(ok, x * inv, x);
+                y = Simd::Select(ok, y * inv, y);
+                Simd::StoreInterleaved(&out[i].x, x, y);
+            }
+            for (; i < count; ++i)
+                out[i] = Normalize<P>(in[i]);
+        }
+
+        template void SinCos<Precision::Accurate>(const float*, float*, float*, size_t);
+        template void SinCos<Precision::Fast>(const float*, float*, float*, size_t);
+        template void Atan2<Precision::Accurate>(const float*, const float*, float*, size_t);
+        template void Atan2<Precision::Fast>(const float*, const float*, float*, size_t);
+        template void Exp2<Precision::Accurate>(const float*, float*, size_t);
+        template void Exp2<Precision::Fast>(const float*, float*, size_t);
+        template void ConstPow::Eval<Precision::Accurate>(const float*, float*, size_t) const;
+        template void ConstPow::Eval<Precision::Fast>(const float*, float*, size_t) const;
+        template void Rsqrt<Precision::Accurate>(const float*, float*, size_t);
+        template void Rsqrt<Precision::Fast>(const float*, float*, size_t);
+        template void Normalize<Precision::Accurate>(const Vector2*, Vector2*, size_t);
+        template void Normalize<Precision::Fast>(const Vector2*, Vector2*, size_t);
+
+    } // namespace FastMath
+} // namespace NeonVector
@@ -0,0 +1,256 @@
+#include <NeonVector/Math/Fixed.h>
+
+namespace NeonVector
+{
+    namespace
+    {
+        constexpr int kSinSteps = 256;     // 1/4 周の分割数
+        constexpr int kAtanSteps = 256;    // atan の [0, 1] の分割数
+        constexpr int kTableBits = 30;     // 表は Q2.30（補間の丸めを Q16.16 より細かく）
+        constexpr double kPi = 3.14159265358979323846;
+
+        // 64bit 整数の開平（切り捨て）。1 桁（2bit）ずつ決めるので処理系に依らない
+        uint64_t isqrt(uint64_t n)
+        {
+            uint64_t root = 0;
+            uint64_t bit = uint64_t(1) << 62;
+            while (bit > n)
+                bit >>= 2;
+            while (bit != 0)
+            {
+                if (n >= root + bit)
+                {
+                    n -= root + bit;
+                    root = (root >> 1) + bit;
+                }
+                else
+                {
+                    root >>= 1;
+                }
+                bit >>= 2;
+            }
+            return root;
+        }
+
+        // 表はコンパイル時に double の四則演算だけで作る（<cmath> に頼らないので処理系に依らない）
+        constexpr double sinSeries(double x)
+        {
+            double term = x, sum = x;
+            for (int k = 1; k < 14; ++k)
+            {
+                term *= -x * x / ((2 * k) * (2 * k + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr double atanSeries(double x)   // |x| <= tan(π/8)
+        {
+            double power = x, sum = x;
+            for (int k = 1; k < 30; ++k)
+            {
+                power *= -x * x;
+                sum += power / (2 * k + 1);
+            }
+            return sum;
+        }
+
+        constexpr double atanUnit(double x)   // 0 <= x <= 1
+        {
+            return (x > 0.41421356237309503) ? kPi / 4 + atanSeries((x - 1) / (x + 1)) : atanSeries(x);
+        }
+
+        constexpr int32_t toTable(double v)   // v >= 0
+        {
+            return static_cast<int32_t>(v * (1 << kTableBits) + 0.5);
+        }
+
+        template <int N, class F>
+        struct Table
+        {
+            int32_t v[N + 2];   // 末尾 1 つは補間の読み越し用
+            constexpr Table(F f) : v()
+            {
+                for (int i = 0; i <= N; ++i)
+                    v[i] = toTable(f(static_cast<double>(i) / N));
+                v[N + 1] = v[N];
+            }
+        };
+
+        constexpr auto kSinFn = [](double t) { return sinSeries(t * kPi / 2); };
+        constexpr auto kAtanFn = [](double t) { return atanUnit(t); };
+        constexpr Table<kSinSteps, decltype(kSinFn)> kSinTable(kSinFn);
+        constexpr Table<kAtanSteps, decltype(kAtanFn)> kAtanTable(kAtanFn);
+
+        constexpr int64_t kPiTable = 3373259426;   // π × 2^30
+
+        // 表の値（Q2.30）→ Q16.16（最近接丸め）
+        int32_t fromTable(int64_t v)
+        {
+            return static_cast<int32_t>((v + (int64_t(1) << (kTableBits - 17))) >> (kTableBits - 16));
+        }
+
+        // 1/4 周内の位置（30bit）での sin（Q2.30）
+        int64_t sinQuarter(uint32_t pos)
+        {
+            const uint32_t i = pos >> 22;                 // 上位 8bit = 表の段
+            const int64_t f = (pos >> 6) & 0xFFFF;        // 次の 16bit = 段内の位置
+            const int64_t a = kSinTable.v[i];
+            return a + (((kSinTable.v[i + 1] - a) * f) >> 16);
+        }
+
+        // 1 周 = 2^32 の整数角での sin（Q2.30）
+        int64_t sinTurn(uint32_t angle)
+        {
+            const uint32_t quadrant = angle >> 30;
+            const uint32_t pos = angle & 0x3FFFFFFFu;
+            const int64_t v = (quadrant & 1) ? sinQuarter(0x40000000u - pos) : sinQuarter(pos);
+            return (quadrant & 2) ? -v : v;
+        }
+
+        // ラジアン（Q16.16）→ 1 周 = 2^32 の整数角（2^32 / 2π = 683565275.58）
+        uint32_t toTurn(Fixed radians)
+        {
+            return static_cast<uint32_t>(static_cast<uint64_t>(static_cast<int64_t>(radians.Raw()) * 683565276) >> 16);
+        }
+
+        constexpr int kLogBits = 30;   // log2 / exp2 の小数部（Q.30）
+        constexpr double kLn2 = 0.69314718055994530942;
+
+        constexpr double expSeries(double x)   // 0 < x <= ln 2 / 2
+        {
+            double term = 1, sum = 1;
+            for (int k = 1; k < 20; ++k)
+            {
+                term *= x / k;
+                sum += term;
+            }
+            return sum;
+        }
+
+        // v[i] = 2^(2^-(i+1))（Q2.30）。exp2 の小数部の各ビットに掛ける
+        struct Exp2Bits
+        {
+            int64_t v[kLogBits];
+            constexpr Exp2Bits() : v()
+            {
+                double x = kLn2;
+                for (int i = 0; i < kLogBits; ++i)
+                {
+                    x /= 2;
+                    v[i] = toTable(expSeries(x));
+                }
+            }
+        };
+        constexpr Exp2Bits kExp2Bits;
+
+        // 正の生値 r の log2(r / 2^16)（Q.30）。仮数を 2 乗しては 2 以上かを見て 1 桁ずつ決める
+        int64_t log2Raw(uint32_t r)
+        {
+            int e = 0;
+            while ((r >> e) > 1)
+                ++e;
+            uint64_t m = static_cast<uint64_t>(r) << (kLogBits - e);   // 仮数 [1, 2)（Q2.30。r < 2^31 なので e <= 30）
+            int64_t result = static_cast<int64_t>(e - Fixed::kFracBits) * (int64_t(1) << kLogBits);
+            for (int bit = kLogBits - 1; bit >= 0; --bit)
+            {
+                m = (m * m) >> kLogBits;
+                if (m >= (uint64_t(2) << kLogBits))
+                {
+                    m >>= 1;
+                    result += int64_t(1) << bit;
+                }
+            }
+            return result;
+        }
+
+        // 2^(y / 2^30) → Q16.16（最近接丸め、収まらなければ最大値に飽和）
+        int32_t exp2Raw(int64_t y)
+        {
+            const int64_t k = y >> kLogBits;   // 整数部（-∞ 方向）
+            const uint64_t f = static_cast<uint64_t>(y) & ((uint64_t(1) << kLogBits) - 1);
+            uint64_t m = uint64_t(1) << kLogBits;
+            for (int i = 0; i < kLogBits; ++i)
+                if (f & (uint64_t(1) << (kLogBits - 1 - i)))
+                    m = (m * static_cast<uint64_t>(kExp2Bits.v[i]) + (uint64_t(1) << (kLogBits - 1))) >> kLogBits;
+
+            // m × 2^k（Q2.30）を Q16.16 へ: 右へ 14 - k
+            const int64_t shift = (kLogBits - Fixed::kFracBits) - k;
+            if (shift < 0)
+                return INT32_MAX;
+            if (shift >= 62)
+                return 0;
+            const uint64_t v = (shift == 0) ? m : (m + (uint64_t(1) << (shift - 1))) >> shift;
+            return v > static_cast<uint64_t>(INT32_MAX) ? INT32_MAX : static_cast<int32_t>(v);
+        }
+    }
+
+    Fixed Sqrt(Fixed v)
+    {
+        if (v.Raw() <= 0)
+            return Fixed::Zero();
+        // 生値 r の √(r / 2^16) × 2^16 = √(r × 2^16)
+        return Fixed::FromRaw(static_cast<int32_t>(isqrt(static_cast<uint64_t>(v.Raw()) << Fixed::kFracBits)));
+    }
+
+    Fixed SqrtWide(int64_t q32)
+    {
+        if (q32 <= 0)
+            return Fixed::Zero();
+        // √(q / 2^32) × 2^16 = √q
+        const uint64_t root = isqrt(static_cast<uint64_t>(q32));
+        return Fixed::FromRaw(root > static_cast<uint64_t>(INT32_MAX) ? INT32_MAX : static_cast<int32_t>(root));
+    }
+
+    void SinCos(Fixed radians, Fixed &s, Fixed &c)
+    {
+        const uint32_t angle = toTurn(radians);
+        s = Fixed::FromRaw(fromTable(sinTurn(angle)));
+        c = Fixed::FromRaw(fromTable(sinTurn(angle + 0x40000000u)));
+    }
+
+    Fixed Sin(Fixed radians)
+    {
+        return Fixed::FromRaw(fromTable(sinTurn(toTurn(radians))));
+    }
+
+    Fixed Cos(Fixed radians)
+    {
+        return Fixed::FromRaw(fromTable(sinTurn(toTurn(radians) + 0x40000000u)));
+    }
+
+    Fixed Atan2(Fixed y, Fixed x)
+    {
+        const int64_t ax = (x.Raw() < 0) ? -static_cast<int64_t>(x.Raw()) : x.Raw();
+        const int64_t ay = (y.Raw() < 0) ? -static_cast<int64_t>(y.Raw()) : y.Raw();
+        if (ax == 0 && ay == 0)
+            return Fixed::Zero();
+
+        // 0..1 の比（Q16）で atan を引き、八分円を戻す
+        const bool steep = ay > ax;
+        const int64_t ratio = steep ? (ax << 16) / ay : (ay << 16) / ax;
+        const int64_t i = ratio >> 8;
+        const int64_t f = ratio & 0xFF;
+        const int64_t lo = kAtanTable.v[i];
+        int64_t a = lo + (((kAtanTable.v[i + 1] - lo) * f) >> 8);
+        if (steep)
+            a = kPiTable / 2 - a;
+        if (x.Raw() < 0)
+            a = kPiTable - a;
+        if (y.Raw() < 0)
+            a = -a;
+        return Fixed::FromRaw(fromTable(a));
+    }
+
+    Fixed Pow(Fixed base, Fixed exponent)
+    {
+        if (base.Raw() <= 0)
+            return Fixed::Zero();
+        // log2(base) × exponent（Q.30）。64bit に収めるため log2 を上下 16bit に分けて掛ける
+        const int64_t l = log2Raw(static_cast<uint32_t>(base.Raw()));
+        const int64_t e = exponent.Raw();
+        const int64_t y = (l >> 16) * e + (((l & 0xFFFF) * e) >> 16);
+        return Fixed::FromRaw(exp2Raw(y));
+    }
+
+} // namespace NeonVector
@@ -0,0 +1,125 @@
+#include <NeonVector/Math/Vector2Pack.h>
+#include <NeonVector/Math/FastMath.h>
+#include <algorithm>
+#include <cmath>
+
+namespace NeonVector
+{
+    namespace Vector2Batch
+    {
+
+        namespace
+        {
+#if defined(NEONVECTOR_SIMD_AVX)
+            using Pack = Vector2x8;
+#else
+            using Pack = Vector2x4;
+#endif
+            using F = decltype(Pack::x);
+            constexpr size_t W = Pack::kWidth;
+            constexpr size_t kAngleBlock = 256; // 要素毎の回転で sin / cos を一括計算する単位
+        }
+
+        void Transform(const Vector2 *in, Vector2 *out, size_t count,
+                       const Vector2 &translate, float radians, float scale)
+        {
+            const float c = std::cos(radians), s = std::sin(radians);
+            const F vc = F::Set1(c), vs = F::Set1(s), vscale = F::Set1(scale);
+            const Pack t = Pack::Set1(translate);
+            size_t i = 0;
+            for (; i + W <= count; i += W)
+                (t + Pack::Load(in + i).Rotate(vc, vs) * vscale).Store(out + i);
+            for (; i < count; ++i)
+                out[i] = translate + in[i].Rotate(c, s) * scale;
+        }
+
+        void Rotate(const Vector2 *in, Vector2 *out, size_t count, float radians)
+        {
+            const float c = std::cos(radians), s = std::sin(radians);
+            const F vc = F::Set1(c), vs = F::Set1(s);
+            size_t i = 0;
+            for (; i + W <= count; i += W)
+                Pack::Load(in + i).Rotate(vc, vs).Store(out + i);
+            for (; i < count; ++i)
+                out[i] = in[i].Rotate(c, s);
+        }
+
+        void Rotate(const Vector2 *in, const float *radians, Vector2 *out, size_t count)
+        {
+            float sn[kAngleBlock], cs[kAngleBlock];
+            for (size_t b = 0; b < count; b += kAngleBlock)
+            {
+                const size_t n = std::min(kAngleBlock, count - b);
+                FastMath::SinCos(radians + b, sn, cs, n);
+                size_t i = 0;
+                for (; i + W <= n; i += W)
+                    Pack::Load(in + b + i).Rotate(F::Load(cs + i), F::Load(sn + i)).Store(out + b + i);
+                for (; i < n; ++i)
+                    out[b + i] = in[b + i].Rotate(cs[i], sn[i]);
+            }
+        }
+
+        void Normalize(const Vector2 *in, Vector2 *out, size_t count)
+        {
+            size_t i = 0;
+            for (; i + W <= count; i += W)
+                Pack::Load(in + i).Normalized().Store(out + i);
+            for (; i < count; ++i)
+            {
+                Vector2 v = in[i];
+                v.Normalize();
+                out[i] = v;
+            }
+        }
+
+        void Length(const Vector2 *in, float *out, size_t count)
+        {
+            size_t i = 0;
+            for (; i + W <= count; i += W)
+                Pack::Load(in + i).Length().Store(out + i);
+            for (; i < count; ++i)
+                out[i] = in[i].Length();
+        }
+
+        void DistanceSq(const Vector2 *in, const Vector2 &p, float *out, size_t count)
+        {
+            const Pack vp = Pack::Set1(p);
+            size_t i = 0;
+            for (; i + W <= count; i += W)
+                (Pack::Load(in + i) - vp).LengthSquared().Store(out + i);
+            for (; i < count; ++i)
+                out[i] = (in[i] - p).LengthSquared();
+        }
+
+        void MinMax(const Vector2 *in, size_t count, Vector2 &lo, Vector2 &hi)
+        {
+            if (count == 0)
+            {
+                lo = hi = Vector2{};
+                return;
+            }
+            lo = hi = in[0];
+            size_t i = 0;
+            if (count >= W)
+            {
+                Pack mn = Pack::Load(in), mx = mn;
+                for (i = W; i + W <= count; i += W)
+                {
+                    const Pack v = Pack::Load(in + i);
+                    mn = Pack::Min(mn, v);
+                    mx = Pack::Max(mx, v);
+                }
+                lo = {Simd::ReduceMin(mn.x), Simd::ReduceMin(mn.y)};
+                hi = {Simd::ReduceMax(mx.x), Simd::ReduceMax(mx.y)};
+            }
+            for (; i < count; ++i)
+            {
+                lo.x = std::min(lo.x, in[i].x);
+                lo.y = std::min(lo.y, in[i].y);
+                hi.x = std::max(hi.x, in[i].x);
+                hi.y = std::max(hi.y, in[i].y);
+            }
+        }
+
+    } // namespace Vector2Batch
+} // namespace NeonVector
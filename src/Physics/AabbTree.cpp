@@ -0,0 +1,340 @@
+#include <NeonVector/Physics/AabbTree.h>
+#include <algorithm>
+
+namespace NeonVector {
+    namespace Physics {
+
+        BodyHandle AabbTree::Insert(const Aabb& box, uint32_t user)
+        {
+            const uint32_t leaf = allocateNode();
+            Node& n = m_nodes[leaf];
+            n.box = box.Expanded(m_margin);
+            n.user = user;
+            n.height = 0;
+            insertLeaf(leaf);
+            ++m_leafCount;
+            return { leaf, m_nodes[leaf].generation };
+        }
+
+        bool AabbTree::Move(BodyHandle h, const Aabb& box, const Vector2& displacement)
+        {
+            const Node* n = findLeaf(h);
+            if (!n) return false;
+
+            // 太らせた箱に収まっていて、かつ太りすぎてもいなければそのまま
+            // （速く動いた後に止まった物体の大きな箱を、いつまでも残さない）
+            if (n->box.Contains(box) && box.Expanded(4.0f * m_margin).Contains(n->box))
+                return false;
+
+            Aabb fat = box.Expanded(m_margin);
+            const Vector2 ahead = displacement * 2.0f;
+            if (ahead.x < 0.0f) fat.lower.x += ahead.x; else fat.upper.x += ahead.x;
+            if (ahead.y < 0.0f) fat.lower.y += ahead.y; else fat.upper.y += ahead.y;
+
+            removeLeaf(h.index);
+            m_nodes[h.index].box = fat;
+            insertLeaf(h.index);
+            return true;
+        }
+
+        void AabbTree::Remove(BodyHandle h)
+        {
+            if (!findLeaf(h)) return;
+            removeLeaf(h.index);
+            freeNode(h.index);
+            --m_leafCount;
+        }
+
+        // 節は残して世代だけ進める（Clear 前のハンドルが再利用後の葉に一致しないように）
+        void AabbTree::Clear()
+        {
+            m_freeList = kNull;
+            for (size_t i = m_nodes.size(); i-- > 0;) {   // 若い番号から再利用する
+                Node& n = m_nodes[i];
+                if (n.height >= 0) {
+                    n.height = -1;
+                    ++n.generation;
+                }
+                n.parent = m_freeList;
+                m_freeList = static_cast<uint32_t>(i);
+            }
+            m_root = kNull;
+            m_leafCount = 0;
+        }
+
+        Aabb AabbTree::GetFatAabb(BodyHandle h) const
+        {
+            const Node* n = findLeaf(h);
+            return n ? n->box : Aabb{};
+        }
+
+        float AabbTree::AreaRatio() const
+        {
+            if (m_root == kNull) return 0.0f;
+            float total = 0.0f;
+            for (const Node& n : m_nodes)
+                if (n.height >= 0) total += n.box.Perimeter();
+            const float rootArea = m_nodes[m_root].box.Perimeter();
+            return rootArea > 0.0f ? total / rootArea : 0.0f;
+        }
+
+        void AabbTree::QueryAabb(const Aabb& box, std::vector<uint32_t>& out) const
+        {
+            out.clear();
+            query(box, [&](uint32_t i) { out.push_back(m_nodes[i].user); });
+        }
+
+        void AabbTree::FindPairs(std::vector<BodyPair>& out) const
+        {
+            out.clear();
+            if (m_root == kNull) return;
+
+            // 木を自分自身と同時に辿る（葉ごとに根から問い合わせるより、共通の祖先を 1 回で済ませる）。
+            // (a, a) は子同士の 3 組に分け、(a, b) は箱が重なるときだけ大きい方を分ける。
+            Stack stack;
+            stack.Push(m_root);
+            stack.Push(m_root);
+            while (!stack.Empty()) {
+                const uint32_t ib = stack.Pop();
+                const uint32_t ia = stack.Pop();
+                const Node& a = m_nodes[ia];
+                const Node& b = m_nodes[ib];
+
+                if (ia == ib) {
+                    if (a.IsLeaf()) continue;
+                    stack.Push(a.child1); stack.Push(a.child1);
+                    stack.Push(a.child2); stack.Push(a.child2);
+                    stack.Push(a.child1); stack.Push(a.child2);
+                    continue;
+                }
+                if (!a.box.Overlaps(b.box)) continue;
+                if (a.IsLeaf() && b.IsLeaf()) {
+                    out.push_back({ std::min(a.user, b.user), std::max(a.user, b.user) });
+                } else if (a.IsLeaf() || (!b.IsLeaf() && b.box.Perimeter() > a.box.Perimeter())) {
+                    stack.Push(ia); stack.Push(b.child1);
+                    stack.Push(ia); stack.Push(b.child2);
+                } else {
+                    stack.Push(a.child1); stack.Push(ib);
+                    stack.Push(a.child2); stack.Push(ib);
+                }
+            }
+        }
+
+        void AabbTree::Stack::grow()
+        {
+            std::vector<uint32_t> bigger(m_capacity * 2);
+            std::copy(m_data, m_data + m_size, bigger.begin());
+            m_heap.swap(bigger);
+            m_data = m_heap.data();
+            m_capacity = m_heap.size();
+        }
+
+        const AabbTree::Node* AabbTree::findLeaf(BodyHandle h) const
+        {
+            if (h.index >= m_nodes.size()) return nullptr;
+            const Node& n = m_nodes[h.index];
+            return (n.height == 0 && n.generation == h.generation) ? &n : nullptr;
+        }
+
+        uint32_t AabbTree::allocateNode()
+        {
+            uint32_t index;
+            if (m_freeList != kNull) {
+                index = m_freeList;
+                m_freeList = m_nodes[index].parent;
+            } else {
+                index = static_cast<uint32_t>(m_nodes.size());
+                m_nodes.emplace_back();
+            }
+            Node& n = m_nodes[index];
+            n.parent = n.child1 = n.child2 = kNull;
+            n.height = 0;
+            n.user = 0;
+            return index;
+        }
+
+        void AabbTree::freeNode(uint32_t index)
+        {
+            Node& n = m_nodes[index];
+            n.height = -1;
+            ++n.generation;   // 古いハンドルを無効にする
+            n.parent = m_freeList;
+            m_freeList = index;
+        }
+
+        void AabbTree::insertLeaf(uint32_t leaf)
+        {
+            if (m_root == kNull) {
+                m_root = leaf;
+                m_nodes[leaf].parent = kNull;
+                return;
+            }
+
+            // 兄弟を選ぶ: ここで止めて新しい親を作るコストと、子へ降りるコストを比べる。
+            // 降りる場合も祖先の箱が広がる分（inheritance）は必ず払う。
+            const Aabb leafBox = m_nodes[leaf].box;
+            uint32_t index = m_root;
+            while (!m_nodes[index].IsLeaf()) {
+                const Node& n = m_nodes[index];
+                const float area = n.box.Perimeter();
+                const float combined = Aabb::Union(n.box, leafBox).Perimeter();
+                const float cost = 2.0f * combined;
+                const float inheritance = 2.0f * (combined - area);
+
+                auto descendCost = [&](uint32_t c) {
+                    const Node& child = m_nodes[c];
+                    const float grown = Aabb::Union(leafBox, child.box).Perimeter();
+                    return (child.IsLeaf() ? grown : grown - child.box.Perimeter()) + inheritance;
+                };
+                const float cost1 = descendCost(n.child1);
+                const float cost2 = descendCost(n.child2);
+                if (cost < cost1 && cost < cost2) break;
+                index = (cost1 < cost2) ? n.child1 : n.child2;
+            }
+            const uint32_t sibling = index;
+
+            const uint32_t oldParent = m_nodes[sibling].parent;
+            const uint32_t newParent = allocateNode();   // m_nodes が伸びるので以降は添字で触る
+            Node& p = m_nodes[newParent];
+            p.parent = oldParent;
+            p.box = Aabb::Union(leafBox, m_nodes[sibling].box);
+            p.height = m_nodes[sibling].height + 1;
+            p.child1 = sibling;
+            p.child2 = leaf;
+            m_nodes[sibling].parent = newParent;
+            m_nodes[leaf].parent = newParent;
+
+            if (oldParent == kNull) {
+                m_root = newParent;
+            } else if (m_nodes[oldParent].child1 == sibling) {
+                m_nodes[oldParent].child1 = newParent;
+            } else {
+                m_nodes[oldParent].child2 = newParent;
+            }
+            refit(oldParent);
+        }
+
+        void AabbTree::removeLeaf(uint32_t leaf)
+        {
+            if (leaf == m_root) {
+                m_root = kNull;
+                return;
+            }
+
+            // 親を外して兄弟を祖父に直結する
+            const uint32_t parent = m_nodes[leaf].parent;
+            const uint32_t grandParent = m_nodes[parent].parent;
+            const uint32_t sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+            if (grandParent == kNull) {
+                m_root = sibling;
+                m_nodes[sibling].parent = kNull;
+                freeNode(parent);
+                return;
+            }
+            if (m_nodes[grandParent].child1 == parent) m_nodes[grandParent].child1 = sibling;
+            else m_nodes[grandParent].child2 = sibling;
+            m_nodes[sibling].parent = grandParent;
+            freeNode(parent);
+            refit(grandParent);
+        }
+
+        void AabbTree::refit(uint32_t index)
+        {
+            // index から根まで、回転で釣り合いを取りながら箱と高さを直す
+            while (index != kNull) {
+                index = balance(index);
+                Node& n = m_nodes[index];
+                const Node& c1 = m_nodes[n.child1];
+                const Node& c2 = m_nodes[n.child2];
+                n.height = 1 + std::max(c1.height, c2.height);
+                n.box = Aabb::Union(c1.box, c2.box);
+                index = n.parent;
+            }
+        }
+
+        uint32_t AabbTree::balance(uint32_t iA)
+        {
+            Node& A = m_nodes[iA];
+            if (A.IsLeaf() || A.height < 2) return iA;
+
+            const uint32_t iB = A.child1;
+            const uint32_t iC = A.child2;
+            Node& B = m_nodes[iB];
+            Node& C = m_nodes[iC];
+            const int32_t diff = C.height - B.height;
+
+            // 高い方の子 X を A の位置へ上げ、X の低い方の子を A に渡す（AVL の 1 回転）
+            auto replaceInParent = [&](uint32_t up, uint32_t parent) {
+                if (parent == kNull) m_root = up;
+                else if (m_nodes[parent].child1 == iA) m_nodes[parent].child1 = up;
+                else m_nodes[parent].child2 = up;
+            };
+
+            if (diff > 1) {
+                const uint32_t iF = C.child1;
+                const uint32_t iG = C.child2;
+                Node& F = m_nodes[iF];
+                Node& G = m_nodes[iG];
+
+                C.child1 = iA;
+                C.parent = A.parent;
+                A.parent = iC;
+                replaceInParent(iC, C.parent);
+
+                if (F.height > G.height) {
+                    C.child2 = iF;
+                    A.child2 = iG;
+                    G.parent = iA;
+                    A.box = Aabb::Union(B.box, G.box);
+                    C.box = Aabb::Union(A.box, F.box);
+                    A.height = 1 + std::max(B.height, G.height);
+                    C.height = 1 + std::max(A.height, F.height);
+                } else {
+                    C.child2 = iG;
+                    A.child2 = iF;
+                    F.parent = iA;
+                    A.box = Aabb::Union(B.box, F.box);
+                    C.box = Aabb::Union(A.box, G.box);
+                    A.height = 1 + std::max(B.height, F.height);
+                    C.height = 1 + std::max(A.height, G.height);
+                }
+                return iC;
+            }
+
+            if (diff < -1) {
+                const uint32_t iD = B.child1;
+                const uint32_t iE = B.child2;
+                Node& D = m_nodes[iD];
+                Node& E = m_nodes[iE];
+
+                B.child1 = iA;
+                B.parent = A.parent;
+                A.parent = iB;
+                replaceInParent(iB, B.parent);
+
+                if (D.height > E.height) {
+                    B.child2 = iD;
+                    A.child1 = iE;
+                    E.parent = iA;
+                    A.box = Aabb::Union(C.box, E.box);
+                    B.box = Aabb::Union(A.box, D.box);
+                    A.height = 1 + std::max(C.height, E.height);
+                    B.height = 1 + std::max(A.height, D.height);
+                } else {
+                    B.child2 = iE;
+                    A.child1 = iD;
+                    D.parent = iA;
+                    A.box = Aabb::Union(C.box, D.box);
+                    B.box = Aabb::Union(A.box, E.box);
+                    A.height = 1 + std::max(C.height, D.height);
+                    B.height = 1 + std::max(A.height, E.height);
+                }
+                return iB;
+            }
+
+            return iA;
+        }
+
+    } // namespace Physics
+} // namespace NeonVector
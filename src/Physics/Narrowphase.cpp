@@ -0,0 +1,366 @@
+#include <NeonVector/Physics/Narrowphase.h>
+#include <algorithm>
+#include <limits>
+
+namespace NeonVector {
+    namespace Physics {
+
+        namespace {
+            constexpr int kMaxIterations = 32;
+
+            /** @brief B の頂点を A のローカル座標へ移したもの（小さい片はヒープを使わない） */
+            class LocalVertices {
+            public:
+                LocalVertices(const ConvexPiece& b, const Transform& rel)
+                {
+                    const size_t n = b.vertices.size();
+                    if (n > 16) {
+                        m_heap.resize(n);
+                        m_data = m_heap.data();
+                    }
+                    for (size_t i = 0; i < n; ++i) m_data[i] = rel.Apply(b.vertices[i]);
+                    m_size = n;
+                }
+                const Vector2& operator[](size_t i) const { return m_data[i]; }
+                size_t size() const { return m_size; }
+            private:
+                Vector2 m_fixed[16];
+                std::vector<Vector2> m_heap;
+                Vector2* m_data = m_fixed;
+                size_t m_size = 0;
+            };
+
+            /** @brief 局所座標での結果（A のローカル座標） */
+            struct LocalContact {
+                Vector2 normal;
+                float depth;
+                Vector2 point;
+            };
+
+            void toWorld(const LocalContact& lc, const Transform& xa, Contact* contact)
+            {
+                if (!contact) return;
+                contact->normal = xa.Rotate(lc.normal);
+                contact->depth = lc.depth;
+                contact->point = xa.Apply(lc.point);
+            }
+
+            /** @brief dir 方向に最も遠い頂点の添字 */
+            template<class Verts>
+            size_t supportIndex(const Verts& v, size_t n, const Vector2& dir)
+            {
+                size_t best = 0;
+                float bestDot = v[0].Dot(dir);
+                for (size_t i = 1; i < n; ++i) {
+                    const float d = v[i].Dot(dir);
+                    if (d > bestDot) { bestDot = d; best = i; }
+                }
+                return best;
+            }
+
+            bool satLocal(const ConvexPiece& a, const ConvexPiece& b, const Transform& rel, LocalContact* out)
+            {
+                const LocalVertices bv(b, rel);
+                const size_t na = a.vertices.size(), nb = bv.size();
+
+                float bestSep = -std::numeric_limits<float>::max();
+                Vector2 bestNormal;
+                Vector2 bestPoint;
+
+                // A の辺の法線: B の最も深い頂点までの符号付き距離
+                for (size_t i = 0; i < na; ++i) {
+                    const Vector2& n = a.normals[i];
+                    const size_t j = supportIndex(bv, nb, Vector2{ -n.x, -n.y });
+                    const float sep = n.Dot(bv[j] - a.vertices[i]);
+                    if (sep >= 0.0f) return false;
+                    if (sep > bestSep) { bestSep = sep; bestNormal = n; bestPoint = bv[j]; }
+                }
+                // B の辺の法線（A のローカル座標へ回す）
+                for (size_t j = 0; j < nb; ++j) {
+                    const Vector2 n = rel.Rotate(b.normals[j]);
+                    const size_t i = supportIndex(a.vertices, na, Vector2{ -n.x, -n.y });
+                    const float sep = n.Dot(a.vertices[i] - bv[j]);
+                    if (sep >= 0.0f) return false;
+                    if (sep > bestSep) {
+                        // B の辺が分離に最も近い: A の頂点が B に入り込んでいる。B の最深点は反対向きの支持点
+                        bestSep = sep;
+                        bestNormal = Vector2{ -n.x, -n.y };
+                        bestPoint = bv[supportIndex(bv, nb, n)];
+                    }
+                }
+                if (out) *out = { bestNormal, -bestSep, bestPoint };
+                return true;
+            }
+
+            /** @brief 差集合 A - B の支持点（A のローカル座標） */
+            struct Minkowski {
+                const ConvexPiece& a;
+                const LocalVertices& b;
+
+                Vector2 Support(const Vector2& d) const
+                {
+                    const Vector2 pa = a.vertices[supportIndex(a.vertices, a.vertices.size(), d)];
+                    const Vector2 pb = b[supportIndex(b, b.size(), Vector2{ -d.x, -d.y })];
+                    return pa - pb;
+                }
+            };
+
+            /** @brief (a × b) × c */
+            Vector2 tripleProduct(const Vector2& a, const Vector2& b, const Vector2& c)
+            {
+                return b * a.Dot(c) - a * b.Dot(c);
+            }
+
+            /** @brief 単体を原点に近い部分へ縮め、次の探索方向を決める。原点を含めば true */
+            bool doSimplex(Vector2* simplex, int& count, Vector2& d)
+            {
+                const Vector2 a = simplex[count - 1];
+                const Vector2 ao{ -a.x, -a.y };
+                if (count == 2) {
+                    const Vector2 ab = simplex[0] - a;
+                    if (ab.Dot(ao) > 0.0f) {
+                        d = tripleProduct(ab, ao, ab);
+                        if (d.LengthSquared() < 1e-12f) return true;   // 原点が辺の上
+                    } else {
+                        simplex[0] = a;
+                        count = 1;
+                        d = ao;
+                    }
+                    return false;
+                }
+                const Vector2 b = simplex[1], c = simplex[0];
+                const Vector2 ab = b - a, ac = c - a;
+                const Vector2 abPerp = tripleProduct(ac, ab, ab);   // ab に垂直で c の反対側
+                const Vector2 acPerp = tripleProduct(ab, ac, ac);
+                if (abPerp.Dot(ao) > 0.0f) {
+                    simplex[0] = b; simplex[1] = a; count = 2;
+                    d = abPerp;
+                    return false;
+                }
+                if (acPerp.Dot(ao) > 0.0f) {
+                    simplex[0] = c; simplex[1] = a; count = 2;
+                    d = acPerp;
+                    return false;
+                }
+                return true;
+            }
+
+            /** @brief GJK が原点を囲んだ三角形から、原点に最も近い差集合の辺を広げて探す（EPA） */
+            LocalContact epa(const Minkowski& m, const Vector2* simplex)
+            {
+                std::vector<Vector2> poly(simplex, simplex + 3);
+                if ((poly[1] - poly[0]).Cross(poly[2] - poly[0]) < 0.0f) std::swap(poly[1], poly[2]);
+
+                Vector2 normal{ 1.0f, 0.0f };
+                float dist = 0.0f;
+                for (int iter = 0; iter < kMaxIterations; ++iter) {
+                    size_t edge = 0;
+                    dist = std::numeric_limits<float>::max();
+                    for (size_t i = 0; i < poly.size(); ++i) {
+                        const Vector2 e = poly[(i + 1) % poly.size()] - poly[i];
+                        Vector2 n{ e.y, -e.x };   // 反時計回りの外向き
+                        const float len = n.Length();
+                        if (len < 1e-12f) continue;
+                        n = n * (1.0f / len);
+                        const float d = n.Dot(poly[i]);
+                        if (d < dist) { dist = d; normal = n; edge = i; }
+                    }
+                    const Vector2 s = m.Support(normal);
+                    if (s.Dot(normal) - dist < 1e-4f * (1.0f + dist)) break;   // これ以上広がらない
+                    poly.insert(poly.begin() + static_cast<std::ptrdiff_t>(edge + 1), s);
+                }
+                const Vector2 deepest = m.b[supportIndex(m.b, m.b.size(), Vector2{ -normal.x, -normal.y })];
+                return { normal, dist, deepest };
+            }
+
+            bool gjkLocal(const ConvexPiece& a, const ConvexPiece& b, const Transform& rel, LocalContact* out)
+            {
+                const LocalVertices bv(b, rel);
+                const Minkowski m{ a, bv };
+
+                Vector2 d = rel.Apply(b.center) - a.center;
+                if (d.LengthSquared() < 1e-12f) d = Vector2{ 1.0f, 0.0f };
+                Vector2 simplex[3];
+                int count = 1;
+                simplex[0] = m.Support(d);
+                d = Vector2{ -simplex[0].x, -simplex[0].y };
+
+                for (int iter = 0; iter < kMaxIterations; ++iter) {
+                    if (d.LengthSquared() < 1e-12f) break;   // 原点が支持点そのもの: 接している
+                    const Vector2 p = m.Support(d);
+                    if (p.Dot(d) <= 0.0f) return false;     // 原点を越えられない: 分離
+                    simplex[count++] = p;
+                    if (!doSimplex(simplex, count, d)) continue;
+                    if (out) {
+                        if (count == 3) {
+                            *out = epa(m, simplex);
+                        } else {
+                            // 原点が単体の辺・頂点の上（接している）: 深さ 0
+                            Vector2 n = rel.Apply(b.center) - a.center;
+                            n.Normalize();
+                            *out = { n, 0.0f, bv[supportIndex(bv, bv.size(), Vector2{ -n.x, -n.y })] };
+                        }
+                    }
+                    return true;
+                }
+                return false;
+            }
+
+            bool pieceLocal(const ConvexPiece& a, const ConvexPiece& b, const Transform& rel, LocalContact* out)
+            {
+                if (a.vertices.size() <= kSatMaxVertices && b.vertices.size() <= kSatMaxVertices)
+                    return satLocal(a, b, rel, out);
+                return gjkLocal(a, b, rel, out);
+            }
+
+            /** @brief 凸片と円（A のローカル座標）。Box2D の多角形 vs 円と同じ場合分け */
+            bool circleLocal(const ConvexPiece& a, const Vector2& c, float r, LocalContact* out)
+            {
+                const size_t n = a.vertices.size();
+                size_t face = 0;
+                float sep = -std::numeric_limits<float>::max();
+                for (size_t i = 0; i < n; ++i) {
+                    const float s = a.normals[i].Dot(c - a.vertices[i]);
+                    if (s >= r) return false;
+                    if (s > sep) { sep = s; face = i; }
+                }
+                const Vector2 v1 = a.vertices[face];
+                const Vector2 v2 = a.vertices[(face + 1) % n];
+                Vector2 normal = a.normals[face];
+                float depth = r - sep;
+                if (sep > 0.0f) {
+                    // 中心が外: 辺の端を越えていれば頂点が最も近い
+                    const Vector2* corner = nullptr;
+                    if ((c - v1).Dot(v2 - v1) <= 0.0f) corner = &v1;
+                    else if ((c - v2).Dot(v1 - v2) <= 0.0f) corner = &v2;
+                    if (corner) {
+                        const Vector2 dv = c - *corner;
+                        const float dist2 = dv.LengthSquared();
+                        if (dist2 >= r * r) return false;
+                        const float dist = std::sqrt(dist2);
+                        normal = dv * (1.0f / dist);
+                        depth = r - dist;
+                    }
+                }
+                if (out) *out = { normal, depth, c - normal * r };
+                return true;
+            }
+        }
+
+        bool SatOverlap(const ConvexPiece& a, const Transform& xa, const ConvexPiece& b, const Transform& xb,
+            Contact* contact)
+        {
+            LocalContact lc;
+            if (!satLocal(a, b, Transform::Relative(xa, xb), contact ? &lc : nullptr)) return false;
+            toWorld(lc, xa, contact);
+            return true;
+        }
+
+        bool GjkOverlap(const ConvexPiece& a, const Transform& xa, const ConvexPiece& b, const Transform& xb,
+            Contact* contact)
+        {
+            LocalContact lc;
+            if (!gjkLocal(a, b, Transform::Relative(xa, xb), contact ? &lc : nullptr)) return false;
+            toWorld(lc, xa, contact);
+            return true;
+        }
+
+        bool Overlap(const PolygonShape& a, const Transform& xa, const PolygonShape& b, const Transform& xb,
+            Contact* contact)
+        {
+            // 全体の外接円で先に弾く（ほとんどの組はここで終わる）
+            const float reach = a.BoundingRadius() + b.BoundingRadius();
+            if ((xb.position - xa.position).LengthSquared() >= reach * reach) return false;
+
+            const Transform rel = Transform::Relative(xa, xb);
+            bool hit = false;
+            LocalContact best{ Vector2{}, -1.0f, Vector2{} };
+            for (const ConvexPiece& pb : b.Pieces()) {
+                const Vector2 cb = rel.Apply(pb.center);
+                for (const ConvexPiece& pa : a.Pieces()) {
+                    const float r = pa.radius + pb.radius;
+                    if ((cb - pa.center).LengthSquared() >= r * r) continue;
+                    LocalContact lc;
+                    if (!pieceLocal(pa, pb, rel, contact ? &lc : nullptr)) continue;
+                    if (!contact) return true;
+                    hit = true;
+                    if (lc.depth > best.depth) best = lc;
+                }
+            }
+            if (hit) toWorld(best, xa, contact);
+            return hit;
+        }
+
+        bool Overlap(const PolygonShape& a, const Transform& xa, const Vector2& center, float radius,
+            Contact* contact)
+        {
+            const Vector2 c = xa.ApplyInverse(center);
+            const float reach = a.BoundingRadius() + radius;
+            if (c.LengthSquared() >= reach * reach) return false;
+
+            bool hit = false;
+            LocalContact best{ Vector2{}, -1.0f, Vector2{} };
+            for (const ConvexPiece& p : a.Pieces()) {
+                const float r = p.radius + radius;
+                if ((c - p.center).LengthSquared() >= r * r) continue;
+                LocalContact lc;
+                if (!circleLocal(p, c, radius, &lc)) continue;
+                if (!contact) return true;
+                hit = true;
+                if (lc.depth > best.depth) best = lc;
+            }
+            if (hit) toWorld(best, xa, contact);
+            return hit;
+        }
+
+        bool SegmentCast(const PolygonShape& a, const Transform& xa, const Vector2& from, const Vector2& to,
+            float& t, Vector2* normal)
+        {
+            const Vector2 p0 = xa.ApplyInverse(from);
+            const Vector2 d = xa.ApplyInverse(to) - p0;
+
+            // 線分と外接円の最短距離で先に弾く
+            const float dd = d.LengthSquared();
+            const float u = (dd > 0.0f) ? std::clamp(-p0.Dot(d) / dd, 0.0f, 1.0f) : 0.0f;
+            const float R = a.BoundingRadius();
+            if ((p0 + d * u).LengthSquared() >= R * R) return false;
+
+            // 各片で線分を半平面に切り詰める（Cyrus-Beck）。入った時刻の最小が答え
+            float bestT = 2.0f;
+            Vector2 bestN;
+            for (const ConvexPiece& p : a.Pieces()) {
+                float lower = 0.0f, upper = 1.0f;
+                int entered = -1;
+                bool miss = false;
+                for (size_t i = 0; i < p.vertices.size() && !miss; ++i) {
+                    const Vector2& n = p.normals[i];
+                    const float num = n.Dot(p.vertices[i] - p0);   // > 0 なら始点はこの辺の内側
+                    const float den = n.Dot(d);
+                    if (den == 0.0f) {
+                        if (num < 0.0f) miss = true;
+                    } else if (den < 0.0f) {
+                        const float ti = num / den;
+                        if (ti > lower) { lower = ti; entered = static_cast<int>(i); }
+                    } else {
+                        const float ti = num / den;
+                        if (ti < upper) upper = ti;
+                    }
+                    if (upper < lower) miss = true;
+                }
+                if (miss || lower >= bestT) continue;
+                bestT = lower;
+                if (entered >= 0) {
+                    bestN = p.normals[entered];
+                } else {
+                    bestN = Vector2{ -d.x, -d.y };
+                    bestN.Normalize();
+                }
+            }
+            if (bestT > 1.0f) return false;
+            t = bestT;
+            if (normal) *normal = xa.Rotate(bestN);
+            return true;
+        }
+
+    } // namespace Physics
+} // namespace NeonVector
@@ -0,0 +1,156 @@
+#include <NeonVector/Physics/Polygon.h>
+#include <algorithm>
+
+namespace NeonVector {
+    namespace Physics {
+
+        namespace {
+            constexpr float kLinearSlop = 1e-5f;
+
+            float cross(const Vector2& o, const Vector2& a, const Vector2& b)
+            {
+                return (a - o).Cross(b - o);
+            }
+
+            /** @brief 三角形 abc（反時計回り）の内側か辺上に p があるか */
+            bool inTriangle(const Vector2& p, const Vector2& a, const Vector2& b, const Vector2& c)
+            {
+                return cross(a, b, p) >= 0.0f && cross(b, c, p) >= 0.0f && cross(c, a, p) >= 0.0f;
+            }
+
+            bool isConvex(const std::vector<Vector2>& pts, const std::vector<int>& poly)
+            {
+                const size_t n = poly.size();
+                for (size_t i = 0; i < n; ++i) {
+                    if (cross(pts[poly[i]], pts[poly[(i + 1) % n]], pts[poly[(i + 2) % n]]) < -kLinearSlop)
+                        return false;
+                }
+                return true;
+            }
+
+            /** @brief 耳切りで三角形に分ける（pts は反時計回り、重複・一直線の点なし） */
+            std::vector<std::vector<int>> triangulate(const std::vector<Vector2>& pts)
+            {
+                std::vector<std::vector<int>> tris;
+                std::vector<int> ring(pts.size());
+                for (size_t i = 0; i < ring.size(); ++i) ring[i] = static_cast<int>(i);
+
+                size_t guard = 0;
+                while (ring.size() > 3 && guard < pts.size() * pts.size()) {
+                    ++guard;
+                    const size_t n = ring.size();
+                    bool clipped = false;
+                    for (size_t i = 0; i < n; ++i) {
+                        const int ia = ring[(i + n - 1) % n], ib = ring[i], ic = ring[(i + 1) % n];
+                        if (cross(pts[ia], pts[ib], pts[ic]) <= kLinearSlop) continue;   // 凹の頂点は耳にならない
+                        bool ear = true;
+                        for (int j : ring) {
+                            if (j == ia || j == ib || j == ic) continue;
+                            if (inTriangle(pts[j], pts[ia], pts[ib], pts[ic])) { ear = false; break; }
+                        }
+                        if (!ear) continue;
+                        tris.push_back({ ia, ib, ic });
+                        ring.erase(ring.begin() + static_cast<std::ptrdiff_t>(i));
+                        clipped = true;
+                        break;
+                    }
+                    if (!clipped) break;   // 自己交差などで耳がない: 残りは諦める
+                }
+                if (ring.size() == 3) tris.push_back(ring);
+                return tris;
+            }
+
+            /** @brief 共有辺を 1 本持つ 2 片を併合する（凸でなくなるなら false） */
+            bool tryMerge(const std::vector<Vector2>& pts, const std::vector<int>& p, const std::vector<int>& q,
+                std::vector<int>& merged)
+            {
+                const size_t np = p.size(), nq = q.size();
+                for (size_t i = 0; i < np; ++i) {
+                    const int a = p[i], b = p[(i + 1) % np];
+                    for (size_t j = 0; j < nq; ++j) {
+                        if (q[j] != b || q[(j + 1) % nq] != a) continue;
+                        // p: ... a b ... / q: ... b a ... → p を b から a まで、続けて q を a の次から b の手前まで
+                        merged.clear();
+                        for (size_t k = 0; k < np; ++k) merged.push_back(p[(i + 1 + k) % np]);
+                        for (size_t k = 2; k < nq; ++k) merged.push_back(q[(j + k) % nq]);
+                        return isConvex(pts, merged);
+                    }
+                }
+                return false;
+            }
+
+            ConvexPiece makePiece(const std::vector<Vector2>& pts, const std::vector<int>& poly)
+            {
+                ConvexPiece piece;
+                const size_t n = poly.size();
+                for (int i : poly) piece.vertices.push_back(pts[i]);
+                Vector2 sum{ 0.0f, 0.0f };
+                for (const Vector2& v : piece.vertices) sum = sum + v;
+                piece.center = sum * (1.0f / static_cast<float>(n));
+                for (size_t i = 0; i < n; ++i) {
+                    const Vector2 e = piece.vertices[(i + 1) % n] - piece.vertices[i];
+                    Vector2 nrm{ e.y, -e.x };   // 反時計回りの外向き
+                    nrm.Normalize();
+                    piece.normals.push_back(nrm);
+                    piece.radius = std::max(piece.radius, (piece.vertices[i] - piece.center).Length());
+                }
+                return piece;
+            }
+        }
+
+        void PolygonShape::Set(const Vector2* outline, size_t count)
+        {
+            m_pieces.clear();
+            m_radius = 0.0f;
+
+            // 重複点と一直線上の点を除く（耳切りの判定が縮退しないように）
+            std::vector<Vector2> pts;
+            for (size_t i = 0; i < count; ++i) {
+                if (pts.empty() || (outline[i] - pts.back()).LengthSquared() > kLinearSlop * kLinearSlop)
+                    pts.push_back(outline[i]);
+            }
+            while (pts.size() > 1 && (pts.front() - pts.back()).LengthSquared() <= kLinearSlop * kLinearSlop)
+                pts.pop_back();
+            for (size_t i = 0; pts.size() >= 3 && i < pts.size();) {
+                const size_t n = pts.size();
+                if (std::fabs(cross(pts[(i + n - 1) % n], pts[i], pts[(i + 1) % n])) <= kLinearSlop) {
+                    pts.erase(pts.begin() + static_cast<std::ptrdiff_t>(i));
+                    i = 0;
+                } else {
+                    ++i;
+                }
+            }
+            if (pts.size() < 3) return;
+
+            float area = 0.0f;
+            for (size_t i = 0; i < pts.size(); ++i) area += pts[i].Cross(pts[(i + 1) % pts.size()]);
+            if (area < 0.0f) std::reverse(pts.begin(), pts.end());
+            for (const Vector2& p : pts) m_radius = std::max(m_radius, p.Length());
+
+            std::vector<std::vector<int>> polys;
+            std::vector<int> all(pts.size());
+            for (size_t i = 0; i < all.size(); ++i) all[i] = static_cast<int>(i);
+            if (isConvex(pts, all)) {
+                polys.push_back(all);
+            } else {
+                // 三角形に分けてから、凸を保てる限り隣どうしを併合する
+                polys = triangulate(pts);
+                std::vector<int> merged;
+                for (bool changed = true; changed;) {
+                    changed = false;
+                    for (size_t i = 0; i < polys.size() && !changed; ++i) {
+                        for (size_t j = i + 1; j < polys.size(); ++j) {
+                            if (!tryMerge(pts, polys[i], polys[j], merged)) continue;
+                            polys[i] = merged;
+                            polys.erase(polys.begin() + static_cast<std::ptrdiff_t>(j));
+                            changed = true;
+                            break;
+                        }
+                    }
+                }
+            }
+            for (const auto& poly : polys) m_pieces.push_back(makePiece(pts, poly));
+        }
+
+    } // namespace Physics
+} // namespace NeonVector
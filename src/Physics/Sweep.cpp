@@ -0,0 +1,243 @@
+#include <NeonVector/Physics/Sweep.h>
+#include <NeonVector/Math/Simd.h>
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace NeonVector {
+    namespace Physics {
+
+        namespace {
+#if defined(NEONVECTOR_SIMD_AVX)
+            using F = Simd::Float8;
+#else
+            using F = Simd::Float4;
+#endif
+            constexpr size_t W = F::kWidth;
+
+            // float 用の同名関数。同じカーネルを 1 組版（T = float）と一括版（T = F）で使い、式を 1 か所にする。
+            // float 版のマスクは 1 / 0 で持つ（Select にしか渡さないので Simd の全ビット 1 と揃えなくてよい）。
+            inline float Greater(float a, float b) { return a > b ? 1.0f : 0.0f; }
+            inline float Select(float mask, float a, float b) { return mask != 0.0f ? a : b; }
+            inline float Sqrt(float a) { return std::sqrt(a); }
+            inline float Min(float a, float b) { return a < b ? a : b; }
+            inline float Max(float a, float b) { return a > b ? a : b; }
+
+            template<class T>
+            T splat(float s)
+            {
+                if constexpr (std::is_same_v<T, float>) return s;
+                else return T::Set1(s);
+            }
+
+            /** @brief 原点から d だけ動く点 m が、原点中心・半径 R の円に入る時刻（m は相対位置） */
+            template<class T>
+            T circleToi(T mx, T my, T dx, T dy, T R)
+            {
+                const T zero = splat<T>(0.0f), one = splat<T>(1.0f), none = splat<T>(kNoImpact);
+                const T c = mx * mx + my * my - R * R;   // < 0 なら始点で重なっている
+                const T a = dx * dx + dy * dy;
+                const T b = mx * dx + my * dy;           // < 0 なら近づいている
+                const T disc = b * b - a * c;
+                const T aSafe = Select(Greater(a, zero), a, one);
+                T t = (zero - b - Sqrt(Max(disc, zero))) / aSafe;
+                // 条件をマスクの入れ子で重ねる（レーン毎に分岐せず、外側ほど優先）
+                t = Select(Greater(t, one), none, t);
+                t = Select(Greater(zero, disc), none, t);
+                t = Select(Greater(zero, b), t, none);
+                return Select(Greater(zero, c), zero, t);
+            }
+
+            /** @brief (px, py) を正規化。長さ 0 なら fallback */
+            template<class T>
+            void normalize(T px, T py, T fallbackX, T fallbackY, T& nx, T& ny)
+            {
+                const T zero = splat<T>(0.0f), one = splat<T>(1.0f);
+                const T len = Sqrt(px * px + py * py);
+                const T nonZero = Greater(len, zero);
+                const T lenSafe = Select(nonZero, len, one);
+                nx = Select(nonZero, px / lenSafe, fallbackX);
+                ny = Select(nonZero, py / lenSafe, fallbackY);
+            }
+
+            template<class T>
+            T circleKernel(T mx, T my, T dx, T dy, T R, T& nx, T& ny)
+            {
+                const T t = circleToi(mx, my, dx, dy, R);
+                const T tc = Min(t, splat<T>(1.0f));
+                normalize(mx + dx * tc, my + dy * tc, splat<T>(0.0f), splat<T>(-1.0f), nx, ny);
+                return t;
+            }
+
+            /**
+             * @brief 点 m（線分の始点 a からの相対位置）が d だけ動くとき、a から e だけ伸びる線分を
+             *        半径 r だけ太らせたカプセルに入る時刻
+             *
+             * カプセル = 両側の辺が作る長方形 ∪ 両端の円。外から入るときの最初の時刻は
+             * 「長辺から入る時刻」と「両端の円に入る時刻」の最小（短辺から入る所は端の円に含まれる）。
+             */
+            template<class T>
+            T segmentKernel(T mx, T my, T dx, T dy, T ex, T ey, T r, T& nx, T& ny)
+            {
+                const T zero = splat<T>(0.0f), one = splat<T>(1.0f), none = splat<T>(kNoImpact);
+                const T minusOne = splat<T>(-1.0f);
+
+                const T ee = ex * ex + ey * ey;
+                const T eeSafe = Select(Greater(ee, zero), ee, one);
+
+                // 始点で最も近い線分上の点（重なり判定と、重なっていたときの法線）
+                const T u0 = Min(Max((mx * ex + my * ey) / eeSafe, zero), one);
+                const T qx = mx - ex * u0;
+                const T qy = my - ey * u0;
+                const T inside = Greater(r * r, qx * qx + qy * qy);
+
+                // 長辺: 点の居る側の辺へ向かって進んでいるときだけ
+                const T len = Sqrt(eeSafe);
+                const T lnx = (zero - ey) / len;
+                const T lny = ex / len;
+                const T s0 = mx * lnx + my * lny;
+                const T sgn = Select(Greater(zero, s0), minusOne, one);
+                const T sideNx = lnx * sgn;
+                const T sideNy = lny * sgn;
+                const T dist0 = s0 * sgn;
+                const T approach = (dx * lnx + dy * lny) * sgn;
+                const T approachSafe = Select(Greater(zero, approach), approach, minusOne);
+                T ts = (dist0 - r) / (zero - approachSafe);
+                const T us = ((mx + dx * ts) * ex + (my + dy * ts) * ey) / eeSafe;
+                ts = Select(Greater(ts, one), none, ts);
+                ts = Select(Greater(zero, us), none, ts);
+                ts = Select(Greater(us, one), none, ts);
+                ts = Select(Greater(r, dist0), none, ts);   // 帯の中にいる: 入るなら端の円から
+                ts = Select(Greater(zero, approach), ts, none);
+
+                // 両端の円
+                const T tA = circleToi(mx, my, dx, dy, r);
+                const T tB = circleToi(mx - ex, my - ey, dx, dy, r);
+                const T tCap = Min(tA, tB);
+                T t = Min(ts, tCap);
+
+                // 法線: 長辺が先なら辺の法線、そうでなければ当たった端の円の中心から
+                const T tc = Min(t, one);
+                const T bFirst = Greater(tA, tB);
+                T capNx, capNy;
+                normalize(mx + dx * tc - Select(bFirst, ex, zero), my + dy * tc - Select(bFirst, ey, zero),
+                    sideNx, sideNy, capNx, capNy);
+                const T sideFirst = Greater(tCap, ts);
+                nx = Select(sideFirst, sideNx, capNx);
+                ny = Select(sideFirst, sideNy, capNy);
+
+                // 始点で重なっていれば 0、法線は最も近い点から押し出す向き
+                T inNx, inNy;
+                normalize(qx, qy, sideNx, sideNy, inNx, inNy);
+                nx = Select(inside, inNx, nx);
+                ny = Select(inside, inNy, ny);
+                return Select(inside, zero, t);
+            }
+
+            // 一括版の入力を集める SoA の作業領域（W 組分）
+            struct Lanes {
+                alignas(32) float mx[W], my[W], dx[W], dy[W], ex[W], ey[W], r[W];
+                alignas(32) float t[W], nx[W], ny[W];
+            };
+
+            void gatherCircle(Lanes& l, size_t k, const MovingCircle& mover, const MovingCircle& target, const Vector2& wrap)
+            {
+                const Vector2 m = WrapDelta(mover.pos - target.pos, wrap);
+                const Vector2 d = mover.delta - target.delta;
+                l.mx[k] = m.x; l.my[k] = m.y;
+                l.dx[k] = d.x; l.dy[k] = d.y;
+                l.r[k] = mover.radius + target.radius;
+            }
+
+            void gatherSegment(Lanes& l, size_t k, const MovingCircle& mover, const MovingSegment& target, const Vector2& wrap)
+            {
+                // 線分の中点で最も近い像を選ぶ（端点で選ぶと長い線分の反対側の像を掴むことがある）
+                const Vector2 mid = (target.a + target.b) * 0.5f;
+                const Vector2 m = WrapDelta(mover.pos - mid, wrap) + (mid - target.a);
+                const Vector2 d = mover.delta - target.delta;
+                const Vector2 e = target.b - target.a;
+                l.mx[k] = m.x; l.my[k] = m.y;
+                l.dx[k] = d.x; l.dy[k] = d.y;
+                l.ex[k] = e.x; l.ey[k] = e.y;
+                l.r[k] = mover.radius;
+            }
+
+            /** @brief 端数のレーンを「離れたところで止まっている点」で埋める（必ず当たらない） */
+            void padLanes(Lanes& l, size_t from)
+            {
+                for (size_t k = from; k < W; ++k) {
+                    l.mx[k] = 1.0f; l.my[k] = 0.0f;
+                    l.dx[k] = 0.0f; l.dy[k] = 0.0f;
+                    l.ex[k] = 1.0f; l.ey[k] = 0.0f;
+                    l.r[k] = 0.0f;
+                }
+            }
+
+            void scatter(const Lanes& l, size_t n, SweepHit* out)
+            {
+                for (size_t k = 0; k < n; ++k)
+                    out[k] = { l.t[k], Vector2{ l.nx[k], l.ny[k] } };
+            }
+        }
+
+        float TimeOfImpact(const MovingCircle& mover, const MovingCircle& target, const Vector2& wrap, Vector2* normal)
+        {
+            const Vector2 m = WrapDelta(mover.pos - target.pos, wrap);
+            const Vector2 d = mover.delta - target.delta;
+            float nx, ny;
+            const float t = circleKernel(m.x, m.y, d.x, d.y, mover.radius + target.radius, nx, ny);
+            if (normal) *normal = Vector2{ nx, ny };
+            return t;
+        }
+
+        float TimeOfImpact(const MovingCircle& mover, const MovingSegment& target, const Vector2& wrap, Vector2* normal)
+        {
+            Lanes l;
+            gatherSegment(l, 0, mover, target, wrap);
+            float nx, ny;
+            const float t = segmentKernel(l.mx[0], l.my[0], l.dx[0], l.dy[0], l.ex[0], l.ey[0], l.r[0], nx, ny);
+            if (normal) *normal = Vector2{ nx, ny };
+            return t;
+        }
+
+        void TimeOfImpact(const MovingCircle* movers, const MovingCircle* targets,
+            const SweepPair* pairs, size_t count, const Vector2& wrap, SweepHit* out)
+        {
+            Lanes l;
+            for (size_t i = 0; i < count; i += W) {
+                const size_t n = std::min(W, count - i);
+                for (size_t k = 0; k < n; ++k)
+                    gatherCircle(l, k, movers[pairs[i + k].mover], targets[pairs[i + k].target], wrap);
+                padLanes(l, n);
+
+                F nx, ny;
+                const F t = circleKernel(F::Load(l.mx), F::Load(l.my), F::Load(l.dx), F::Load(l.dy), F::Load(l.r), nx, ny);
+                t.Store(l.t);
+                nx.Store(l.nx);
+                ny.Store(l.ny);
+                scatter(l, n, out + i);
+            }
+        }
+
+        void TimeOfImpact(const MovingCircle* movers, const MovingSegment* targets,
+            const SweepPair* pairs, size_t count, const Vector2& wrap, SweepHit* out)
+        {
+            Lanes l;
+            for (size_t i = 0; i < count; i += W) {
+                const size_t n = std::min(W, count - i);
+                for (size_t k = 0; k < n; ++k)
+                    gatherSegment(l, k, movers[pairs[i + k].mover], targets[pairs[i + k].target], wrap);
+                padLanes(l, n);
+
+                F nx, ny;
+                const F t = segmentKernel(F::Load(l.mx), F::Load(l.my), F::Load(l.dx), F::Load(l.dy),
+                    F::Load(l.ex), F::Load(l.ey), F::Load(l.r), nx, ny);
+                t.Store(l.t);
+                nx.Store(l.nx);
+                ny.Store(l.ny);
+                scatter(l, n, out + i);
+            }
+        }
+
+    } // namespace Physics
+} // namespace NeonVector
@@ -0,0 +1,252 @@
+#include <NeonVector/Physics/UniformGrid.h>
+#include <algorithm>
+#include <cmath>
+
+namespace NeonVector {
+    namespace Physics {
+
+        UniformGrid::UniformGrid(float cellSize, size_t bucketCount)
+            : m_cellSize(cellSize > 1.0f ? cellSize : 1.0f)
+        {
+            size_t n = 1;
+            while (n < bucketCount) n <<= 1;   // ハッシュをマスクで取るので 2 の冪
+            m_bucketCount = n;
+            DisableWrap();
+        }
+
+        void UniformGrid::SetWrap(const Vector2& size)
+        {
+            m_wrap = true;
+            m_size = size;
+            // セルが世界をちょうど等分するように大きさを丸める（端のセルが欠けない）
+            m_cellsX = std::max(1, static_cast<int>(size.x / m_cellSize));
+            m_cellsY = std::max(1, static_cast<int>(size.y / m_cellSize));
+            m_invCellX = static_cast<float>(m_cellsX) / size.x;
+            m_invCellY = static_cast<float>(m_cellsY) / size.y;
+            m_cells.assign(static_cast<size_t>(m_cellsX) * static_cast<size_t>(m_cellsY), {});
+            rebuild();
+        }
+
+        void UniformGrid::DisableWrap()
+        {
+            m_wrap = false;
+            m_invCellX = m_invCellY = 1.0f / m_cellSize;
+            m_cells.assign(m_bucketCount, {});
+            rebuild();
+        }
+
+        BodyHandle UniformGrid::Insert(const Vector2& center, float radius, uint32_t user)
+        {
+            uint32_t index;
+            if (!m_free.empty()) {
+                index = m_free.back();
+                m_free.pop_back();
+            } else {
+                index = static_cast<uint32_t>(m_bodies.size());
+                m_bodies.emplace_back();
+            }
+            Body& b = m_bodies[index];
+            b.center = center;
+            b.radius = radius;
+            b.user = user;
+            b.alive = true;
+            insertCells(index);
+            return { index, b.generation };
+        }
+
+        void UniformGrid::Update(BodyHandle h, const Vector2& center, float radius)
+        {
+            Body* b = find(h);
+            if (!b) return;
+            int x0, y0, x1, y1;
+            cellRange(center, radius, x0, y0, x1, y1);
+            if (x0 != b->x0 || y0 != b->y0 || x1 != b->x1 || y1 != b->y1) {
+                removeCells(h.index);
+                b->center = center;
+                b->radius = radius;
+                insertCells(h.index);
+            } else {
+                b->center = center;
+                b->radius = radius;
+            }
+        }
+
+        void UniformGrid::Remove(BodyHandle h)
+        {
+            Body* b = find(h);
+            if (!b) return;
+            removeCells(h.index);
+            b->alive = false;
+            ++b->generation;
+            m_free.push_back(h.index);
+        }
+
+        // 物体の枠は残して世代だけ進める（Clear 前のハンドルが再利用後の物体に一致しないように）
+        void UniformGrid::Clear()
+        {
+            for (auto& c : m_cells) c.clear();
+            m_free.clear();
+            for (size_t i = m_bodies.size(); i-- > 0;) {   // 若い番号から再利用する
+                Body& b = m_bodies[i];
+                if (b.alive) {
+                    b.alive = false;
+                    ++b.generation;
+                }
+                m_free.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        Vector2 UniformGrid::Delta(const Vector2& a, const Vector2& b) const
+        {
+            Vector2 d = b - a;
+            if (m_wrap) {
+                d.x -= m_size.x * std::floor(d.x / m_size.x + 0.5f);
+                d.y -= m_size.y * std::floor(d.y / m_size.y + 0.5f);
+            }
+            return d;
+        }
+
+        void UniformGrid::QueryCircle(const Vector2& center, float radius, std::vector<uint32_t>& out) const
+        {
+            // 候補の添字を out に集めて重複を除き、その場で user に置き換える
+            out.clear();
+            int x0, y0, x1, y1;
+            cellRange(center, radius, x0, y0, x1, y1);
+            forEachCell(x0, y0, x1, y1, [&](size_t c) {
+                out.insert(out.end(), m_cells[c].begin(), m_cells[c].end());
+            });
+            std::sort(out.begin(), out.end());
+            out.erase(std::unique(out.begin(), out.end()), out.end());
+
+            size_t w = 0;
+            for (uint32_t index : out)
+                if (overlaps(m_bodies[index], center, radius))
+                    out[w++] = m_bodies[index].user;
+            out.resize(w);
+        }
+
+        void UniformGrid::QueryCircles(const Vector2* centers, const float* radii, float radius, size_t count,
+            std::vector<OverlapHit>& out) const
+        {
+            out.clear();
+            // 物体ごとに「最後に見た問い合わせ」を持てば、複数セルにまたがる物体も 1 回だけ判定する
+            std::vector<uint32_t> seen(m_bodies.size(), ~0u);
+            for (size_t q = 0; q < count; ++q) {
+                const uint32_t query = static_cast<uint32_t>(q);
+                const float r = radii ? radii[q] : radius;
+                int x0, y0, x1, y1;
+                cellRange(centers[q], r, x0, y0, x1, y1);
+                forEachCell(x0, y0, x1, y1, [&](size_t c) {
+                    for (uint32_t index : m_cells[c]) {
+                        if (seen[index] == query) continue;
+                        seen[index] = query;
+                        if (overlaps(m_bodies[index], centers[q], r))
+                            out.push_back({ query, m_bodies[index].user });
+                    }
+                });
+            }
+        }
+
+        void UniformGrid::FindPairs(std::vector<BodyPair>& out) const
+        {
+            out.clear();
+            std::vector<uint32_t> seen(m_bodies.size(), ~0u);
+            for (uint32_t i = 0; i < m_bodies.size(); ++i) {
+                const Body& a = m_bodies[i];
+                if (!a.alive) continue;
+                forEachCell(a.x0, a.y0, a.x1, a.y1, [&](size_t c) {
+                    for (uint32_t j : m_cells[c]) {
+                        if (j <= i || seen[j] == i) continue;   // 組は添字の小さい側からだけ数える
+                        seen[j] = i;
+                        const Body& b = m_bodies[j];
+                        if (overlaps(b, a.center, a.radius))
+                            out.push_back({ std::min(a.user, b.user), std::max(a.user, b.user) });
+                    }
+                });
+            }
+        }
+
+        UniformGrid::Body* UniformGrid::find(BodyHandle h)
+        {
+            if (h.index >= m_bodies.size()) return nullptr;
+            Body& b = m_bodies[h.index];
+            return (b.alive && b.generation == h.generation) ? &b : nullptr;
+        }
+
+        void UniformGrid::cellRange(const Vector2& center, float radius, int& x0, int& y0, int& x1, int& y1) const
+        {
+            x0 = static_cast<int>(std::floor((center.x - radius) * m_invCellX));
+            y0 = static_cast<int>(std::floor((center.y - radius) * m_invCellY));
+            x1 = static_cast<int>(std::floor((center.x + radius) * m_invCellX));
+            y1 = static_cast<int>(std::floor((center.y + radius) * m_invCellY));
+        }
+
+        template<class F>
+        void UniformGrid::forEachCell(int x0, int y0, int x1, int y1, F&& f) const
+        {
+            if (m_wrap) {
+                // 1 周以上にまたがる範囲は 1 周に縮める（同じセルを 2 度見ない）
+                if (x1 - x0 + 1 >= m_cellsX) { x0 = 0; x1 = m_cellsX - 1; }
+                if (y1 - y0 + 1 >= m_cellsY) { y0 = 0; y1 = m_cellsY - 1; }
+            } else if (static_cast<size_t>(x1 - x0 + 1) * static_cast<size_t>(y1 - y0 + 1) >= m_cells.size()) {
+                // 範囲がハッシュ表より広い: 全バケットを 1 回ずつ
+                for (size_t c = 0; c < m_cells.size(); ++c) f(c);
+                return;
+            }
+            for (int y = y0; y <= y1; ++y)
+                for (int x = x0; x <= x1; ++x)
+                    f(cellOf(x, y));
+        }
+
+        void UniformGrid::insertCells(uint32_t index)
+        {
+            Body& b = m_bodies[index];
+            cellRange(b.center, b.radius, b.x0, b.y0, b.x1, b.y1);
+            forEachCell(b.x0, b.y0, b.x1, b.y1, [&](size_t c) {
+                auto& cell = m_cells[c];
+                // ハッシュ衝突で同じバケットに複数回入らないようにする（巻き戻しありなら起きない）
+                if (m_wrap || std::find(cell.begin(), cell.end(), index) == cell.end())
+                    cell.push_back(index);
+            });
+        }
+
+        void UniformGrid::removeCells(uint32_t index)
+        {
+            const Body& b = m_bodies[index];
+            forEachCell(b.x0, b.y0, b.x1, b.y1, [&](size_t c) {
+                auto& cell = m_cells[c];
+                auto it = std::find(cell.begin(), cell.end(), index);
+                if (it != cell.end()) {
+                    *it = cell.back();
+                    cell.pop_back();
+                }
+            });
+        }
+
+        void UniformGrid::rebuild()
+        {
+            for (auto& c : m_cells) c.clear();
+            for (uint32_t i = 0; i < m_bodies.size(); ++i)
+                if (m_bodies[i].alive) insertCells(i);
+        }
+
+        size_t UniformGrid::cellOf(int cx, int cy) const
+        {
+            if (m_wrap) {
+                const int x = ((cx % m_cellsX) + m_cellsX) % m_cellsX;
+                const int y = ((cy % m_cellsY) + m_cellsY) % m_cellsY;
+                return static_cast<size_t>(y) * static_cast<size_t>(m_cellsX) + static_cast<size_t>(x);
+            }
+            const uint32_t h = static_cast<uint32_t>(cx) * 73856093u ^ static_cast<uint32_t>(cy) * 19349663u;
+            return h & (m_cells.size() - 1);
+        }
+
+        bool UniformGrid::overlaps(const Body& b, const Vector2& center, float radius) const
+        {
+            const Vector2 d = Delta(b.center, center);
+            const float r = b.radius + radius;
+            return d.LengthSquared() < r * r;
+        }
+
+    } // namespace Physics
+} // namespace NeonVector
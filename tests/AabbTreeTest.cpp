@@ -0,0 +1,124 @@
+// AabbTree の FindPairs が重なる箱の組を漏らさないこと、RayCast（SweepCircle を test に使う）が
+// 総当たりと同じ最も近い物体を返すこと、Remove / Clear 前のハンドルが無効になることを確かめる。
+
+#include "TestCommon.h"
+#include <NeonVector/Effects/ColliderSweep.h>
+#include <NeonVector/Math/Random.h>
+#include <NeonVector/Physics/AabbTree.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using namespace NeonVector;
+using namespace NeonVector::Physics;
+
+namespace
+{
+    constexpr int kBodies = 1500;
+    constexpr float kWorld = 2000.0f;
+
+    struct Circle
+    {
+        Vector2 center;
+        float radius;
+    };
+
+    void checkPairsAndRays()
+    {
+        Random rng(9);
+        AabbTree tree(4.0f);
+        std::vector<Circle> circles(kBodies);
+        std::vector<BodyHandle> handles(kBodies);
+        for (int i = 0; i < kBodies; ++i)
+        {
+            // 小さい物体に、ときどき大きな物体が混ざる
+            const float r = (i % 10 == 0) ? rng.Range(40.0f, 120.0f) : rng.Range(2.0f, 6.0f);
+            circles[i] = {{rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)}, r};
+            handles[i] = tree.Insert(Aabb::FromCircle(circles[i].center, r), static_cast<uint32_t>(i));
+        }
+        for (int i = 0; i < kBodies; i += 3)
+        {
+            const Vector2 step{rng.Range(-30.0f, 30.0f), rng.Range(-30.0f, 30.0f)};
+            circles[i].center = circles[i].center + step;
+            tree.Move(handles[i], Aabb::FromCircle(circles[i].center, circles[i].radius), step);
+        }
+
+        std::vector<BodyPair> pairs;
+        tree.FindPairs(pairs);
+        std::vector<std::pair<uint32_t, uint32_t>> got;
+        for (const BodyPair &p : pairs)
+            got.push_back({p.a, p.b});
+        std::sort(got.begin(), got.end());
+        NV_CHECK(std::adjacent_find(got.begin(), got.end()) == got.end());
+        size_t overlapping = 0;
+        for (int i = 0; i < kBodies; ++i)
+            for (int j = i + 1; j < kBodies; ++j)
+            {
+                const Aabb a = Aabb::FromCircle(circles[i].center, circles[i].radius);
+                const Aabb b = Aabb::FromCircle(circles[j].center, circles[j].radius);
+                if (!a.Overlaps(b))
+                    continue;
+                ++overlapping;
+                NV_CHECK(std::binary_search(got.begin(), got.end(), std::make_pair(uint32_t(i), uint32_t(j))));
+            }
+        NV_CHECK(overlapping > 0);
+
+        auto test = [&](uint32_t user, const Vector2 &p, const Vector2 &d, float maxT, float &t, Vector2 &n) {
+            const Circle &c = circles[user];
+            return Effects::SweepCircle(p, d, c.center, c.radius, maxT, t, n) != Effects::SweepContact::None;
+        };
+        int hits = 0;
+        for (int k = 0; k < 500; ++k)
+        {
+            const Vector2 from{rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)};
+            const Vector2 to{rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)};
+            RayHit hit;
+            const bool found = tree.RayCast(from, to, test, hit);
+
+            float bestT = 2.0f;
+            for (int i = 0; i < kBodies; ++i)
+            {
+                float t;
+                Vector2 n;
+                if (test(static_cast<uint32_t>(i), from, to - from, 1.0f, t, n))
+                    bestT = std::min(bestT, t);
+            }
+            NV_CHECK(found == (bestT <= 1.0f));
+            if (found)
+            {
+                ++hits;
+                NV_CHECK(std::fabs(hit.t - bestT) < 1e-6f);
+            }
+        }
+        NV_CHECK(hits > 0);
+    }
+
+    void checkStaleHandles()
+    {
+        AabbTree tree;
+        const BodyHandle a = tree.Insert(Aabb::FromCircle({0.0f, 0.0f}, 5.0f), 1);
+        tree.Clear();
+        NV_CHECK(tree.Count() == 0 && tree.Height() == -1);
+        const BodyHandle b = tree.Insert(Aabb::FromCircle({0.0f, 0.0f}, 5.0f), 2);
+        NV_CHECK(b.index == a.index && b.generation != a.generation);
+        tree.Remove(a); // Clear 前のハンドルは再利用後の葉を外さない
+        NV_CHECK(tree.Count() == 1);
+        NV_CHECK(!tree.Move(a, Aabb::FromCircle({500.0f, 500.0f}, 5.0f)));
+
+        tree.Remove(b);
+        const BodyHandle c = tree.Insert(Aabb::FromCircle({0.0f, 0.0f}, 5.0f), 3);
+        NV_CHECK(c.index == b.index && c.generation != b.generation);
+        std::vector<uint32_t> found;
+        tree.QueryAabb(Aabb::FromCircle({0.0f, 0.0f}, 1.0f), found);
+        NV_CHECK(found.size() == 1 && found[0] == 3);
+    }
+}
+
+int main()
+{
+    checkPairsAndRays();
+    checkStaleHandles();
+    return Test::Result("AabbTreeTest");
+}
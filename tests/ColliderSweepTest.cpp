@@ -0,0 +1,110 @@
+// ColliderSweep の SweepCircle / SweepSegment が float と Fixed で同じ判定になることを確かめる。
+// Fixed は Q16.16 の範囲（±32768）を超える 2 乗が出る距離・半径でも偽の当たりを出さないこと。
+
+#include "TestCommon.h"
+#include <NeonVector/Effects/ColliderSweep.h>
+#include <NeonVector/Math/BasicVector2.h>
+#include <NeonVector/Math/Random.h>
+#include <NeonVector/Math/Vector2.h>
+
+#include <cmath>
+
+using namespace NeonVector;
+using namespace NeonVector::Effects;
+
+namespace
+{
+    using FixedVector2 = BasicVector2<Fixed>;
+
+    FixedVector2 toFixed(const Vector2 &v) { return {Fixed::FromFloat(v.x), Fixed::FromFloat(v.y)}; }
+
+    /** @brief float で境界すれすれ（丸めで判定が割れうる）の配置か */
+    bool nearBoundary(const Vector2 &from, const Vector2 &d, const Vector2 &center, float radius)
+    {
+        const Vector2 m = from - center;
+        const float len = d.Length();
+        const float mm = std::sqrt(m.Dot(m));
+        if (std::fabs(mm - radius) < 0.05f)
+            return true;
+        if (len < 1e-3f)
+            return true;
+        const Vector2 u = d * (1.0f / len);
+        const float across = std::fabs(m.Cross(u));
+        const float along = -m.Dot(u);
+        const float h = std::sqrt(std::fabs(radius * radius - across * across));
+        return std::fabs(across - radius) < 0.05f || std::fabs(along) < 0.05f ||
+               std::fabs(along - h - len) < 0.05f || std::fabs(along - h) < 0.05f;
+    }
+}
+
+int main()
+{
+    // 遠く（|m| = 1000）から遠ざかる点: 旧実装は m·m が溢れて Inside を返していた
+    {
+        Fixed t;
+        FixedVector2 n;
+        const SweepContact c = SweepCircle(toFixed({1000.0f, 0.0f}), toFixed({1.0f, 0.0f}), toFixed({0.0f, 0.0f}),
+            Fixed::FromInt(10), Fixed::One(), t, n);
+        NV_CHECK(c == SweepContact::None);
+    }
+    // 半径 300（r^2 が Q16.16 から溢れる）の円の内側・外側
+    {
+        Fixed t;
+        FixedVector2 n;
+        NV_CHECK(SweepCircle(toFixed({250.0f, 0.0f}), toFixed({1.0f, 0.0f}), toFixed({0.0f, 0.0f}),
+            Fixed::FromInt(300), Fixed::One(), t, n) == SweepContact::Inside);
+        NV_CHECK(n.x > Fixed::FromFloat(0.99f));
+        const SweepContact c = SweepCircle(toFixed({-310.0f, 0.0f}), toFixed({20.0f, 0.0f}), toFixed({0.0f, 0.0f}),
+            Fixed::FromInt(300), Fixed::One(), t, n);
+        NV_CHECK(c == SweepContact::Hit);
+        NV_CHECK(std::fabs(t.ToFloat() - 0.5f) < 1e-3f);
+        NV_CHECK(n.x < Fixed::FromFloat(-0.99f));
+    }
+
+    // 乱数の配置で float と Fixed の判定・t が揃うこと
+    Random rng(11);
+    int compared = 0;
+    for (int i = 0; i < 20000; ++i)
+    {
+        const Vector2 center{rng.Range(-2000.0f, 2000.0f), rng.Range(-2000.0f, 2000.0f)};
+        const float radius = rng.Range(1.0f, 400.0f);
+        const float reach = radius + rng.Range(0.0f, 600.0f);
+        const float angle = rng.Range(0.0f, 6.2831853f);
+        const Vector2 from = center + Vector2{std::cos(angle), std::sin(angle)} * reach;
+        const Vector2 d{rng.Range(-300.0f, 300.0f), rng.Range(-300.0f, 300.0f)};
+        if (nearBoundary(from, d, center, radius))
+            continue;
+        ++compared;
+
+        float tf;
+        Vector2 nf;
+        const SweepContact cf = SweepCircle(from, d, center, radius, 1.0f, tf, nf);
+        Fixed tx;
+        FixedVector2 nx;
+        const SweepContact cx = SweepCircle(toFixed(from), toFixed(d), toFixed(center), Fixed::FromFloat(radius),
+            Fixed::One(), tx, nx);
+        NV_CHECK(cf == cx);
+        if (cf == cx && cf == SweepContact::Hit)
+        {
+            NV_CHECK(std::fabs(tf - tx.ToFloat()) < 2e-3f);
+            NV_CHECK(std::fabs(nf.x - nx.x.ToFloat()) < 1e-2f && std::fabs(nf.y - nx.y.ToFloat()) < 1e-2f);
+        }
+    }
+    NV_CHECK(compared > 15000);
+
+    // 線分: 壁を横切る移動
+    {
+        float tf;
+        Vector2 nf;
+        NV_CHECK(SweepSegment(Vector2{0.0f, -5.0f}, Vector2{0.0f, 10.0f}, Vector2{-50.0f, 0.0f}, Vector2{50.0f, 0.0f},
+            1.0f, tf, nf));
+        Fixed tx;
+        FixedVector2 nx;
+        NV_CHECK(SweepSegment(toFixed({0.0f, -5.0f}), toFixed({0.0f, 10.0f}), toFixed({-50.0f, 0.0f}),
+            toFixed({50.0f, 0.0f}), Fixed::One(), tx, nx));
+        NV_CHECK(std::fabs(tf - 0.5f) < 1e-6f && std::fabs(tx.ToFloat() - 0.5f) < 1e-4f);
+        NV_CHECK(nf.y < 0.0f && nx.y < Fixed::Zero());
+    }
+
+    return Test::Result("ColliderSweepTest");
+}
@@ -0,0 +1,116 @@
+// World::Clear がチャンクを溜め込まないこと（Create と Clear を繰り返しても、
+// 生きているチャンクの数が 1 周目から増えない）と、Clear 前の Entity が無効になることを確かめる。
+// チャンクは揃え付きの operator new で確保するので、それを差し替えて生きている数を数える。
+
+#include "TestCommon.h"
+#include <NeonVector/Core/Ecs.h>
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+    long g_alignedLive = 0;
+
+#ifdef _MSC_VER
+    void *alignedAlloc(std::size_t size, std::size_t align) { return _aligned_malloc(size, align); }
+    void alignedFree(void *p) { _aligned_free(p); }
+#else
+    void *alignedAlloc(std::size_t size, std::size_t align) { return std::aligned_alloc(align, (size + align - 1) / align * align); }
+    void alignedFree(void *p) { std::free(p); }
+#endif
+}
+
+void *operator new(std::size_t size, std::align_val_t align)
+{
+    ++g_alignedLive;
+    if (void *p = alignedAlloc(size ? size : 1, static_cast<std::size_t>(align)))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p, std::align_val_t) noexcept
+{
+    --g_alignedLive;
+    alignedFree(p);
+}
+
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept
+{
+    --g_alignedLive;
+    alignedFree(p);
+}
+
+using namespace NeonVector;
+using namespace NeonVector::Ecs;
+
+namespace
+{
+    constexpr int kEntities = 10000;
+    constexpr int kCycles = 50;
+
+    struct Pos
+    {
+        float x, y;
+    };
+    struct Vel
+    {
+        float x, y;
+    };
+
+    /** @brief 末尾以外のチャンクが満杯か */
+    bool chunksPacked(World &world)
+    {
+        size_t first = 0, chunks = 0, partial = 0;
+        world.EachChunk<Pos>([&](size_t count, const Entity *, Pos *) {
+            if (chunks++ == 0)
+                first = count;
+            partial += count != first;
+        });
+        return partial <= 1;
+    }
+}
+
+int main()
+{
+    World world;
+    long liveAfterFirst = -1;
+    Entity stale;
+    for (int cycle = 0; cycle < kCycles; ++cycle)
+    {
+        for (int i = 0; i < kEntities; ++i)
+        {
+            const Entity e = world.Create(Pos{float(i), 0.0f}, Vel{1.0f, 0.0f});
+            if (i == 0 && cycle > 0)
+                NV_CHECK(e.index == stale.index && e != stale);
+            if (i == 0)
+                stale = e;
+        }
+        // 半分を消して末尾から詰めた状態で Clear する周も混ぜる
+        if (cycle % 2)
+        {
+            std::vector<Entity> doomed;
+            world.Each<Pos>([&](Entity e, Pos &) {
+                if (e.index % 2)
+                    doomed.push_back(e);
+            });
+            for (Entity e : doomed)
+                world.Destroy(e);
+        }
+        NV_CHECK(chunksPacked(world));
+        world.Clear();
+        NV_CHECK(world.Count() == 0);
+        NV_CHECK(!world.IsAlive(stale));
+        NV_CHECK(world.Get<Pos>(stale) == nullptr);
+        // アーキタイプ 1 つにつき予備のチャンク 1 つだけが残る
+        NV_CHECK(g_alignedLive <= static_cast<long>(world.ArchetypeCount()));
+        if (cycle == 0)
+            liveAfterFirst = g_alignedLive;
+        NV_CHECK(g_alignedLive == liveAfterFirst);
+    }
+    size_t visited = 0;
+    world.Each<Pos>([&](Pos &) { ++visited; });
+    NV_CHECK(visited == 0);
+    return Test::Result("EcsClearTest");
+}
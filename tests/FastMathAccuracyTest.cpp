@@ -0,0 +1,279 @@
+// FastMath の各関数の誤差が、コメントに書いた精度の段階ごとの上限に収まることを確かめる。
+// 基準は double の標準ライブラリ。配列版がスカラー版とビット単位で一致することも見る。
+
+#include "TestCommon.h"
+#include <NeonVector/Math/FastMath.h>
+#include <NeonVector/Math/Simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace NeonVector;
+using namespace NeonVector::FastMath;
+
+namespace
+{
+    constexpr size_t kCount = 1 << 18;
+
+    // 1/sqrt の段階は初期値の作り方で変わる（FastMath::Rsqrt のコメント参照）
+#if defined(NEONVECTOR_SIMD_SSE)
+    constexpr double kRsqrtAccurateUlp = 4.0;
+    constexpr double kRsqrtFastRel = 3.3e-4;
+    constexpr double kNormalizeAccurateUlp = 5.0;
+#elif defined(NEONVECTOR_SIMD_NEON)
+    constexpr double kRsqrtAccurateUlp = 4.0;
+    constexpr double kRsqrtFastRel = 2.5e-5;
+    constexpr double kNormalizeAccurateUlp = 5.0;
+#else
+    constexpr double kRsqrtAccurateUlp = 80.0;
+    constexpr double kRsqrtFastRel = 1.8e-3;
+    constexpr double kNormalizeAccurateUlp = 80.0;
+#endif
+
+    /** @brief ref を float に丸めた値の 1 ulp を単位にした誤差 */
+    double ulps(float f, double ref)
+    {
+        const float fr = static_cast<float>(ref);
+        const double ulp = (fr == 0.0f) ? std::ldexp(1.0, -149)
+                                        : std::ldexp(1.0, std::max(std::ilogb(fr), -126) - 23);
+        return std::fabs(static_cast<double>(f) - ref) / ulp;
+    }
+
+    /** @brief 最大誤差（ulp / 絶対 / 相対）。相対は |ref| が小さい所を除く */
+    struct MaxError
+    {
+        double ulp = 0.0, abs = 0.0, rel = 0.0;
+
+        void Add(float f, double ref)
+        {
+            ulp = std::max(ulp, ulps(f, ref));
+            const double e = std::fabs(static_cast<double>(f) - ref);
+            abs = std::max(abs, e);
+            if (std::fabs(ref) > 1e-3)
+                rel = std::max(rel, e / std::fabs(ref));
+        }
+
+        void Print(const char *name) const
+        {
+            std::printf("  %-26s %10.2f ulp  abs %.3e  rel %.3e\n", name, ulp, abs, rel);
+        }
+    };
+
+    bool sameBits(const std::vector<float> &a, const std::vector<float> &b)
+    {
+        for (size_t i = 0; i < a.size(); ++i)
+            if (std::memcmp(&a[i], &b[i], sizeof(float)) != 0)
+                return false;
+        return true;
+    }
+
+    void testSinCos(std::mt19937 &rng)
+    {
+        std::vector<float> x(kCount), s(kCount), c(kCount), s1(kCount), c1(kCount);
+
+        // |x| ≤ π: Accurate は 1.6 ulp
+        {
+            std::uniform_real_distribution<float> d(-3.14159265f, 3.14159265f);
+            MaxError e;
+            for (float &v : x)
+                v = d(rng);
+            for (float v : x)
+            {
+                float sv, cv;
+                SinCos<Precision::Accurate>(v, sv, cv);
+                e.Add(sv, std::sin(static_cast<double>(v)));
+                e.Add(cv, std::cos(static_cast<double>(v)));
+            }
+            e.Print("sincos accurate |x|<=pi");
+            NV_CHECK(e.ulp <= 1.6);
+        }
+
+        // |x| ≤ 1e4: Accurate は絶対誤差 1e-7、Fast は 1.5e-5
+        std::uniform_real_distribution<float> d(-1e4f, 1e4f);
+        for (float &v : x)
+            v = d(rng);
+        MaxError accurate, fast;
+        for (float v : x)
+        {
+            float sv, cv;
+            SinCos<Precision::Accurate>(v, sv, cv);
+            accurate.Add(sv, std::sin(static_cast<double>(v)));
+            accurate.Add(cv, std::cos(static_cast<double>(v)));
+            SinCos<Precision::Fast>(v, sv, cv);
+            fast.Add(sv, std::sin(static_cast<double>(v)));
+            fast.Add(cv, std::cos(static_cast<double>(v)));
+        }
+        accurate.Print("sincos accurate |x|<=1e4");
+        fast.Print("sincos fast |x|<=1e4");
+        NV_CHECK(accurate.abs <= 1e-7);
+        NV_CHECK(fast.abs <= 1.5e-5);
+
+#if !defined(NEONVECTOR_SIMD_NEON)
+        SinCos<Precision::Accurate>(x.data(), s.data(), c.data(), kCount);
+        for (size_t i = 0; i < kCount; ++i)
+            SinCos<Precision::Accurate>(x[i], s1[i], c1[i]);
+        NV_CHECK(sameBits(s, s1) && sameBits(c, c1));
+        SinCos<Precision::Fast>(x.data(), s.data(), c.data(), kCount);
+        for (size_t i = 0; i < kCount; ++i)
+            SinCos<Precision::Fast>(x[i], s1[i], c1[i]);
+        NV_CHECK(sameBits(s, s1) && sameBits(c, c1));
+#endif
+    }
+
+    void testAtan2(std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> d(-1000.0f, 1000.0f);
+        std::vector<float> y(kCount), x(kCount), out(kCount), ref(kCount);
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            y[i] = d(rng);
+            x[i] = d(rng);
+        }
+
+        MaxError accurate, fast;
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            const double r = std::atan2(static_cast<double>(y[i]), static_cast<double>(x[i]));
+            accurate.Add(Atan2<Precision::Accurate>(y[i], x[i]), r);
+            fast.Add(Atan2<Precision::Fast>(y[i], x[i]), r);
+        }
+        accurate.Print("atan2 accurate");
+        fast.Print("atan2 fast");
+        NV_CHECK(accurate.ulp <= 3.1);
+        NV_CHECK(fast.abs <= 1.7e-4);
+
+        // 軸上と符号付きゼロは std::atan2 と同じ値・符号
+        const float edges[][2] = {{0.0f, 0.0f}, {0.0f, -0.0f}, {-0.0f, -1.0f}, {5.0f, 0.0f}, {-5.0f, -0.0f}};
+        for (const auto &e : edges)
+        {
+            const float a = Atan2<Precision::Accurate>(e[0], e[1]);
+            const float r = std::atan2(e[0], e[1]);
+            NV_CHECK(std::signbit(a) == std::signbit(r) && std::fabs(a - r) <= 1e-6f);
+        }
+
+#if !defined(NEONVECTOR_SIMD_NEON)
+        Atan2<Precision::Accurate>(y.data(), x.data(), out.data(), kCount);
+        for (size_t i = 0; i < kCount; ++i)
+            ref[i] = Atan2<Precision::Accurate>(y[i], x[i]);
+        NV_CHECK(sameBits(out, ref));
+#endif
+    }
+
+    void testExp2(std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> d(-126.0f, 127.0f);
+        std::vector<float> x(kCount), out(kCount), ref(kCount);
+        for (float &v : x)
+            v = d(rng);
+
+        MaxError accurate, fast;
+        for (float v : x)
+        {
+            const double r = std::exp2(static_cast<double>(v));
+            accurate.Add(Exp2<Precision::Accurate>(v), r);
+            fast.Add(Exp2<Precision::Fast>(v), r);
+        }
+        accurate.Print("exp2 accurate");
+        fast.Print("exp2 fast");
+        NV_CHECK(accurate.ulp <= 1.2);
+        NV_CHECK(fast.rel <= 1.1e-4);
+
+#if !defined(NEONVECTOR_SIMD_NEON)
+        Exp2<Precision::Accurate>(x.data(), out.data(), kCount);
+        for (size_t i = 0; i < kCount; ++i)
+            ref[i] = Exp2<Precision::Accurate>(x[i]);
+        NV_CHECK(sameBits(out, ref));
+#endif
+    }
+
+    void testConstPow(std::mt19937 &rng)
+    {
+        const ConstPow drag(0.98f), ten(10.0f);
+        std::uniform_real_distribution<float> dt(0.0f, 1.0f / 15.0f), y(-5.0f, 5.0f);
+        MaxError dragErr, tenErr;
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            const float t = dt(rng), e = y(rng);
+            dragErr.Add(drag.Eval<Precision::Accurate>(t), std::pow(0.98, static_cast<double>(t)));
+            tenErr.Add(ten.Eval<Precision::Accurate>(e), std::pow(10.0, static_cast<double>(e)));
+        }
+        dragErr.Print("pow 0.98^dt accurate");
+        tenErr.Print("pow 10^y accurate");
+        NV_CHECK(dragErr.ulp <= 0.6);
+        NV_CHECK(tenErr.ulp <= 16.0);
+    }
+
+    void testRsqrt(std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> d(-30.0f, 30.0f);
+        std::vector<float> x(kCount), out(kCount), ref(kCount);
+        for (float &v : x)
+            v = std::exp2(d(rng));
+
+        MaxError accurate, fast;
+        for (float v : x)
+        {
+            const double r = 1.0 / std::sqrt(static_cast<double>(v));
+            accurate.Add(Rsqrt<Precision::Accurate>(v), r);
+            fast.Add(Rsqrt<Precision::Fast>(v), r);
+        }
+        accurate.Print("rsqrt accurate");
+        fast.Print("rsqrt fast");
+        NV_CHECK(accurate.ulp <= kRsqrtAccurateUlp);
+        NV_CHECK(fast.rel <= kRsqrtFastRel);
+
+#if !defined(NEONVECTOR_SIMD_NEON)
+        Rsqrt<Precision::Accurate>(x.data(), out.data(), kCount);
+        for (size_t i = 0; i < kCount; ++i)
+            ref[i] = Rsqrt<Precision::Accurate>(x[i]);
+        NV_CHECK(sameBits(out, ref));
+#endif
+    }
+
+    void testNormalize(std::mt19937 &rng)
+    {
+        std::uniform_real_distribution<float> d(-1000.0f, 1000.0f);
+        std::vector<Vector2> v(kCount / 2), out(kCount / 2);
+        for (Vector2 &p : v)
+            p = {d(rng), d(rng)};
+        v[3] = {0.0f, 0.0f};
+
+        MaxError accurate, fast;
+        for (const Vector2 &p : v)
+        {
+            const double len = std::hypot(static_cast<double>(p.x), static_cast<double>(p.y));
+            if (len < 1e-19)
+                continue;
+            Vector2 q = Normalize<Precision::Accurate>(p);
+            accurate.Add(q.x, p.x / len);
+            accurate.Add(q.y, p.y / len);
+            q = Normalize<Precision::Fast>(p);
+            fast.Add(q.x, p.x / len);
+            fast.Add(q.y, p.y / len);
+        }
+        accurate.Print("normalize accurate");
+        fast.Print("normalize fast");
+        NV_CHECK(accurate.ulp <= kNormalizeAccurateUlp);
+        NV_CHECK(fast.abs <= kRsqrtFastRel);
+
+        // 長さ 0 はそのまま返す
+        Normalize<Precision::Accurate>(v.data(), out.data(), v.size());
+        NV_CHECK(out[3].x == 0.0f && out[3].y == 0.0f);
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(7);
+    testSinCos(rng);
+    testAtan2(rng);
+    testExp2(rng);
+    testConstPow(rng);
+    testRsqrt(rng);
+    testNormalize(rng);
+    return Test::Result("FastMathAccuracyTest");
+}
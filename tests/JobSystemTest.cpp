@@ -0,0 +1,93 @@
+// JobSystem::ParallelFor が各添字を 1 回ずつ、常に grain 個ずつのチャンクで渡すこと
+// （ワーカーなし・属さないスレッドから・入れ子でも同じ）と、ジョブの枠が少なくても
+// 溢れた分をその場で実行して全て終えることを確かめる。
+
+#include "TestCommon.h"
+#include <NeonVector/Core/JobSystem.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NeonVector;
+
+namespace
+{
+    /** @brief [0, count) を grain で区切ったチャンクだけが、それぞれ 1 回ずつ渡されたか */
+    bool coversByChunks(JobSystem &jobs, size_t count, size_t grain)
+    {
+        std::vector<std::atomic<int>> hits(count);
+        std::atomic<bool> misaligned{false};
+        jobs.ParallelFor(count, grain, [&](size_t b, size_t e) {
+            if (b % grain != 0 || e != std::min(count, b + grain))
+                misaligned = true;
+            for (size_t i = b; i < e; ++i)
+                hits[i].fetch_add(1, std::memory_order_relaxed);
+        });
+        for (const std::atomic<int> &h : hits)
+            if (h.load() != 1)
+                return false;
+        return !misaligned;
+    }
+
+    long fib(JobSystem &jobs, int n)
+    {
+        if (n < 2)
+            return n;
+        long a = 0;
+        JobCounter counter;
+        jobs.Spawn(counter, [&jobs, n, &a] { a = fib(jobs, n - 1); });
+        const long b = fib(jobs, n - 2);
+        jobs.Wait(counter);
+        return a + b;
+    }
+
+    void check(JobSystem &jobs)
+    {
+        NV_CHECK(coversByChunks(jobs, 100003, 1000));
+        NV_CHECK(coversByChunks(jobs, 999, 1000));   // チャンク 1 つ
+        NV_CHECK(coversByChunks(jobs, 64, 1));
+
+        // JobSystem に属さないスレッドから呼んでも区切りは同じ
+        bool outside = false;
+        std::thread([&] { outside = coversByChunks(jobs, 10000, 300); }).join();
+        NV_CHECK(outside);
+
+        // 入れ子
+        std::vector<std::atomic<int>> inner(64 * 1000);
+        jobs.ParallelFor(64, 1, [&](size_t k, size_t) {
+            jobs.ParallelFor(1000, 10, [&](size_t b, size_t e) {
+                for (size_t i = b; i < e; ++i)
+                    inner[k * 1000 + i].fetch_add(1, std::memory_order_relaxed);
+            });
+        });
+        bool once = true;
+        for (const std::atomic<int> &h : inner)
+            once = once && h.load() == 1;
+        NV_CHECK(once);
+
+        NV_CHECK(fib(jobs, 18) == 2584);
+    }
+}
+
+int main()
+{
+    JobSystem serial(0);
+    check(serial);
+    JobSystem parallel(3);
+    check(parallel);
+    // 同じスレッドで別の JobSystem を作って壊しても、元の JobSystem の 0 番に戻る
+    {
+        JobSystem inner(1);
+        NV_CHECK(inner.GetWorkerIndex() == 0);
+        NV_CHECK(parallel.GetWorkerIndex() == ~0u);
+        NV_CHECK(coversByChunks(parallel, 10000, 300));
+    }
+    NV_CHECK(parallel.GetWorkerIndex() == 0);
+    check(parallel);
+    // 枠が 4 つしかなくても（溢れた分はその場で実行して）全て終わる
+    JobSystem tiny(3, 4);
+    check(tiny);
+    return Test::Result("JobSystemTest");
+}
@@ -0,0 +1,112 @@
+// 決定論モードの ParticleSystem が、ワーカー数（0 / 1 / 3 / 7）によらずビット単位で同じ頂点を描くことを確かめる。
+// コライダ・力場・サブエミッタ・エミッタを全て有効にし、粒子数は並列 Update の固定チャンク（4096）を
+// 複数またぎ、かつ LineBatcher 1 回分（10000 本）に収まるようにする。
+
+#include "TestCommon.h"
+#include <NeonVector/Core/JobSystem.h>
+#include <NeonVector/Effects/ParticleColliders.h>
+#include <NeonVector/Effects/ParticleSystem.h>
+#include <NeonVector/Graphics/LineBatcher.h>
+#include <NeonVector/Math/Random.h>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace NeonVector;
+
+namespace
+{
+    constexpr int kFrames = 120;
+    constexpr size_t kCapacity = 9500;
+
+    /** @brief FNV-1a でバイト列を畳む */
+    uint64_t hashBytes(uint64_t h, const void *data, size_t size)
+    {
+        const unsigned char *p = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            h ^= p[i];
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+    /** @brief 全フレームの Draw の頂点をつないだハッシュと、粒子数の最大 */
+    uint64_t simulate(JobSystem *jobs, const Effects::ParticleColliders &colliders, size_t &peak)
+    {
+        Effects::ParticleSystem ps;
+        ps.SetSeed(7);
+        ps.SetDeterministic(true);
+        ps.SetJobSystem(jobs);
+        ps.SetCapacity(kCapacity, Effects::OverflowPolicy::ReplaceOldest);
+        ps.SetColliders(&colliders);
+        ps.SetGravity(40.0f);
+        ps.SetDrag(0.8f);
+
+        ps.AddAffector(Effects::Affector::Vortex({500.0f, 500.0f}, 300.0f, 200.0f));
+        ps.AddAffector(Effects::Affector::Attractor({200.0f, 800.0f}, 250.0f, -150.0f));
+        ps.AddAffector(Effects::Affector::Turbulence(80.0f, 0.01f));
+
+        Effects::SubEmitterDesc onHit;
+        onHit.trigger = Effects::SubEmitterTrigger::Collision;
+        onHit.count = 2;
+        onHit.probability = 0.5f;
+        ps.AddSubEmitter(onHit);
+        Effects::SubEmitterDesc onDeath;
+        onDeath.count = 3;
+        onDeath.inheritColor = true;
+        ps.AddSubEmitter(onDeath);
+
+        Effects::EmitterDesc fountain;
+        fountain.shape = Effects::EmitterShape::Cone;
+        fountain.rate = 3000.0f;
+        fountain.direction = -1.57f;
+        fountain.spread = 0.8f;
+        fountain.bursts.push_back({0.5f, 1500, 0, 0.5f});
+        ps.AddEmitter(fountain, {500.0f, 900.0f});
+
+        Random rng(9);
+        for (int i = 0; i < 8; ++i)
+            ps.Emit({rng.Range(0.0f, 1000.0f), rng.Range(0.0f, 1000.0f)}, 1000, 50.0f, 300.0f, Color::Cyan, 1.0f);
+
+        Graphics::LineBatcher batcher;
+        uint64_t h = 1469598103934665603ull;
+        peak = 0;
+        for (int f = 0; f < kFrames; ++f)
+        {
+            ps.Update(1.0f / 60.0f);
+            peak = std::max(peak, ps.Count());
+            ps.Draw(&batcher);
+            h = hashBytes(h, batcher.GetVertices(), batcher.GetLineCount() * 2 * sizeof(Graphics::LineVertex));
+            batcher.Clear();
+        }
+        return h;
+    }
+}
+
+int main()
+{
+    Effects::ParticleColliders colliders(64.0f);
+    Random rng(5);
+    for (int i = 0; i < 150; ++i)
+        colliders.AddCircle({rng.Range(0.0f, 1000.0f), rng.Range(0.0f, 1000.0f)}, rng.Range(5.0f, 30.0f),
+                            Effects::CollisionResponse::Bounce);
+    for (int i = 0; i < 50; ++i)
+    {
+        const Vector2 a{rng.Range(0.0f, 1000.0f), rng.Range(0.0f, 1000.0f)};
+        colliders.AddSegment(a, a + Vector2{rng.Range(-60.0f, 60.0f), rng.Range(-60.0f, 60.0f)},
+                             i % 5 ? Effects::CollisionResponse::Slide : Effects::CollisionResponse::Kill);
+    }
+
+    size_t peak = 0;
+    const uint64_t serial = simulate(nullptr, colliders, peak);
+    NV_CHECK(peak > 4096 * 2); // 3 チャンク以上に分かれている
+    for (unsigned workers : {0u, 1u, 3u, 7u})
+    {
+        JobSystem jobs(workers);
+        size_t p = 0;
+        NV_CHECK(simulate(&jobs, colliders, p) == serial);
+        NV_CHECK(p == peak);
+    }
+    return Test::Result("ParticleDeterminismTest");
+}
@@ -0,0 +1,65 @@
+// ParticleSystem のプールモード（SetCapacity）が、温まった後はヒープ確保をしないことを確かめる。
+// グローバルの operator new を差し替えて数える。
+
+#include "TestCommon.h"
+#include <NeonVector/Effects/ParticleSystem.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<size_t> g_allocations{0};
+}
+
+void *operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+using namespace NeonVector;
+
+namespace
+{
+    constexpr int kFrames = 10000;
+    constexpr int kWarmupFrames = 60;
+
+    /** @brief 容量を常に超える放出を続け、温まった後の確保回数を返す */
+    size_t churn(Effects::OverflowPolicy policy)
+    {
+        Effects::ParticleSystem ps;
+        ps.SetSeed(42);
+        ps.SetCapacity(2048, policy);
+        ps.SetGravity(60.0f);
+        ps.SetDrag(0.5f);
+
+        size_t before = 0;
+        for (int frame = 0; frame < kFrames; ++frame)
+        {
+            if (frame == kWarmupFrames)
+                before = g_allocations.load();
+            // 毎フレームの小さな噴射と、ときどき容量を溢れさせる爆発
+            ps.Emit({640.0f, 360.0f}, 24, 40.0f, 200.0f, Color{1.0f, 0.6f, 0.2f, 1.0f}, 0.8f);
+            if (frame % 90 == 0)
+                ps.Emit({320.0f, 200.0f}, 3000, 60.0f, 400.0f, Color{0.4f, 0.9f, 1.0f, 1.0f}, 1.5f);
+            ps.Update(1.0f / 60.0f);
+            NV_CHECK(ps.Count() <= ps.Capacity());
+        }
+        return g_allocations.load() - before;
+    }
+}
+
+int main()
+{
+    NV_CHECK(churn(Effects::OverflowPolicy::DropNew) == 0);
+    NV_CHECK(churn(Effects::OverflowPolicy::ReplaceOldest) == 0);
+    NV_CHECK(churn(Effects::OverflowPolicy::ReplaceDimmest) == 0);
+    return Test::Result("ParticlePoolAllocTest");
+}
@@ -0,0 +1,202 @@
+// Pool を乱択の操作列で std::map の参照実装と突き合わせる（Create / Destroy / DestroyDeferred /
+// FlushDeferred / Clear）。あわせて、コンストラクタが投げたときにプールが変わらないこと、
+// Reserve の後は破棄の予約も含めて確保しないことを確かめる。
+
+#include "TestCommon.h"
+#include <NeonVector/Core/Pool.h>
+#include <NeonVector/Math/Random.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::atomic<size_t> g_allocations{0};
+}
+
+void *operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+using namespace NeonVector;
+
+namespace
+{
+    using StringPool = Pool<std::string>;
+
+    /** @brief 生きている要素が参照実装と一致し、密な配列とハンドルが対応しているか */
+    bool matches(const StringPool &pool, const std::map<uint32_t, std::pair<StringPool::Handle, std::string>> &ref)
+    {
+        if (pool.Size() != ref.size())
+            return false;
+        for (const auto &[index, entry] : ref)
+        {
+            const std::string *v = pool.Get(entry.first);
+            if (!v || *v != entry.second)
+                return false;
+        }
+        for (size_t i = 0; i < pool.Size(); ++i)
+            if (pool.Get(pool.HandleAt(i)) != &pool[i])
+                return false;
+        return true;
+    }
+
+    void checkAgainstReference()
+    {
+        StringPool pool;
+        std::map<uint32_t, std::pair<StringPool::Handle, std::string>> ref; // スロット → 生きている要素
+        std::vector<StringPool::Handle> issued;
+        std::vector<StringPool::Handle> deferred;
+        Random rng(3);
+        int mismatches = 0;
+
+        auto isLive = [&](StringPool::Handle h) {
+            const auto it = ref.find(h.index);
+            return it != ref.end() && it->second.first == h;
+        };
+        for (int step = 0; step < 200000; ++step)
+        {
+            const uint32_t op = rng.NextU32() % 10;
+            if (op < 4 || issued.empty())
+            {
+                const std::string v = "s" + std::to_string(step);
+                const StringPool::Handle h = pool.Create(v);
+                NV_CHECK(!isLive(h));
+                issued.push_back(h);
+                ref[h.index] = {h, v};
+                continue;
+            }
+            const StringPool::Handle h = issued[rng.NextU32() % issued.size()];
+            mismatches += pool.IsAlive(h) != isLive(h);
+            if (op < 6)
+            {
+                pool.Destroy(h);
+                if (isLive(h))
+                    ref.erase(h.index);
+            }
+            else if (op < 8)
+            {
+                // 重ねて予約しても 1 回。Flush までは生きている
+                pool.DestroyDeferred(h);
+                pool.DestroyDeferred(h);
+                if (isLive(h))
+                {
+                    NV_CHECK(pool.IsPendingDestroy(h));
+                    deferred.push_back(h);
+                }
+            }
+            else if (op == 8)
+            {
+                pool.FlushDeferred();
+                for (StringPool::Handle d : deferred)
+                    if (isLive(d))
+                        ref.erase(d.index);
+                deferred.clear();
+                mismatches += !matches(pool, ref);
+            }
+            else if (rng.NextU32() % 1000 == 0)
+            {
+                pool.Clear();
+                ref.clear();
+                deferred.clear();
+            }
+        }
+        NV_CHECK(mismatches == 0);
+        NV_CHECK(matches(pool, ref));
+
+        pool.Clear();
+        NV_CHECK(pool.Empty());
+        bool anyAlive = false;
+        for (StringPool::Handle h : issued)
+            anyAlive = anyAlive || pool.IsAlive(h);
+        NV_CHECK(!anyAlive);
+    }
+
+    struct Throwing
+    {
+        int value;
+        explicit Throwing(int v) : value(v)
+        {
+            if (v < 0)
+                throw std::runtime_error("negative");
+        }
+    };
+
+    /** @brief Create(-1) が投げ、プールの中身が変わらなかったか */
+    bool createThrows(Pool<Throwing> &pool, size_t size)
+    {
+        bool threw = false;
+        try
+        {
+            pool.Create(-1);
+        }
+        catch (const std::runtime_error &)
+        {
+            threw = true;
+        }
+        return threw && pool.Size() == size;
+    }
+
+    void checkThrowingConstructor()
+    {
+        Pool<Throwing> pool;
+        const Pool<Throwing>::Handle a = pool.Create(1);
+        const Pool<Throwing>::Handle freed = pool.Create(2);
+        pool.Destroy(freed);
+
+        // 空きスロットを使う場合: スロットは空きのまま残り、次の Create が使う
+        NV_CHECK(createThrows(pool, 1));
+        const Pool<Throwing>::Handle b = pool.Create(3);
+        NV_CHECK(b.index == freed.index && !pool.IsAlive(freed));
+
+        // 新しいスロットを足す場合: スロットは増えない
+        NV_CHECK(createThrows(pool, 2));
+        const Pool<Throwing>::Handle c = pool.Create(4);
+        NV_CHECK(c.index == 2);
+
+        NV_CHECK(pool.Size() == 3);
+        NV_CHECK(pool.Get(a) && pool.Get(a)->value == 1);
+        NV_CHECK(pool.Get(b) && pool.Get(b)->value == 3);
+        NV_CHECK(pool.Get(c) && pool.Get(c)->value == 4);
+        for (size_t i = 0; i < pool.Size(); ++i)
+            NV_CHECK(pool.Get(pool.HandleAt(i)) == &pool[i]);
+    }
+
+    void checkReserveCoversDeferred()
+    {
+        constexpr int kCount = 4096;
+        Pool<int> pool;
+        pool.Reserve(kCount);
+        const size_t before = g_allocations.load();
+        for (int round = 0; round < 3; ++round)
+        {
+            for (int i = 0; i < kCount; ++i)
+                pool.Create(i);
+            for (size_t i = 0; i < pool.Size(); ++i)
+                pool.DestroyDeferred(pool.HandleAt(i));
+            pool.FlushDeferred();
+        }
+        NV_CHECK(pool.Empty());
+        NV_CHECK(g_allocations.load() == before);
+    }
+}
+
+int main()
+{
+    checkAgainstReference();
+    checkThrowingConstructor();
+    checkReserveCoversDeferred();
+    return Test::Result("PoolTest");
+}
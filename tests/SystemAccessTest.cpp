@@ -0,0 +1,69 @@
+// SystemAccess の衝突判定と、データの型の ID が ECS のコンポーネント ID と独立していることを確かめる
+// （ムーブできない型も書け、64 を超える型を区別でき、ECS の型の表を消費しない）。
+
+#include "TestCommon.h"
+#include <NeonVector/Core/Ecs.h>
+#include <NeonVector/Core/SystemScheduler.h>
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace NeonVector;
+
+namespace
+{
+    struct Pos
+    {
+        float x, y;
+    };
+
+    /** @brief ムーブもコピーもできないデータ（ECS のコンポーネントにはなれない） */
+    struct Registry
+    {
+        std::mutex mutex;
+    };
+
+    template <int N>
+    struct Tag
+    {
+    };
+
+    template <int... Ns>
+    SystemAccess writeTags(std::integer_sequence<int, Ns...>)
+    {
+        return SystemAccess().Write<Tag<Ns>...>();
+    }
+}
+
+int main()
+{
+    // ECS より先に SystemAccess で型を使っても、コンポーネント ID は 0 から振られる
+    const SystemAccess readRegistry = SystemAccess().Read<Registry, const Pos>();
+    NV_CHECK(Ecs::ComponentTypeId<Pos>() == 0);
+
+    const SystemAccess writePos = SystemAccess().Write<Pos>();
+    const SystemAccess readPos = SystemAccess().Read<Pos>();
+    const SystemAccess writeRegistry = SystemAccess().Write<Registry>();
+    NV_CHECK(writePos.ConflictsWith(readRegistry));
+    NV_CHECK(readRegistry.ConflictsWith(writePos));
+    NV_CHECK(!readPos.ConflictsWith(readRegistry));
+    NV_CHECK(writeRegistry.ConflictsWith(readRegistry));
+    NV_CHECK(!writeRegistry.ConflictsWith(writePos));
+
+    // 64 を超える型を使っても、最後の型まで区別できる
+    const SystemAccess many = writeTags(std::make_integer_sequence<int, 100>());
+    NV_CHECK(many.writes.count() == 100);
+    NV_CHECK(many.ConflictsWith(SystemAccess().Read<Tag<99>>()));
+    NV_CHECK(!many.ConflictsWith(SystemAccess().Read<Tag<100>>()));
+    NV_CHECK(!many.ConflictsWith(readPos));
+
+    // 衝突する組は登録順に走る（JobSystem なしの直列実行）
+    SystemScheduler scheduler;
+    std::vector<int> order;
+    scheduler.Add("write", writeRegistry, [&](float) { order.push_back(0); });
+    scheduler.Add("read", readRegistry, [&](float) { order.push_back(1); });
+    scheduler.Run(0.0f);
+    NV_CHECK((order == std::vector<int>{0, 1}));
+    return Test::Result("SystemAccessTest");
+}
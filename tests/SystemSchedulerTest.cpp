@@ -0,0 +1,171 @@
+// SystemScheduler を複数ワーカーの JobSystem で何度も回し、衝突するシステムは毎回登録順に
+// 前のものが終わってから始まること、衝突しないシステムは同時に走れること、GetLastTrace /
+// FormatTraceJson の after が宣言した読み書きの衝突と一致することを確かめる。
+// 途中のフレームでシステムを無効にし、グラフの組み直しも通す。
+
+#include "TestCommon.h"
+#include <NeonVector/Core/JobSystem.h>
+#include <NeonVector/Core/SystemScheduler.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NeonVector;
+
+namespace
+{
+    constexpr int kFrames = 200;
+
+    struct Spawns
+    {
+    };
+    struct PosX
+    {
+    };
+    struct PosY
+    {
+    };
+    struct Contacts
+    {
+    };
+    struct Audio
+    {
+    };
+
+    /** @brief 1 システムの開始・終了の通し番号（フレーム毎に振り直す） */
+    struct Stamp
+    {
+        std::atomic<int> begin{-1};
+        std::atomic<int> end{-1};
+    };
+
+    /**
+     * @brief 衝突しない 2 システムが、互いの開始を待ち合わせられたか（直列化されていたら時間切れになる）
+     *
+     * 一度でも時間切れになったら以後は待たない（失敗が分かった後にフレーム数だけ待ち続けない）。
+     */
+    struct Rendezvous
+    {
+        std::atomic<int> arrived{0};
+        std::atomic<int> met{0};
+        std::atomic<bool> gaveUp{false};
+
+        void Arrive()
+        {
+            arrived.fetch_add(1);
+            const auto limit = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while (arrived.load() < 2 && !gaveUp.load() && std::chrono::steady_clock::now() < limit)
+                std::this_thread::yield();
+            if (arrived.load() >= 2)
+                met.fetch_add(1);
+            else
+                gaveUp = true;
+        }
+    };
+
+    /** @brief JSON の中で name のイベントの after 配列を取り出す（見つからなければ "?"） */
+    std::string afterOf(const std::string &json, const std::string &name)
+    {
+        const size_t at = json.find("{\"name\":\"" + name + "\"");
+        if (at == std::string::npos)
+            return "?";
+        const size_t open = json.find("\"after\":[", at);
+        const size_t close = json.find(']', open);
+        if (open == std::string::npos || close == std::string::npos)
+            return "?";
+        const size_t first = open + 9;
+        return json.substr(first, close - first);
+    }
+}
+
+int main()
+{
+    JobSystem jobs(3);
+    SystemScheduler scheduler(&jobs);
+
+    const std::vector<std::string> names = {"spawn", "moveX", "moveY", "collide", "audio", "render", "ui", "mixer"};
+    const std::vector<SystemAccess> access = {
+        SystemAccess().Write<Spawns>(),
+        SystemAccess().Read<Spawns>().Write<PosX>(),
+        SystemAccess().Read<Spawns>().Write<PosY>(),
+        SystemAccess().Read<PosX, PosY>().Write<Contacts>(),
+        SystemAccess().Write<Audio>(),
+        SystemAccess().Read<Spawns, PosX, PosY, Contacts>(),
+        SystemAccess().Read<Audio, Contacts>(),
+        SystemAccess().Write<Audio>(),
+    };
+    const size_t n = names.size();
+    constexpr uint32_t kMoveX = 1, kMoveY = 2, kCollide = 3;
+
+    std::vector<Stamp> stamps(n);
+    std::atomic<int> clock{0};
+    Rendezvous rendezvous;
+    for (uint32_t s = 0; s < n; ++s)
+    {
+        scheduler.Add(names[s], access[s], [&, s](float) {
+            stamps[s].begin = clock.fetch_add(1);
+            if (s == kMoveX || s == kMoveY)
+                rendezvous.Arrive(); // moveX と moveY は衝突しないので、同時に走れるはず
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            stamps[s].end = clock.fetch_add(1);
+        });
+    }
+
+    bool orderOk = true, traceOk = true, jsonOk = true, ranAll = true;
+    for (int frame = 0; frame < kFrames; ++frame)
+    {
+        // 3 フレームに 1 回 collide を外す（render / ui の先行が変わる）
+        const bool collideOn = frame % 3 != 0;
+        scheduler.SetEnabled(kCollide, collideOn);
+        for (Stamp &st : stamps)
+            st.begin = st.end = -1;
+        clock = 0;
+        rendezvous.arrived = 0;
+
+        scheduler.Run(1.0f / 60.0f);
+
+        for (uint32_t s = 0; s < n; ++s)
+        {
+            const bool enabled = s != kCollide || collideOn;
+            ranAll = ranAll && ((stamps[s].end >= 0) == enabled);
+        }
+
+        // 衝突する組は、登録の早い方が終わってから遅い方が始まる
+        for (uint32_t j = 0; j < n; ++j)
+            for (uint32_t i = 0; i < j; ++i)
+                if (scheduler.IsEnabled(i) && scheduler.IsEnabled(j) && access[i].ConflictsWith(access[j]))
+                    orderOk = orderOk && stamps[i].end < stamps[j].begin;
+
+        // after は、有効で衝突する先の登録のシステムちょうど（登録順）
+        const std::vector<SystemTraceEvent> &trace = scheduler.GetLastTrace();
+        const std::string json = scheduler.FormatTraceJson();
+        traceOk = traceOk && trace.size() == (collideOn ? n : n - 1);
+        for (const SystemTraceEvent &ev : trace)
+        {
+            std::vector<uint32_t> expected;
+            std::string expectedJson;
+            for (uint32_t i = 0; i < ev.system; ++i)
+            {
+                if (!scheduler.IsEnabled(i) || !access[i].ConflictsWith(access[ev.system]))
+                    continue;
+                expected.push_back(i);
+                expectedJson += (expectedJson.empty() ? "\"" : ",\"") + names[i] + "\"";
+            }
+            traceOk = traceOk && ev.after == expected;
+            for (uint32_t p : ev.after)
+                traceOk = traceOk && stamps[p].end < stamps[ev.system].begin;
+            jsonOk = jsonOk && afterOf(json, names[ev.system]) == expectedJson;
+        }
+    }
+
+    NV_CHECK(ranAll);
+    NV_CHECK(orderOk);
+    NV_CHECK(traceOk);
+    NV_CHECK(jsonOk);
+    NV_CHECK(rendezvous.met.load() == 2 * kFrames);
+    return Test::Result("SystemSchedulerTest");
+}
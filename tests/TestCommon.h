@@ -0,0 +1,38 @@
+/**
+ * @file TestCommon.h
+ * @brief テスト用の最小限のチェックマクロ（各テストは失敗数を終了コードにして返す）
+ */
+#pragma once
+
+#include <cstdio>
+
+namespace NeonVector
+{
+    namespace Test
+    {
+        inline int &FailureCount()
+        {
+            static int count = 0;
+            return count;
+        }
+
+        /** @brief main の最後に返す（失敗が無ければ 0） */
+        inline int Result(const char *name)
+        {
+            const int failures = FailureCount();
+            std::printf("%s: %s (%d failure%s)\n", name, failures ? "FAILED" : "passed", failures, failures == 1 ? "" : "s");
+            return failures ? 1 : 0;
+        }
+    }
+}
+
+/** @brief 失敗しても続ける（1 回の実行で全ての失敗を出す） */
+#define NV_CHECK(cond)                                                                  \
+    do                                                                                  \
+    {                                                                                   \
+        if (!(cond))                                                                    \
+        {                                                                               \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++::NeonVector::Test::FailureCount();                                       \
+        }                                                                               \
+    } while (0)
@@ -0,0 +1,126 @@
+// UniformGrid の FindPairs / QueryCircles が総当たりと同じ組を返すこと（巻き戻しの有無とも）、
+// Remove / Clear 前のハンドルが再利用後の物体に一致しないことを確かめる。
+
+#include "TestCommon.h"
+#include <NeonVector/Math/Random.h>
+#include <NeonVector/Physics/UniformGrid.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using namespace NeonVector;
+using namespace NeonVector::Physics;
+
+namespace
+{
+    constexpr int kBodies = 1500;
+    constexpr float kWorld = 1000.0f;
+
+    using PairList = std::vector<std::pair<uint32_t, uint32_t>>;
+
+    PairList sorted(const std::vector<BodyPair> &pairs)
+    {
+        PairList out;
+        for (const BodyPair &p : pairs)
+            out.push_back({p.a, p.b});
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    void checkAgainstBruteForce(bool wrap)
+    {
+        Random rng(wrap ? 11 : 3);
+        UniformGrid grid(32.0f, 1024);
+        if (wrap)
+            grid.SetWrap({kWorld, kWorld});
+
+        std::vector<Vector2> centers(kBodies);
+        std::vector<float> radii(kBodies);
+        std::vector<BodyHandle> handles(kBodies);
+        for (int i = 0; i < kBodies; ++i)
+        {
+            centers[i] = {rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)};
+            radii[i] = rng.Range(2.0f, 20.0f);
+            handles[i] = grid.Insert(centers[i], radii[i], static_cast<uint32_t>(i));
+        }
+
+        // 半分を動かしてから比べる（付け替えの経路も通す）
+        for (int i = 0; i < kBodies; i += 2)
+        {
+            centers[i] = {rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)};
+            grid.Update(handles[i], centers[i], radii[i]);
+        }
+
+        PairList expected;
+        for (int i = 0; i < kBodies; ++i)
+            for (int j = i + 1; j < kBodies; ++j)
+            {
+                const float r = radii[i] + radii[j];
+                if (grid.Delta(centers[i], centers[j]).LengthSquared() < r * r)
+                    expected.push_back({static_cast<uint32_t>(i), static_cast<uint32_t>(j)});
+            }
+        std::vector<BodyPair> pairs;
+        grid.FindPairs(pairs);
+        NV_CHECK(!expected.empty());
+        NV_CHECK(sorted(pairs) == expected);
+
+        std::vector<Vector2> queries(200);
+        for (Vector2 &q : queries)
+            q = {rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)};
+        PairList expectedHits;
+        for (size_t q = 0; q < queries.size(); ++q)
+            for (int i = 0; i < kBodies; ++i)
+            {
+                const float r = radii[i] + 8.0f;
+                if (grid.Delta(queries[q], centers[i]).LengthSquared() < r * r)
+                    expectedHits.push_back({static_cast<uint32_t>(q), static_cast<uint32_t>(i)});
+            }
+        std::vector<OverlapHit> hits;
+        grid.QueryCircles(queries.data(), nullptr, 8.0f, queries.size(), hits);
+        PairList gotHits;
+        for (const OverlapHit &h : hits)
+            gotHits.push_back({h.query, h.user});
+        std::sort(gotHits.begin(), gotHits.end());
+        NV_CHECK(gotHits == expectedHits);
+    }
+
+    void checkStaleHandles()
+    {
+        UniformGrid grid(32.0f, 64);
+        const BodyHandle a = grid.Insert({100.0f, 100.0f}, 10.0f, 1);
+        grid.Remove(a);
+        const BodyHandle b = grid.Insert({500.0f, 500.0f}, 10.0f, 2);
+        NV_CHECK(b.index == a.index && b.generation != a.generation);
+        grid.Update(a, {500.0f, 500.0f}, 50.0f); // 古いハンドルでは何もしない
+        grid.Remove(a);
+        NV_CHECK(grid.Count() == 1);
+
+        grid.Clear();
+        NV_CHECK(grid.Count() == 0);
+        const BodyHandle c = grid.Insert({100.0f, 100.0f}, 10.0f, 3);
+        NV_CHECK(c.index == b.index && c.generation != b.generation);
+        grid.Remove(b); // Clear 前のハンドルは再利用後の物体を外さない
+        NV_CHECK(grid.Count() == 1);
+        std::vector<uint32_t> found;
+        grid.QueryCircle({100.0f, 100.0f}, 1.0f, found);
+        NV_CHECK(found.size() == 1 && found[0] == 3);
+
+        // 一度も外していない物体のハンドルも、Clear の後は無効になる
+        UniformGrid fresh(32.0f, 64);
+        const BodyHandle d = fresh.Insert({100.0f, 100.0f}, 10.0f, 4);
+        fresh.Clear();
+        const BodyHandle e = fresh.Insert({100.0f, 100.0f}, 10.0f, 5);
+        NV_CHECK(e.index == d.index && e.generation != d.generation);
+        fresh.Remove(d);
+        NV_CHECK(fresh.Count() == 1);
+    }
+}
+
+int main()
+{
+    checkAgainstBruteForce(false);
+    checkAgainstBruteForce(true);
+    checkStaleHandles();
+    return Test::Result("UniformGridTest");
+}
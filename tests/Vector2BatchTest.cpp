@@ -0,0 +1,133 @@
+// Vector2Batch の各カーネルと Vector2Pack の演算が、Vector2 のスカラー式とビット単位で一致することを確かめる。
+// 要素数はパックの幅で割り切れない数にして、端数の処理も通す。ゼロベクトルも混ぜる。
+
+#include "TestCommon.h"
+#include <NeonVector/Math/FastMath.h>
+#include <NeonVector/Math/Random.h>
+#include <NeonVector/Math/Vector2Pack.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace NeonVector;
+
+namespace
+{
+    constexpr size_t kCount = 10007;
+
+    template <class T>
+    bool sameBits(const std::vector<T> &a, const std::vector<T> &b)
+    {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+    }
+
+    bool sameBits(const Vector2 &a, const Vector2 &b)
+    {
+        return std::memcmp(&a, &b, sizeof(Vector2)) == 0;
+    }
+}
+
+int main()
+{
+    Random rng(1);
+    std::vector<Vector2> v(kCount), out(kCount), ref(kCount);
+    std::vector<float> angles(kCount), f(kCount), fref(kCount);
+    for (size_t i = 0; i < kCount; ++i)
+    {
+        v[i] = {rng.Range(-1000.0f, 1000.0f), rng.Range(-1000.0f, 1000.0f)};
+        angles[i] = rng.Range(-10.0f, 10.0f);
+    }
+    v[5] = {0.0f, 0.0f};
+    v[kCount - 1] = {0.0f, 0.0f};
+
+    const Vector2 offset{3.5f, -7.0f};
+    const float angle = 0.77f;
+    const float scale = 1.3f;
+
+    // Transform
+    Vector2Batch::Transform(v.data(), out.data(), kCount, offset, angle, scale);
+    {
+        const float c = std::cos(angle), s = std::sin(angle);
+        for (size_t i = 0; i < kCount; ++i)
+            ref[i] = offset + v[i].Rotate(c, s) * scale;
+    }
+    NV_CHECK(sameBits(out, ref));
+
+    // Rotate（一律の角度）
+    Vector2Batch::Rotate(v.data(), out.data(), kCount, angle);
+    for (size_t i = 0; i < kCount; ++i)
+        ref[i] = v[i].Rotate(angle);
+    NV_CHECK(sameBits(out, ref));
+
+    // Rotate（要素ごとの角度）
+    Vector2Batch::Rotate(v.data(), angles.data(), out.data(), kCount);
+    for (size_t i = 0; i < kCount; ++i)
+    {
+        float s, c;
+        FastMath::SinCos(angles[i], s, c);
+        ref[i] = v[i].Rotate(c, s);
+    }
+    NV_CHECK(sameBits(out, ref));
+
+    // Normalize（ゼロベクトルはそのまま）
+    Vector2Batch::Normalize(v.data(), out.data(), kCount);
+    for (size_t i = 0; i < kCount; ++i)
+    {
+        ref[i] = v[i];
+        ref[i].Normalize();
+    }
+    NV_CHECK(sameBits(out, ref));
+    NV_CHECK(out[5].x == 0.0f && out[5].y == 0.0f);
+
+    // Length / DistanceSq
+    Vector2Batch::Length(v.data(), f.data(), kCount);
+    for (size_t i = 0; i < kCount; ++i)
+        fref[i] = v[i].Length();
+    NV_CHECK(sameBits(f, fref));
+
+    Vector2Batch::DistanceSq(v.data(), offset, f.data(), kCount);
+    for (size_t i = 0; i < kCount; ++i)
+        fref[i] = (v[i] - offset).LengthSquared();
+    NV_CHECK(sameBits(f, fref));
+
+    // MinMax
+    {
+        Vector2 lo, hi;
+        Vector2Batch::MinMax(v.data(), kCount, lo, hi);
+        Vector2 lo2 = v[0], hi2 = v[0];
+        for (const Vector2 &p : v)
+        {
+            lo2.x = std::min(lo2.x, p.x);
+            lo2.y = std::min(lo2.y, p.y);
+            hi2.x = std::max(hi2.x, p.x);
+            hi2.y = std::max(hi2.y, p.y);
+        }
+        NV_CHECK(sameBits(lo, lo2));
+        NV_CHECK(sameBits(hi, hi2));
+    }
+
+    // パック同士の演算
+    {
+        const Vector2x4 p = Vector2x4::Load(v.data());
+        const Vector2x4 q = Vector2x4::Load(v.data() + 4);
+        float dot[4], cross[4];
+        p.Dot(q).Store(dot);
+        p.Cross(q).Store(cross);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            NV_CHECK(dot[i] == v[i].Dot(v[i + 4]));
+            NV_CHECK(cross[i] == v[i].Cross(v[i + 4]));
+        }
+
+        const Vector2x8 a = Vector2x8::Load(v.data());
+        const Vector2x8 b = Vector2x8::Load(v.data() + 8);
+        Vector2 lerp[8];
+        Vector2x8::Lerp(a, b, Simd::Float8::Set1(0.3f)).Store(lerp);
+        for (size_t i = 0; i < 8; ++i)
+            NV_CHECK(sameBits(lerp[i], Vector2::Lerp(v[i], v[i + 8], 0.3f)));
+    }
+
+    return Test::Result("Vector2BatchTest");
+}
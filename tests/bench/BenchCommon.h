@@ -0,0 +1,60 @@
+/**
+ * @file BenchCommon.h
+ * @brief マイクロベンチマーク用の計測ヘルパ（結果は標準出力へ表で出すだけで、合否は判定しない）
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace NeonVector
+{
+    namespace Bench
+    {
+        /** @brief 最適化で計算が消されないよう、値を volatile へ書き出す（算術型用） */
+        template <class T>
+        inline void DoNotOptimize(T value)
+        {
+            [[maybe_unused]] static volatile T sink;
+            sink = value;
+        }
+
+        /** @brief fn を 1 回だけ走らせた時間（マイクロ秒）。状態が変わって繰り返せない計測用 */
+        template <class Fn>
+        double ElapsedMicros(Fn &&fn)
+        {
+            using Clock = std::chrono::steady_clock;
+            const Clock::time_point t0 = Clock::now();
+            fn();
+            return std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+        }
+
+        /**
+         * @brief fn を 1 回空回ししてから reps 回計り、最速の 1 回をマイクロ秒で返す
+         *
+         * 最速値を使うのは、他プロセスの割り込みなどの外乱が「遅くする」方向にしか働かないため。
+         */
+        template <class Fn>
+        double MinMicros(int reps, Fn &&fn)
+        {
+            using Clock = std::chrono::steady_clock;
+            fn();
+            double best = 1e300;
+            for (int r = 0; r < reps; ++r)
+            {
+                const Clock::time_point t0 = Clock::now();
+                fn();
+                const Clock::time_point t1 = Clock::now();
+                best = std::min(best, std::chrono::duration<double, std::micro>(t1 - t0).count());
+            }
+            return best;
+        }
+
+        /** @brief 「名前  時間  備考」の 1 行を出す */
+        inline void Report(const char *name, double micros, const char *note = "")
+        {
+            std::printf("%-40s %12.2f us  %s\n", name, micros, note);
+        }
+    }
+}
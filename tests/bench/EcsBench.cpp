@@ -0,0 +1,95 @@
+// Pos + Vel を持つエンティティの反復を Each / EachChunk / 素の配列で比べる。
+// 100000 個の Pos + Vel に、Pos + Vel + Life（これも一致する）と Pos だけ（飛ばされる）を 20000 個ずつ混ぜる。
+// 目標は 100000 エンティティあたり 100 us 未満。
+
+#include "BenchCommon.h"
+#include <NeonVector/Core/Ecs.h>
+
+#include <cstdio>
+#include <vector>
+
+using namespace NeonVector;
+using namespace NeonVector::Ecs;
+
+namespace
+{
+    constexpr int kEntities = 100000;
+    constexpr int kOthers = 20000;
+    constexpr float kDt = 1.0f / 60.0f;
+
+    struct Pos
+    {
+        float x, y;
+    };
+    struct Vel
+    {
+        float x, y;
+    };
+    struct Life
+    {
+        float t;
+    };
+}
+
+int main()
+{
+    World world;
+    for (int i = 0; i < kEntities; ++i)
+        world.Create(Pos{float(i), 0.0f}, Vel{1.0f, 0.5f});
+    for (int i = 0; i < kOthers; ++i)
+        world.Create(Pos{0.0f, 0.0f});
+    for (int i = 0; i < kOthers; ++i)
+        world.Create(Pos{0.0f, 0.0f}, Vel{0.0f, 0.0f}, Life{1.0f});
+
+    std::printf("%d entities with Pos + Vel (%zu in total, %zu archetypes)\n", kEntities + kOthers, world.Count(),
+                world.ArchetypeCount());
+    Bench::Report("Each<Pos, const Vel>", Bench::MinMicros(50, [&] {
+        world.Each<Pos, const Vel>([](Pos &p, const Vel &v) {
+            p.x += v.x * kDt;
+            p.y += v.y * kDt;
+        });
+    }));
+    Bench::Report("EachChunk<Pos, const Vel>", Bench::MinMicros(50, [&] {
+        world.EachChunk<Pos, const Vel>([](size_t n, const Entity *, Pos *p, const Vel *v) {
+            for (size_t i = 0; i < n; ++i)
+            {
+                p[i].x += v[i].x * kDt;
+                p[i].y += v[i].y * kDt;
+            }
+        });
+    }));
+
+    std::vector<Pos> positions(kEntities + kOthers);
+    std::vector<Vel> velocities(kEntities + kOthers, Vel{1.0f, 0.5f});
+    Bench::Report("plain std::vector (same count)", Bench::MinMicros(50, [&] {
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            positions[i].x += velocities[i].x * kDt;
+            positions[i].y += velocities[i].y * kDt;
+        }
+    }));
+    float checksum = positions[0].x;
+    world.Each<const Pos>([&](const Pos &p) { checksum += p.x; });
+    Bench::DoNotOptimize(checksum);
+
+    // 構造変更: 半分に Life を足して外す（アーキタイプ間の移動）
+    std::vector<Entity> entities;
+    world.Each<Pos, Vel>([&](Entity e, Pos &, Vel &) { entities.push_back(e); });
+    Bench::Report("Add + Remove<Life> on every 2nd entity", Bench::ElapsedMicros([&] {
+        for (size_t i = 0; i < entities.size(); i += 2)
+            world.Add(entities[i], Life{2.0f});
+        for (size_t i = 0; i < entities.size(); i += 2)
+            world.Remove<Life>(entities[i]);
+    }));
+
+    // 同じことを CommandBuffer に積み、反復の後にまとめて適用する
+    CommandBuffer commands;
+    Bench::Report("Add<Life> via CommandBuffer (record+play)", Bench::ElapsedMicros([&] {
+        world.Each<Pos, const Vel>([&](Entity e, Pos &, const Vel &) {
+            if (e.index % 2)
+                commands.Add(e, Life{2.0f});
+        });
+        world.Playback(commands);
+    }));
+    return 0;
+}
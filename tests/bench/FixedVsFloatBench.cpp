@@ -0,0 +1,111 @@
+// BasicParticleSim<Fixed> と BasicParticleSim<float> の比較（固定小数点にするコスト）と、
+// Fixed の三角関数と FastMath の比較。
+
+#include "BenchCommon.h"
+#include <NeonVector/Effects/BasicParticleSim.h>
+#include <NeonVector/Math/FastMath.h>
+#include <NeonVector/Math/Fixed.h>
+
+#include <cstdio>
+
+using namespace NeonVector;
+
+namespace
+{
+    Fixed toScalar(float v, Fixed) { return Fixed::FromFloat(v); }
+    float toScalar(float v, float) { return v; }
+
+    /** @brief 壁・円のある箱に 10 フレームごとに 200 粒子を出し、600 フレーム進める */
+    template <class T>
+    double sceneMicros(uint64_t &checksum, size_t &count)
+    {
+        using Vec = BasicVector2<T>;
+        auto s = [](float v) { return toScalar(v, T{}); };
+        Effects::BasicParticleSim<T> sim;
+        sim.SetSeed(42);
+        sim.SetGravity(Vec{s(0.0f), s(2.0f)});
+        sim.SetDrag(s(0.74f));
+        sim.AddSegment(Vec{s(0.0f), s(8.0f)}, Vec{s(20.0f), s(8.0f)});
+        sim.AddCircle(Vec{s(10.0f), s(3.0f)}, s(1.5f));
+        sim.AddSegment(Vec{s(0.0f), s(0.0f)}, Vec{s(0.0f), s(8.0f)}, Effects::CollisionResponse::Kill);
+
+        const double us = Bench::ElapsedMicros([&] {
+            for (int f = 0; f < 600; ++f)
+            {
+                if (f % 10 == 0)
+                    sim.Emit(Vec{s(10.0f), s(5.0f)}, 200, s(1.0f), s(6.0f), ColorRGBA8(), s(3.0f));
+                sim.Update(s(1.0f / 60.0f));
+            }
+        });
+        checksum = sim.Checksum();
+        count = sim.Count();
+        return us;
+    }
+
+    /** @brief 10 万粒子の Update 1 回（衝突なし） */
+    template <class T>
+    double updateMicros()
+    {
+        using Vec = BasicVector2<T>;
+        auto s = [](float v) { return toScalar(v, T{}); };
+        Effects::BasicParticleSim<T> sim;
+        sim.SetSeed(1);
+        sim.SetGravity(Vec{s(0.0f), s(1.0f)});
+        sim.SetDrag(s(0.9f));
+        sim.Emit(Vec{s(0.0f), s(0.0f)}, 100000, s(1.0f), s(3.0f), ColorRGBA8(), s(1000.0f));
+        return Bench::MinMicros(50, [&] { sim.Update(s(1.0f / 60.0f)); });
+    }
+
+    /** @brief 10 万粒子の Emit 1 回 */
+    template <class T>
+    double emitMicros()
+    {
+        auto s = [](float v) { return toScalar(v, T{}); };
+        Effects::BasicParticleSim<T> sim;
+        return Bench::MinMicros(10, [&] {
+            sim.Clear();
+            sim.Emit({}, 100000, s(1.0f), s(3.0f), ColorRGBA8(), s(1.0f));
+        });
+    }
+}
+
+int main()
+{
+    uint64_t fixedSum, floatSum;
+    size_t fixedCount, floatCount;
+    const double fixedScene = sceneMicros<Fixed>(fixedSum, fixedCount);
+    const double floatScene = sceneMicros<float>(floatSum, floatCount);
+    std::printf("scene: fixed %zu particles (checksum %016llx), float %zu particles\n", fixedCount,
+        static_cast<unsigned long long>(fixedSum), floatCount);
+    Bench::Report("scene 600 frames, Fixed", fixedScene);
+    Bench::Report("scene 600 frames, float", floatScene);
+
+    Bench::Report("Update 100k, Fixed", updateMicros<Fixed>());
+    Bench::Report("Update 100k, float", updateMicros<float>());
+    Bench::Report("Emit 100k, Fixed", emitMicros<Fixed>());
+    Bench::Report("Emit 100k, float", emitMicros<float>());
+
+    const double fixedTrig = Bench::MinMicros(5, [] {
+        int32_t acc = 0;
+        for (int32_t r = 0; r < 1000000; ++r)
+        {
+            Fixed sn, cs;
+            SinCos(Fixed::FromRaw(r * 7), sn, cs);
+            acc += sn.Raw() ^ cs.Raw();
+        }
+        Bench::DoNotOptimize(acc);
+    });
+    const double floatTrig = Bench::MinMicros(5, [] {
+        float acc = 0.0f;
+        for (int32_t r = 0; r < 1000000; ++r)
+        {
+            float sn, cs;
+            FastMath::SinCos(static_cast<float>(r * 7) / 65536.0f, sn, cs);
+            acc += sn + cs;
+        }
+        Bench::DoNotOptimize(acc);
+    });
+    Bench::Report("1M SinCos, Fixed", fixedTrig);
+    Bench::Report("1M SinCos, FastMath float", floatTrig);
+    return 0;
+}
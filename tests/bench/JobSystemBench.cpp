@@ -0,0 +1,128 @@
+// JobSystem の積む・走らせるコストと、スレッド数に対する伸び。
+// 伸びは計算の重い ParallelFor と ParticleSystem で見る。Update は 30 万粒子の 1 システム。
+// LineBatcher は 1 回に 10000 本までで未初期化では Flush できないので、Draw は 1 万粒子のシステム
+// 30 個を、それぞれ Clear したバッチャへ描く。論理コア数を超えるスレッド数は計らない。
+
+#include "BenchCommon.h"
+#include <NeonVector/Core/JobSystem.h>
+#include <NeonVector/Effects/ParticleSystem.h>
+#include <NeonVector/Graphics/LineBatcher.h>
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace NeonVector;
+
+namespace
+{
+    constexpr int kEmptyJobs = 4000;
+    constexpr size_t kSqrtCount = size_t(1) << 22;
+    constexpr int kParticles = 300000;
+    constexpr int kDrawSystems = 30;
+    constexpr int kFrames = 30;
+
+    void fib(JobSystem &jobs, int n, long *out)
+    {
+        if (n < 2)
+        {
+            *out = n;
+            return;
+        }
+        long a, b;
+        JobCounter counter;
+        jobs.Spawn(counter, [&jobs, n, &a] { fib(jobs, n - 1, &a); });
+        fib(jobs, n - 2, &b);
+        jobs.Wait(counter);
+        *out = a + b;
+    }
+
+    void overhead(JobSystem &jobs)
+    {
+        const double spawn = Bench::MinMicros(20, [&] {
+            JobCounter counter;
+            for (int i = 0; i < kEmptyJobs; ++i)
+                jobs.Spawn(counter, [] {});
+            jobs.Wait(counter);
+        });
+        char note[64];
+        std::snprintf(note, sizeof(note), "%.1f ns/job", spawn * 1000.0 / kEmptyJobs);
+        Bench::Report("  Spawn + run 4000 empty jobs", spawn, note);
+
+        long result = 0;
+        Bench::Report("  recursive fib(20) (~11k jobs)", Bench::MinMicros(20, [&] { fib(jobs, 20, &result); }));
+        Bench::DoNotOptimize(result);
+        Bench::Report("  ParallelFor, 64 empty chunks", Bench::MinMicros(2000, [&] {
+            jobs.ParallelFor(64, 1, [](size_t, size_t) {});
+        }));
+    }
+
+    void scaling(JobSystem &jobs, const Effects::ParticleSystem &updateBase,
+                 const std::vector<Effects::ParticleSystem> &drawBase)
+    {
+        std::vector<float> values(kSqrtCount, 1.0f);
+        Bench::Report("  4M sqrt, ParallelFor grain 16k", Bench::MinMicros(5, [&] {
+            jobs.ParallelFor(values.size(), 16384, [&](size_t b, size_t e) {
+                for (size_t i = b; i < e; ++i)
+                    values[i] = std::sqrt(values[i] * 1.0001f + 0.5f);
+            });
+        }));
+        Bench::DoNotOptimize(values[kSqrtCount / 2]);
+
+        JobSystem *particleJobs = jobs.GetThreadCount() > 1 ? &jobs : nullptr;
+        Effects::ParticleSystem ps = updateBase;
+        ps.SetJobSystem(particleJobs);
+        const double update = Bench::ElapsedMicros([&] {
+            for (int f = 0; f < kFrames; ++f)
+                ps.Update(1.0f / 60.0f);
+        });
+        Bench::Report("  300k particles, Update / frame", update / kFrames);
+
+        std::vector<Effects::ParticleSystem> systems = drawBase;
+        for (Effects::ParticleSystem &s : systems)
+            s.SetJobSystem(particleJobs);
+        Graphics::LineBatcher batcher;
+        size_t lines = 0;
+        const double draw = Bench::MinMicros(10, [&] {
+            lines = 0;
+            for (const Effects::ParticleSystem &s : systems)
+            {
+                s.Draw(&batcher);
+                lines += batcher.GetLineCount();
+                batcher.Clear();
+            }
+        });
+        char note[64];
+        std::snprintf(note, sizeof(note), "%zu lines", lines);
+        Bench::Report("  30 x 10k particles, Draw / frame", draw, note);
+    }
+}
+
+int main()
+{
+    Effects::ParticleSystem updateBase;
+    updateBase.SetSeed(1);
+    updateBase.Emit({640.0f, 360.0f}, kParticles, 80.0f, 380.0f, Color::Cyan, 2.0f);
+    std::vector<Effects::ParticleSystem> drawBase(kDrawSystems);
+    for (int i = 0; i < kDrawSystems; ++i)
+    {
+        drawBase[i].SetSeed(100 + i);
+        drawBase[i].Emit({640.0f, 360.0f}, static_cast<int>(Graphics::LineBatcher::GetMaxLineCount()), 80.0f, 380.0f,
+                         Color::Cyan, 2.0f);
+        drawBase[i].Update(0.1f);
+    }
+
+    const unsigned maxWorkers = JobSystem::DefaultWorkerCount();
+    for (unsigned workers = 0;; workers = workers ? workers * 2 + 1 : 1)
+    {
+        if (workers > maxWorkers)
+            workers = maxWorkers;
+        JobSystem jobs(workers);
+        std::printf("%u thread%s\n", jobs.GetThreadCount(), jobs.GetThreadCount() == 1 ? "" : "s");
+        overhead(jobs);
+        scaling(jobs, updateBase, drawBase);
+        if (workers == maxWorkers)
+            break;
+    }
+    return 0;
+}
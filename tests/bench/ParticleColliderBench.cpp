@@ -0,0 +1,56 @@
+// 10 万粒子の Update を、衝突なしと 1000 個のコライダ（線分 500 + 円 500）ありで比べる。
+
+#include "BenchCommon.h"
+#include <NeonVector/Effects/ParticleColliders.h>
+#include <NeonVector/Effects/ParticleSystem.h>
+#include <NeonVector/Math/Random.h>
+
+#include <cstdio>
+
+using namespace NeonVector;
+
+namespace
+{
+    constexpr int kBursts = 100;
+    constexpr int kPerBurst = 1000;
+    constexpr int kFrames = 60;
+    constexpr float kWorld = 4000.0f;
+
+    /** @brief 1 フレームあたりの平均（µs）。粒子は長寿命で、計測中に減らない */
+    double framesMicros(Effects::ParticleColliders *colliders)
+    {
+        Random rng(7);
+        Effects::ParticleSystem ps;
+        ps.SetSeed(1);
+        ps.SetDrag(1.0f);
+        for (int i = 0; i < kBursts; ++i)
+            ps.Emit({rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)}, kPerBurst, 50.0f, 300.0f, Color::Cyan, 100.0f);
+        ps.SetColliders(colliders);
+
+        const double total = Bench::ElapsedMicros([&] {
+            for (int f = 0; f < kFrames; ++f)
+                ps.Update(1.0f / 60.0f);
+        });
+        std::printf("  %zu particles left\n", ps.Count());
+        return total / kFrames;
+    }
+}
+
+int main()
+{
+    Effects::ParticleColliders colliders(64.0f);
+    Random rng(5);
+    for (int i = 0; i < 500; ++i)
+    {
+        const Vector2 a{rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)};
+        colliders.AddSegment(a, a + Vector2{rng.Range(-40.0f, 40.0f), rng.Range(-40.0f, 40.0f)});
+    }
+    for (int i = 0; i < 500; ++i)
+        colliders.AddCircle({rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)}, rng.Range(5.0f, 30.0f),
+            Effects::CollisionResponse::Kill);
+
+    std::printf("%d particles, %d frames\n", kBursts * kPerBurst, kFrames);
+    Bench::Report("Update, no colliders (per frame)", framesMicros(nullptr));
+    Bench::Report("Update, 1000 colliders (per frame)", framesMicros(&colliders));
+    return 0;
+}
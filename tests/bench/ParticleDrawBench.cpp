@@ -0,0 +1,47 @@
+// ParticleSystem::Draw（確保した頂点へ直接書く）と、粒子ごとに AddLine を呼ぶ素朴な書き方の比較。
+// LineBatcher は初期化しない（頂点バッファへ書くだけで GPU には送らない）。
+
+#include "BenchCommon.h"
+#include <NeonVector/Effects/ParticleSystem.h>
+#include <NeonVector/Graphics/LineBatcher.h>
+
+#include <vector>
+
+using namespace NeonVector;
+
+int main()
+{
+    constexpr int kParticles = 9000;
+    constexpr int kReps = 200;
+
+    Effects::ParticleSystem ps;
+    ps.SetSeed(1);
+    ps.Emit({640.0f, 360.0f}, kParticles, 10.0f, 300.0f, Color::Cyan, 1.0f);
+    ps.Update(0.3f);
+
+    // 比較用: ParticleSystem が持つ粒子そのものを手元の配列へ写す（分布も生存数も同じ）
+    const std::vector<Effects::Particle> parts(ps.Particles(), ps.Particles() + ps.Count());
+
+    Graphics::LineBatcher batcher;
+
+    const double addLine = Bench::MinMicros(kReps, [&] {
+        for (const Effects::Particle &p : parts)
+        {
+            Color c = p.color.ToColor();
+            c.a *= p.life / p.maxLife;
+            const float speed = p.vel.Length();
+            const Vector2 half = speed > 1e-3f ? p.vel * (p.size * 0.5f / speed) : Vector2{p.size * 0.5f, 0.0f};
+            batcher.AddLine(p.pos - half, p.pos + half, c, p.size * 0.6f, 1.5f);
+        }
+        batcher.Clear();
+    });
+    const double direct = Bench::MinMicros(kReps, [&] {
+        ps.Draw(&batcher);
+        batcher.Clear();
+    });
+
+    std::printf("%d particles (%zu alive after 0.3 s)\n", kParticles, ps.Count());
+    Bench::Report("AddLine per particle", addLine);
+    Bench::Report("ParticleSystem::Draw", direct);
+    return 0;
+}
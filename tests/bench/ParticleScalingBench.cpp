@@ -0,0 +1,105 @@
+// ParticleSystem の Update と Draw を、1 スレッドから論理コア数まで JobSystem のスレッド数を変えて計る。
+// Update は 30 万粒子の 1 システム。LineBatcher は 1 回に 10000 本までで、未初期化では Flush できないので、
+// Draw は 1 万粒子のシステム 30 個を、それぞれ Clear したバッチャへ描いて合計する。
+
+#include "BenchCommon.h"
+#include <NeonVector/Core/JobSystem.h>
+#include <NeonVector/Effects/ParticleColliders.h>
+#include <NeonVector/Effects/ParticleSystem.h>
+#include <NeonVector/Graphics/LineBatcher.h>
+#include <NeonVector/Math/Random.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+using namespace NeonVector;
+
+namespace
+{
+    constexpr int kUpdateParticles = 300000;
+    constexpr int kDrawSystems = 30;
+    constexpr int kFrames = 30;
+    constexpr float kWorld = 2000.0f;
+    constexpr size_t kDrawParticles = Graphics::LineBatcher::GetMaxLineCount();
+
+    Effects::ParticleSystem makeSystem(int count, uint64_t seed)
+    {
+        Effects::ParticleSystem ps;
+        ps.SetSeed(seed);
+        ps.SetDrag(0.9f);
+        Random rng(seed);
+        for (int emitted = 0; emitted < count; emitted += 1000)
+            ps.Emit({rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)}, std::min(1000, count - emitted), 50.0f, 300.0f,
+                    Color::Cyan, 100.0f);
+        return ps;
+    }
+
+    void run(JobSystem *jobs, const std::vector<Effects::ParticleSystem> &drawBase,
+             const Effects::ParticleSystem &updateBase, const Effects::ParticleColliders &colliders)
+    {
+        Effects::ParticleSystem ps = updateBase;
+        ps.SetJobSystem(jobs);
+        const double plain = Bench::ElapsedMicros([&] {
+            for (int f = 0; f < kFrames; ++f)
+                ps.Update(1.0f / 60.0f);
+        });
+        ps.SetColliders(&colliders);
+        const double collide = Bench::ElapsedMicros([&] {
+            for (int f = 0; f < kFrames; ++f)
+                ps.Update(1.0f / 60.0f);
+        });
+
+        std::vector<Effects::ParticleSystem> systems = drawBase;
+        for (Effects::ParticleSystem &s : systems)
+            s.SetJobSystem(jobs);
+        Graphics::LineBatcher batcher;
+        size_t lines = 0;
+        const double draw = Bench::MinMicros(10, [&] {
+            lines = 0;
+            for (const Effects::ParticleSystem &s : systems)
+            {
+                s.Draw(&batcher);
+                lines += batcher.GetLineCount();
+                batcher.Clear();
+            }
+        });
+
+        char note[64];
+        std::snprintf(note, sizeof(note), "%zu particles", ps.Count());
+        Bench::Report("  Update / frame", plain / kFrames, "300000 particles");
+        Bench::Report("  Update, 300 colliders / frame", collide / kFrames, note);
+        std::snprintf(note, sizeof(note), "%zu lines", lines);
+        Bench::Report("  Draw, 30 x 10k particles / frame", draw, note);
+    }
+}
+
+int main()
+{
+    Effects::ParticleColliders colliders(64.0f);
+    Random rng(5);
+    for (int i = 0; i < 300; ++i)
+        colliders.AddCircle({rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)}, rng.Range(5.0f, 30.0f),
+                            Effects::CollisionResponse::Bounce);
+
+    const Effects::ParticleSystem updateBase = makeSystem(kUpdateParticles, 1);
+    std::vector<Effects::ParticleSystem> drawBase;
+    for (int i = 0; i < kDrawSystems; ++i)
+    {
+        drawBase.push_back(makeSystem(static_cast<int>(kDrawParticles), 100 + i));
+        drawBase.back().Update(0.1f);
+    }
+
+    std::printf("1 thread (no JobSystem)\n");
+    run(nullptr, drawBase, updateBase, colliders);
+
+    // 2, 4, 8, ... と論理コア数
+    const unsigned maxThreads = JobSystem::DefaultWorkerCount() + 1;
+    for (unsigned threads = 2; threads <= maxThreads; threads = (threads * 2 > maxThreads && threads < maxThreads) ? maxThreads : threads * 2)
+    {
+        JobSystem jobs(threads - 1);
+        std::printf("%u threads\n", jobs.GetThreadCount());
+        run(&jobs, drawBase, updateBase, colliders);
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+// 折れ線の簡略化を許容誤差ごとに比べる: RDP・Visvalingam（Polyline.h を一括で）と、
+// Trail::SetSimplify が点を積むたびに直近の区間だけやり直す逐次版。
+// 入力はトレイルのような滑らかな曲線（約 2 px 間隔, わずかな揺れ付き）。各行に線分数の入出力と、
+// 元の点から簡略化後の折れ線までの最大距離（実測）を出す。
+
+#include "BenchCommon.h"
+#include <NeonVector/Effects/Trail.h>
+#include <NeonVector/Graphics/LineBatcher.h>
+#include <NeonVector/Math/Polyline.h>
+#include <NeonVector/Math/Random.h>
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace NeonVector;
+
+namespace
+{
+    // Trail の頂点を拾うので LineBatcher 1 回分（kMaxLines）に収まる点数にする
+    constexpr int kPoints = 8000;
+    constexpr int kReps = 50;
+
+    std::vector<Vector2> makePath()
+    {
+        std::vector<Vector2> path;
+        path.reserve(kPoints);
+        Random rng(7);
+        float angle = 0.0f;
+        Vector2 p{640.0f, 360.0f};
+        for (int i = 0; i < kPoints; ++i)
+        {
+            // 曲率がゆっくり変わる（直線に近い区間と急なカーブが混ざる）
+            angle += 0.08f * std::sin(i * 0.013f) + 0.02f * std::sin(i * 0.071f);
+            p = p + Vector2{std::cos(angle), std::sin(angle)} * 2.0f;
+            path.push_back(p + Vector2{rng.Range(-0.1f, 0.1f), rng.Range(-0.1f, 0.1f)});
+        }
+        return path;
+    }
+
+    float segmentDistance(const Vector2 &p, const Vector2 &a, const Vector2 &b)
+    {
+        const Vector2 ab = b - a, ap = p - a;
+        const float len2 = ab.LengthSquared();
+        const float t = len2 > 0.0f ? std::min(std::max(ap.Dot(ab) / len2, 0.0f), 1.0f) : 0.0f;
+        return (ap - ab * t).Length();
+    }
+
+    /**
+     * @brief 元の各点から、それを挟む残った 2 点の線分までの距離の最大値
+     *
+     * 残った点は元の点の部分列（座標がそのまま）なので、先頭から一致で対応を取る。
+     */
+    float maxError(const std::vector<Vector2> &path, const std::vector<Vector2> &kept)
+    {
+        float worst = 0.0f;
+        size_t k = 0;
+        for (const Vector2 &p : path)
+        {
+            if (k + 1 < kept.size() && p.x == kept[k + 1].x && p.y == kept[k + 1].y)
+                ++k;
+            if (k + 1 < kept.size())
+                worst = std::max(worst, segmentDistance(p, kept[k], kept[k + 1]));
+        }
+        return worst;
+    }
+
+    /** @brief Trail が保持している点を Draw の頂点から拾う（各線分の始点 + 最後の終点） */
+    std::vector<Vector2> trailPoints(const Effects::Trail &trail)
+    {
+        Graphics::LineBatcher batcher;
+        trail.Draw(&batcher, Color::Cyan);
+        const Graphics::LineVertex *v = batcher.GetVertices();
+        const size_t lines = batcher.GetLineCount();
+        std::vector<Vector2> points;
+        for (size_t i = 0; i < lines; ++i)
+            points.push_back({v[i * 2].position.x, v[i * 2].position.y});
+        if (lines > 0)
+            points.push_back({v[lines * 2 - 1].position.x, v[lines * 2 - 1].position.y});
+        return points;
+    }
+
+    void report(const char *name, double micros, const std::vector<Vector2> &path, const std::vector<Vector2> &kept)
+    {
+        char note[96];
+        std::snprintf(note, sizeof(note), "segments %zu -> %zu, max error %.3f px", path.size() - 1,
+                      kept.size() - 1, maxError(path, kept));
+        Bench::Report(name, micros, note);
+    }
+}
+
+int main()
+{
+    const std::vector<Vector2> path = makePath();
+    std::vector<Vector2> work;
+    work.reserve(path.size());
+
+    std::printf("%d points; RDP / Visvalingam times include copying the input\n", kPoints);
+    for (float tolerance : {0.25f, 0.5f, 1.0f, 2.0f, 4.0f})
+    {
+        std::printf("-- tolerance %.2f px\n", tolerance);
+
+        const double rdp = Bench::MinMicros(kReps, [&] {
+            work.assign(path.begin(), path.end());
+            work.erase(Polyline::SimplifyRDP(work.begin(), work.end(), tolerance), work.end());
+        });
+        report("RDP", rdp, path, work);
+
+        // Visvalingam は面積で止めるので、Polyline.h の目安どおり tolerance^2 を渡す
+        const double vw = Bench::MinMicros(kReps, [&] {
+            work.assign(path.begin(), path.end());
+            work.erase(Polyline::SimplifyVisvalingam(work.begin(), work.end(), tolerance * tolerance), work.end());
+        });
+        report("Visvalingam (minArea = tol^2)", vw, path, work);
+
+        // 逐次版: 1 点ずつ Push する総時間（間引かない Trail との差が簡略化のコスト）
+        Effects::Trail trail(kPoints);
+        const double incremental = Bench::MinMicros(kReps, [&] {
+            trail.Clear();
+            trail.SetSimplify(tolerance);
+            for (const Vector2 &p : path)
+                trail.Push(p);
+        });
+        report("Trail::SetSimplify (per Push)", incremental, path, trailPoints(trail));
+    }
+
+    Effects::Trail plain(kPoints);
+    const double baseline = Bench::MinMicros(kReps, [&] {
+        plain.Clear();
+        for (const Vector2 &p : path)
+            plain.Push(p);
+    });
+    std::printf("--\n");
+    report("Trail without simplify", baseline, path, trailPoints(plain));
+    return 0;
+}
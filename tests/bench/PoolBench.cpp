@@ -0,0 +1,130 @@
+// 弾のような短命のオブジェクトを、毎フレーム生成・寿命切れ・命中で消しながら更新する。
+// 生きている数 N ごとに、std::vector を毎フレーム詰め直す書き方と Pool（DestroyDeferred +
+// FlushDeferred）を比べる。最後に、特定の要素を消す場合（ハンドルがある / 配列から探す）も比べる。
+
+#include "BenchCommon.h"
+#include <NeonVector/Core/Pool.h>
+#include <NeonVector/Math/Random.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+using namespace NeonVector;
+
+namespace
+{
+    constexpr int kFrames = 600;
+    constexpr float kDt = 1.0f / 60.0f;
+
+    struct Bullet
+    {
+        float px, py, vx, vy, life;
+    };
+
+    Bullet makeBullet(Random &rng) { return {0.0f, 0.0f, 1.0f, 1.0f, rng.Range(0.1f, 1.75f)}; }
+
+    void churn(int live)
+    {
+        const int spawn = live / 50;
+
+        float checksum = 0.0f;
+        Random rng(1);
+        std::vector<Bullet> bullets;
+        bullets.reserve(live * 2);
+        for (int i = 0; i < live; ++i)
+            bullets.push_back(makeBullet(rng));
+        const double vectorMicros = Bench::ElapsedMicros([&] {
+            for (int f = 0; f < kFrames; ++f)
+            {
+                for (int i = 0; i < spawn; ++i)
+                    bullets.push_back(makeBullet(rng));
+                for (Bullet &b : bullets)
+                {
+                    b.px += b.vx * kDt;
+                    b.py += b.vy * kDt;
+                    b.life -= kDt;
+                }
+                for (int k = 0; k < spawn / 4 && !bullets.empty(); ++k)
+                    bullets[rng.NextU32() % bullets.size()].life = 0.0f;   // 命中
+                bullets.erase(std::remove_if(bullets.begin(), bullets.end(), [](const Bullet &b) { return b.life <= 0.0f; }),
+                              bullets.end());
+            }
+        });
+        for (const Bullet &b : bullets)
+            checksum += b.px;
+
+        rng.Seed(1);
+        Pool<Bullet> pool;
+        pool.Reserve(live * 2);
+        for (int i = 0; i < live; ++i)
+            pool.Create(makeBullet(rng));
+        const double poolMicros = Bench::ElapsedMicros([&] {
+            for (int f = 0; f < kFrames; ++f)
+            {
+                for (int i = 0; i < spawn; ++i)
+                    pool.Create(makeBullet(rng));
+                for (size_t i = 0; i < pool.Size(); ++i)
+                {
+                    Bullet &b = pool[i];
+                    b.px += b.vx * kDt;
+                    b.py += b.vy * kDt;
+                    b.life -= kDt;
+                    if (b.life <= 0.0f)
+                        pool.DestroyDeferred(pool.HandleAt(i));
+                }
+                for (int k = 0; k < spawn / 4 && !pool.Empty(); ++k)
+                    pool.DestroyDeferred(pool.HandleAt(rng.NextU32() % pool.Size()));
+                pool.FlushDeferred();
+            }
+        });
+        for (const Bullet &b : pool)
+            checksum += b.px;
+        Bench::DoNotOptimize(checksum);
+
+        std::printf("%d live, %d spawned per frame\n", live, spawn);
+        Bench::Report("  vector compaction (per frame)", vectorMicros / kFrames);
+        Bench::Report("  Pool (per frame)", poolMicros / kFrames);
+    }
+
+    void destroySpecific()
+    {
+        constexpr int kCount = 20000;
+        Pool<Bullet> pool;
+        std::vector<Bullet> bullets;
+        std::vector<Pool<Bullet>::Handle> handles;
+        for (int i = 0; i < kCount; ++i)
+        {
+            const Bullet b{0.0f, 0.0f, 0.0f, 0.0f, float(i)};
+            handles.push_back(pool.Create(b));
+            bullets.push_back(b);
+        }
+        Random rng(2);
+        for (size_t i = handles.size(); i > 1; --i)
+            std::swap(handles[i - 1], handles[rng.NextU32() % i]);
+
+        std::printf("destroy %d chosen objects of %d\n", kCount / 2, kCount);
+        Bench::Report("  Pool::Destroy by handle", Bench::ElapsedMicros([&] {
+            for (int i = 0; i < kCount / 2; ++i)
+                pool.Destroy(handles[i]);
+        }));
+        // ハンドルの添字 = 生成順 = life に入れた値
+        Bench::Report("  vector find + erase", Bench::ElapsedMicros([&] {
+            for (int i = 0; i < kCount / 2; ++i)
+            {
+                const float key = float(handles[i].index);
+                const auto it = std::find_if(bullets.begin(), bullets.end(), [key](const Bullet &b) { return b.life == key; });
+                if (it != bullets.end())
+                    bullets.erase(it);
+            }
+        }));
+    }
+}
+
+int main()
+{
+    for (int live : {1000, 10000, 100000})
+        churn(live);
+    destroySpecific();
+    return 0;
+}
@@ -0,0 +1,99 @@
+// 10000 物体の UniformGrid を総当たりと比べる（全組の列挙、2000 点の一括問い合わせ、
+// 毎フレームの Update と作り直し）。巻き戻しなし・ありの両方で計る。
+
+#include "BenchCommon.h"
+#include <NeonVector/Math/Random.h>
+#include <NeonVector/Physics/UniformGrid.h>
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace NeonVector;
+using namespace NeonVector::Physics;
+
+namespace
+{
+    constexpr int kBodies = 10000;
+    constexpr int kQueries = 2000;
+    constexpr float kWorld = 4000.0f;
+    constexpr float kCellSize = 32.0f;
+    constexpr size_t kBuckets = 16384;
+
+    void run(bool wrap)
+    {
+        Random rng(1);
+        std::vector<Vector2> centers(kBodies), velocities(kBodies);
+        std::vector<float> radii(kBodies);
+        for (int i = 0; i < kBodies; ++i)
+        {
+            centers[i] = {rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)};
+            radii[i] = rng.Range(2.0f, 12.0f);
+            velocities[i] = {rng.Range(-5.0f, 5.0f), rng.Range(-5.0f, 5.0f)};
+        }
+
+        UniformGrid grid(kCellSize, kBuckets);
+        if (wrap)
+            grid.SetWrap({kWorld, kWorld});
+        std::vector<BodyHandle> handles(kBodies);
+        for (int i = 0; i < kBodies; ++i)
+            handles[i] = grid.Insert(centers[i], radii[i], static_cast<uint32_t>(i));
+
+        std::printf("%d bodies, wrap %s\n", kBodies, wrap ? "on" : "off");
+
+        size_t naivePairs = 0;
+        Bench::Report("  pairs, brute force", Bench::ElapsedMicros([&] {
+            for (int i = 0; i < kBodies; ++i)
+                for (int j = i + 1; j < kBodies; ++j)
+                {
+                    const float r = radii[i] + radii[j];
+                    naivePairs += grid.Delta(centers[i], centers[j]).LengthSquared() < r * r;
+                }
+        }));
+        std::vector<BodyPair> pairs;
+        Bench::Report("  pairs, FindPairs", Bench::MinMicros(10, [&] { grid.FindPairs(pairs); }));
+        std::printf("  %zu pairs (brute force %zu)\n", pairs.size(), naivePairs);
+
+        std::vector<Vector2> queries(kQueries);
+        for (Vector2 &q : queries)
+            q = {rng.Range(0.0f, kWorld), rng.Range(0.0f, kWorld)};
+        size_t naiveHits = 0;
+        Bench::Report("  2000 points, brute force", Bench::ElapsedMicros([&] {
+            for (const Vector2 &q : queries)
+                for (int i = 0; i < kBodies; ++i)
+                    naiveHits += grid.Delta(q, centers[i]).LengthSquared() < radii[i] * radii[i];
+        }));
+        std::vector<OverlapHit> hits;
+        Bench::Report("  2000 points, QueryCircles", Bench::MinMicros(10, [&] {
+            grid.QueryCircles(queries.data(), nullptr, 0.0f, queries.size(), hits);
+        }));
+        std::printf("  %zu hits (brute force %zu)\n", hits.size(), naiveHits);
+
+        // 1 フレーム分（全物体が少し動く）の更新と、毎フレーム作り直す場合
+        Bench::Report("  move all, Update", Bench::MinMicros(10, [&] {
+            for (int i = 0; i < kBodies; ++i)
+            {
+                Vector2 &c = centers[i];
+                c = c + velocities[i] * (1.0f / 60.0f);
+                if (wrap)
+                    c = {std::fmod(c.x + kWorld, kWorld), std::fmod(c.y + kWorld, kWorld)};
+                grid.Update(handles[i], c, radii[i]);
+            }
+        }));
+        Bench::Report("  move all, rebuild", Bench::MinMicros(10, [&] {
+            UniformGrid fresh(kCellSize, kBuckets);
+            if (wrap)
+                fresh.SetWrap({kWorld, kWorld});
+            for (int i = 0; i < kBodies; ++i)
+                fresh.Insert(centers[i], radii[i], static_cast<uint32_t>(i));
+            Bench::DoNotOptimize(fresh.Count());
+        }));
+    }
+}
+
+int main()
+{
+    run(false);
+    run(true);
+    return 0;
+}
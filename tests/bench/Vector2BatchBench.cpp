@@ -0,0 +1,136 @@
+// Vector2Batch の一括演算と、同じ式を Vector2 のメンバ関数で 1 要素ずつ回す素朴なループの比較。
+// キャッシュに収まる件数と収まらない件数の 2 通りで測る。
+
+#include "BenchCommon.h"
+#include <NeonVector/Math/Random.h>
+#include <NeonVector/Math/Vector2Pack.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace NeonVector;
+
+namespace
+{
+    void row(const char *name, double scalar, double batch)
+    {
+        char note[48];
+        std::snprintf(note, sizeof(note), "scalar %10.2f us  x%.2f", scalar, scalar / batch);
+        Bench::Report(name, batch, note);
+    }
+
+    void run(size_t count, int reps)
+    {
+        Random rng(3);
+        std::vector<Vector2> in(count);
+        std::vector<float> angles(count);
+        for (Vector2 &v : in)
+            v = {rng.Range(-500.0f, 500.0f), rng.Range(-500.0f, 500.0f)};
+        rng.FillUniform(angles.data(), count, -3.14159265f, 3.14159265f);
+        std::vector<Vector2> out(count);
+        std::vector<float> lengths(count);
+
+        const Vector2 translate{640.0f, 360.0f};
+        const Vector2 p{12.0f, -34.0f};
+        const float radians = 0.7f, scale = 1.5f;
+
+        std::printf("-- %zu vectors (time = Vector2Batch)\n", count);
+
+        const double transformScalar = Bench::MinMicros(reps, [&] {
+            const float c = std::cos(radians), s = std::sin(radians);
+            for (size_t i = 0; i < count; ++i)
+                out[i] = translate + in[i].Rotate(c, s) * scale;
+            Bench::DoNotOptimize(out[count - 1].x);
+        });
+        const double transformBatch = Bench::MinMicros(reps, [&] {
+            Vector2Batch::Transform(in.data(), out.data(), count, translate, radians, scale);
+            Bench::DoNotOptimize(out[count - 1].x);
+        });
+        row("Transform", transformScalar, transformBatch);
+
+        const double rotateScalar = Bench::MinMicros(reps, [&] {
+            const float c = std::cos(radians), s = std::sin(radians);
+            for (size_t i = 0; i < count; ++i)
+                out[i] = in[i].Rotate(c, s);
+            Bench::DoNotOptimize(out[count - 1].x);
+        });
+        const double rotateBatch = Bench::MinMicros(reps, [&] {
+            Vector2Batch::Rotate(in.data(), out.data(), count, radians);
+            Bench::DoNotOptimize(out[count - 1].x);
+        });
+        row("Rotate (one angle)", rotateScalar, rotateBatch);
+
+        // 素朴な側は std::cos / std::sin（一括版は FastMath::SinCos なので精度も違う）
+        const double rotateEachScalar = Bench::MinMicros(reps, [&] {
+            for (size_t i = 0; i < count; ++i)
+                out[i] = in[i].Rotate(angles[i]);
+            Bench::DoNotOptimize(out[count - 1].x);
+        });
+        const double rotateEachBatch = Bench::MinMicros(reps, [&] {
+            Vector2Batch::Rotate(in.data(), angles.data(), out.data(), count);
+            Bench::DoNotOptimize(out[count - 1].x);
+        });
+        row("Rotate (per-element angle)", rotateEachScalar, rotateEachBatch);
+
+        const double normalizeScalar = Bench::MinMicros(reps, [&] {
+            for (size_t i = 0; i < count; ++i)
+            {
+                out[i] = in[i];
+                out[i].Normalize();
+            }
+            Bench::DoNotOptimize(out[count - 1].x);
+        });
+        const double normalizeBatch = Bench::MinMicros(reps, [&] {
+            Vector2Batch::Normalize(in.data(), out.data(), count);
+            Bench::DoNotOptimize(out[count - 1].x);
+        });
+        row("Normalize", normalizeScalar, normalizeBatch);
+
+        const double lengthScalar = Bench::MinMicros(reps, [&] {
+            for (size_t i = 0; i < count; ++i)
+                lengths[i] = in[i].Length();
+            Bench::DoNotOptimize(lengths[count - 1]);
+        });
+        const double lengthBatch = Bench::MinMicros(reps, [&] {
+            Vector2Batch::Length(in.data(), lengths.data(), count);
+            Bench::DoNotOptimize(lengths[count - 1]);
+        });
+        row("Length", lengthScalar, lengthBatch);
+
+        const double distanceScalar = Bench::MinMicros(reps, [&] {
+            for (size_t i = 0; i < count; ++i)
+                lengths[i] = (in[i] - p).LengthSquared();
+            Bench::DoNotOptimize(lengths[count - 1]);
+        });
+        const double distanceBatch = Bench::MinMicros(reps, [&] {
+            Vector2Batch::DistanceSq(in.data(), p, lengths.data(), count);
+            Bench::DoNotOptimize(lengths[count - 1]);
+        });
+        row("DistanceSq", distanceScalar, distanceBatch);
+
+        const double minMaxScalar = Bench::MinMicros(reps, [&] {
+            Vector2 lo = in[0], hi = in[0];
+            for (size_t i = 1; i < count; ++i)
+            {
+                lo = {std::min(lo.x, in[i].x), std::min(lo.y, in[i].y)};
+                hi = {std::max(hi.x, in[i].x), std::max(hi.y, in[i].y)};
+            }
+            Bench::DoNotOptimize(lo.x + hi.y);
+        });
+        const double minMaxBatch = Bench::MinMicros(reps, [&] {
+            Vector2 lo, hi;
+            Vector2Batch::MinMax(in.data(), count, lo, hi);
+            Bench::DoNotOptimize(lo.x + hi.y);
+        });
+        row("MinMax", minMaxScalar, minMaxBatch);
+    }
+}
+
+int main()
+{
+    run(4096, 2000);
+    run(1 << 20, 20);
+    return 0;
+}